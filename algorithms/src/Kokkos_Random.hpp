@@ -206,6 +206,12 @@ namespace Kokkos {
     void fill_random(ViewType view, PoolType pool,
                      ViewType::value_type start, ViewType::value_type end);
 
+    Counter-based generators (Random_Philox4x32, Random_Threefry2x64) have the
+    Generator interface above but no pool: they are constructed from
+    (seed, counter, stream) inside any functor, and draws depend only on those
+    values. They can be passed to fill_random in place of a pool, which makes
+    the result independent of the number of threads.
+
 */
 // clang-format on
 
@@ -430,7 +436,12 @@ struct rand<Generator, Kokkos::Experimental::half_t> {
   KOKKOS_INLINE_FUNCTION
   static half max() { return half(1.0); }
   KOKKOS_INLINE_FUNCTION
-  static half draw(Generator& gen) { return half(gen.frand()); }
+  static half draw(Generator& gen) {
+    // frand() values within half an ulp of 1 round up to 1; keep the draw
+    // in [0, 1) by clamping to nextafter(1, 0) in binary16.
+    const float below_one = 1.0f - 1.0f / 2048;
+    return half(Kokkos::min(gen.frand(), below_one));
+  }
   KOKKOS_INLINE_FUNCTION
   static half draw(Generator& gen, const half& range) {
     return half(gen.frand(float(range)));
@@ -449,7 +460,11 @@ struct rand<Generator, Kokkos::Experimental::bhalf_t> {
   KOKKOS_INLINE_FUNCTION
   static bhalf max() { return bhalf(1.0); }
   KOKKOS_INLINE_FUNCTION
-  static bhalf draw(Generator& gen) { return bhalf(gen.frand()); }
+  static bhalf draw(Generator& gen) {
+    // Same as half_t, with nextafter(1, 0) in bfloat16
+    const float below_one = 1.0f - 1.0f / 256;
+    return bhalf(Kokkos::min(gen.frand(), below_one));
+  }
   KOKKOS_INLINE_FUNCTION
   static bhalf draw(Generator& gen, const bhalf& range) {
     return bhalf(gen.frand(float(range)));
@@ -1218,6 +1233,307 @@ class Random_XorShift1024_Pool {
 
 namespace Impl {
 
+// Philox4x32-10 and Threefry2x64-20 block functions, see Salmon et al.
+// (2011). "Parallel random numbers: as easy as 1, 2, 3."
+// Both map a 128-bit counter and a key to 128 random bits.  block_batch
+// computes N independent blocks with the lanes as innermost loops so that
+// the compiler can vectorize across them.
+struct Random_Philox4x32_10 {
+  template <int N>
+  KOKKOS_INLINE_FUNCTION static void block_batch(
+      uint64_t seed, uint32_t stream, const uint64_t (&counter)[N],
+      uint32_t block_idx, uint32_t (&out)[N][4]) {
+    constexpr uint32_t M0 = 0xD2511F53u;
+    constexpr uint32_t M1 = 0xCD9E8D57u;
+    constexpr uint32_t W0 = 0x9E3779B9u;
+    constexpr uint32_t W1 = 0xBB67AE85u;
+
+    uint32_t c0[N], c1[N], c2[N], c3[N];
+    for (int n = 0; n < N; ++n) {
+      c0[n] = block_idx;
+      c1[n] = stream;
+      c2[n] = static_cast<uint32_t>(counter[n]);
+      c3[n] = static_cast<uint32_t>(counter[n] >> 32);
+    }
+    uint32_t k0 = static_cast<uint32_t>(seed);
+    uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+    for (int r = 0; r < 10; ++r) {
+      for (int n = 0; n < N; ++n) {
+        const uint64_t p0 = static_cast<uint64_t>(M0) * c0[n];
+        const uint64_t p1 = static_cast<uint64_t>(M1) * c2[n];
+        c0[n]             = static_cast<uint32_t>(p1 >> 32) ^ c1[n] ^ k0;
+        c1[n]             = static_cast<uint32_t>(p1);
+        c2[n]             = static_cast<uint32_t>(p0 >> 32) ^ c3[n] ^ k1;
+        c3[n]             = static_cast<uint32_t>(p0);
+      }
+      k0 += W0;
+      k1 += W1;
+    }
+    for (int n = 0; n < N; ++n) {
+      out[n][0] = c0[n];
+      out[n][1] = c1[n];
+      out[n][2] = c2[n];
+      out[n][3] = c3[n];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void block(uint64_t seed, uint32_t stream, uint64_t counter,
+                    uint32_t block_idx, uint32_t (&out)[4]) {
+    const uint64_t counters[1] = {counter};
+    uint32_t blocks[1][4];
+    block_batch(seed, stream, counters, block_idx, blocks);
+    for (int i = 0; i < 4; ++i) out[i] = blocks[0][i];
+  }
+};
+
+struct Random_Threefry2x64_20 {
+  template <int N>
+  KOKKOS_INLINE_FUNCTION static void block_batch(
+      uint64_t seed, uint32_t stream, const uint64_t (&counter)[N],
+      uint32_t block_idx, uint32_t (&out)[N][4]) {
+    constexpr int R[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+
+    const uint64_t ks[3] = {seed, stream,
+                            0x1BD11BDAA9FC1A22ull ^ seed ^ stream};
+    uint64_t x0[N], x1[N];
+    for (int n = 0; n < N; ++n) {
+      x0[n] = counter[n] + ks[0];
+      x1[n] = block_idx + ks[1];
+    }
+    for (int r = 0; r < 20; ++r) {
+      const int rot = R[r % 8];
+      for (int n = 0; n < N; ++n) {
+        x0[n] += x1[n];
+        x1[n] = (x1[n] << rot) | (x1[n] >> (64 - rot));
+        x1[n] ^= x0[n];
+      }
+      if (r % 4 == 3) {
+        const int s = r / 4 + 1;
+        for (int n = 0; n < N; ++n) {
+          x0[n] += ks[s % 3];
+          x1[n] += ks[(s + 1) % 3] + s;
+        }
+      }
+    }
+    for (int n = 0; n < N; ++n) {
+      out[n][0] = static_cast<uint32_t>(x0[n]);
+      out[n][1] = static_cast<uint32_t>(x0[n] >> 32);
+      out[n][2] = static_cast<uint32_t>(x1[n]);
+      out[n][3] = static_cast<uint32_t>(x1[n] >> 32);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void block(uint64_t seed, uint32_t stream, uint64_t counter,
+                    uint32_t block_idx, uint32_t (&out)[4]) {
+    const uint64_t counters[1] = {counter};
+    uint32_t blocks[1][4];
+    block_batch(seed, stream, counters, block_idx, blocks);
+    for (int i = 0; i < 4; ++i) out[i] = blocks[0][i];
+  }
+};
+
+/// \brief Generator interface on top of a counter-based block function.
+///
+/// The numbers drawn depend only on (seed, counter, stream) and on how many
+/// numbers were drawn before, never on the thread or the pool that runs the
+/// code.  Consecutive draws consume the 32-bit words of the blocks for
+/// block indices 0, 1, 2, ... of the same counter.
+template <class DeviceType, class BlockFunction>
+class Random_CounterBased {
+ public:
+  using device_type    = DeviceType;
+  using generator_type = Random_CounterBased<DeviceType, BlockFunction>;
+  using block_function = BlockFunction;
+
+  constexpr static uint32_t MAX_URAND   = std::numeric_limits<uint32_t>::max();
+  constexpr static uint64_t MAX_URAND64 = std::numeric_limits<uint64_t>::max();
+  constexpr static int32_t MAX_RAND     = std::numeric_limits<int32_t>::max();
+  constexpr static int64_t MAX_RAND64   = std::numeric_limits<int64_t>::max();
+
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased(uint64_t seed, uint64_t counter = 0, uint32_t stream = 0)
+      : seed_(seed), counter_(counter), stream_(stream) {}
+
+  // Starts from an already computed block for block index 0, e.g. one lane
+  // of BlockFunction::block_batch.
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased(uint64_t seed, uint64_t counter, uint32_t stream,
+                      const uint32_t (&first_block)[4])
+      : seed_(seed),
+        counter_(counter),
+        stream_(stream),
+        block_idx_(1),
+        pos_(0),
+        buffer_{first_block[0], first_block[1], first_block[2],
+                first_block[3]} {}
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t seed() const { return seed_; }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t counter() const { return counter_; }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t stream() const { return stream_; }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand() {
+    if (pos_ == 4) {
+      BlockFunction::block(seed_, stream_, counter_, block_idx_++, buffer_);
+      pos_ = 0;
+    }
+    return buffer_[pos_++];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64() {
+    const uint64_t lo = urand();
+    return lo | (static_cast<uint64_t>(urand()) << 32);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& range) {
+    const uint32_t max_val = (MAX_URAND / range) * range;
+    uint32_t tmp           = urand();
+    while (tmp >= max_val) tmp = urand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& start, const uint32_t& end) {
+    return urand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& range) {
+    const uint64_t max_val = (MAX_URAND64 / range) * range;
+    uint64_t tmp           = urand64();
+    while (tmp >= max_val) tmp = urand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& start, const uint64_t& end) {
+    return urand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand() { return static_cast<int>(urand() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& range) {
+    const int max_val = (MAX_RAND / range) * range;
+    int tmp           = rand();
+    while (tmp >= max_val) tmp = rand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& start, const int& end) {
+    return rand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64() { return static_cast<int64_t>(urand64() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& range) {
+    const int64_t max_val = (MAX_RAND64 / range) * range;
+    int64_t tmp           = rand64();
+    while (tmp >= max_val) tmp = rand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& start, const int64_t& end) {
+    return rand64(end - start) + start;
+  }
+
+  // use the upper 24 (53) bits so that the result is strictly below 1
+  KOKKOS_INLINE_FUNCTION
+  float frand() { return (urand() >> 8) * (1.0f / 16777216.0f); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& range) { return range * frand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& start, const float& end) {
+    return frand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand() { return (urand64() >> 11) * (1.0 / 9007199254740992.0); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& range) { return range * drand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& start, const double& end) {
+    return drand(end - start) + start;
+  }
+
+  // Box-muller method for drawing a standard normal distributed random
+  // number
+  KOKKOS_INLINE_FUNCTION
+  double normal() {
+    constexpr auto two_pi = 2 * Kokkos::numbers::pi_v<double>;
+
+    const double u     = 1.0 - drand();  // in (0, 1]
+    const double v     = drand();
+    const double r     = Kokkos::sqrt(-2.0 * Kokkos::log(u));
+    const double theta = v * two_pi;
+    return r * Kokkos::cos(theta);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double normal(const double& mean, const double& std_dev = 1.0) {
+    return mean + normal() * std_dev;
+  }
+
+ private:
+  uint64_t seed_;
+  uint64_t counter_;
+  uint32_t stream_;
+  uint32_t block_idx_  = 0;
+  int pos_             = 4;
+  uint32_t buffer_[4] = {};
+};
+
+template <class T>
+struct is_counter_based_generator : std::false_type {};
+
+template <class DeviceType, class BlockFunction>
+struct is_counter_based_generator<
+    Random_CounterBased<DeviceType, BlockFunction>> : std::true_type {};
+
+}  // namespace Impl
+
+/// \brief Counter-based generators that need no pool.
+///
+/// A generator is constructed from (seed, counter, stream) wherever random
+/// numbers are needed, typically with the loop index as counter:
+/// \code
+/// parallel_for(n, KOKKOS_LAMBDA(int i) {
+///   Kokkos::Random_Philox4x32<> gen(seed, i);
+///   x(i) = gen.drand();
+/// });
+/// \endcode
+/// The results are bitwise reproducible for any number of threads and any
+/// backend.  Passing a generator instead of a pool to fill_random fills
+/// element i, in row-major order of the indices, with a generator whose
+/// counter is the one of the given generator plus i.
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Philox4x32 =
+    Impl::Random_CounterBased<DeviceType, Impl::Random_Philox4x32_10>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Threefry2x64 =
+    Impl::Random_CounterBased<DeviceType, Impl::Random_Threefry2x64_20>;
+
+namespace Impl {
+
 template <class ViewType, class RandomPool, int loops, int rank,
           class IndexType>
 struct fill_random_functor_begin_end;
@@ -1506,19 +1822,212 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 8,
   }
 };
 
+// Multi-index of the element with a given row-major linear index,
+// incremented like an odometer.
+template <class ViewType, class IndexType>
+struct fill_random_odometer {
+  IndexType idx[8] = {};
+
+  KOKKOS_INLINE_FUNCTION
+  fill_random_odometer(const ViewType& a, IndexType linear) {
+    for (int r = int(ViewType::rank) - 1; r >= 0; --r) {
+      idx[r] = linear % static_cast<IndexType>(a.extent(r));
+      linear /= static_cast<IndexType>(a.extent(r));
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  typename ViewType::reference_type operator()(const ViewType& a) const {
+    return a.access(idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6],
+                    idx[7]);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void advance(const ViewType& a) {
+    for (int r = int(ViewType::rank) - 1; r >= 0; --r) {
+      if (++idx[r] < static_cast<IndexType>(a.extent(r))) return;
+      idx[r] = 0;
+    }
+  }
+};
+
+// Number of generators whose first block is computed together.
+inline constexpr int fill_random_batch = 8;
+
+// Element i, in row-major order of the indices, is drawn from a generator
+// whose counter is the one of the given generator plus i, so the result does
+// not depend on how the elements are distributed over threads.
+template <class ViewType, class Generator, int loops, class IndexType>
+struct fill_random_functor_counter_based {
+  ViewType a;
+  Generator gen;
+  typename ViewType::const_value_type begin, end;
+
+  using Rand = rand<Generator, typename ViewType::non_const_value_type>;
+
+  fill_random_functor_counter_based(ViewType a_, Generator gen_,
+                                    typename ViewType::const_value_type begin_,
+                                    typename ViewType::const_value_type end_)
+      : a(a_), gen(gen_), begin(begin_), end(end_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(IndexType i) const {
+    constexpr int batch   = fill_random_batch;
+    const IndexType first = i * loops;
+    const IndexType size  = a.size();
+    const IndexType last  = first + loops < size ? first + loops : size;
+
+    fill_random_odometer<ViewType, IndexType> element(a, first);
+    for (IndexType l = first; l < last; l += batch) {
+      uint64_t counters[batch];
+      uint32_t blocks[batch][4];
+      for (int n = 0; n < batch; ++n) counters[n] = gen.counter() + l + n;
+      Generator::block_function::block_batch(gen.seed(), gen.stream(),
+                                             counters, 0, blocks);
+
+      const int num = last - l < batch ? int(last - l) : batch;
+      for (int n = 0; n < num; ++n) {
+        Generator g(gen.seed(), counters[n], gen.stream(), blocks[n]);
+        element(a) = Rand::draw(g, begin, end);
+        element.advance(a);
+      }
+    }
+  }
+};
+
+// Standard normal variates by the Box-Muller transform, keeping both the
+// cosine and the sine output.  Uniforms are drawn in batches and the
+// transform runs over whole batches.  float and the half types are computed
+// in float from 24-bit uniforms, everything else in double from 53-bit ones.
+//
+// With a counter-based generator the pair of elements 2m and 2m + 1, in
+// row-major order, is computed from the first block of the counter plus m.
+template <class ViewType, class RandomPool, int loops, class IndexType>
+struct fill_random_normal_functor {
+  using value_type = typename ViewType::non_const_value_type;
+  using compute_type =
+      std::conditional_t<(sizeof(value_type) < sizeof(double)), float, double>;
+
+  ViewType a;
+  RandomPool rand_pool;
+  compute_type mean, std_dev;
+
+  static_assert(loops % (2 * fill_random_batch) == 0);
+
+  KOKKOS_INLINE_FUNCTION
+  static compute_type to_open_unit(uint32_t w0, uint32_t w1) {
+    // in (0, 1] so that the logarithm is finite
+    if constexpr (std::is_same_v<compute_type, float>) {
+      (void)w1;
+      return 1.0f - (w0 >> 8) * (1.0f / 16777216.0f);
+    } else {
+      const uint64_t bits = w0 | (static_cast<uint64_t>(w1) << 32);
+      return 1.0 - (bits >> 11) * (1.0 / 9007199254740992.0);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void draw_uniforms(IndexType first_pair, compute_type (&u)[fill_random_batch],
+                     compute_type (&v)[fill_random_batch]) const {
+    constexpr int batch = fill_random_batch;
+    if constexpr (is_counter_based_generator<RandomPool>::value) {
+      uint64_t counters[batch];
+      uint32_t blocks[batch][4];
+      for (int n = 0; n < batch; ++n)
+        counters[n] = rand_pool.counter() + first_pair + n;
+      RandomPool::block_function::block_batch(
+          rand_pool.seed(), rand_pool.stream(), counters, 0, blocks);
+      for (int n = 0; n < batch; ++n) {
+        u[n] = to_open_unit(blocks[n][0], blocks[n][1]);
+        v[n] = to_open_unit(blocks[n][2], blocks[n][3]);
+      }
+    } else {
+      (void)first_pair;
+      typename RandomPool::generator_type gen = rand_pool.get_state();
+      for (int n = 0; n < batch; ++n) {
+        if constexpr (std::is_same_v<compute_type, float>) {
+          u[n] = to_open_unit(gen.urand(), 0);
+          v[n] = to_open_unit(gen.urand(), 0);
+        } else {
+          const uint64_t bu = gen.urand64();
+          const uint64_t bv = gen.urand64();
+          u[n] = to_open_unit(uint32_t(bu), uint32_t(bu >> 32));
+          v[n] = to_open_unit(uint32_t(bv), uint32_t(bv >> 32));
+        }
+      }
+      rand_pool.free_state(gen);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(IndexType i) const {
+    constexpr int batch   = fill_random_batch;
+    constexpr auto two_pi = 2 * Kokkos::numbers::pi_v<compute_type>;
+
+    const IndexType first = i * loops;
+    const IndexType size  = a.size();
+    const IndexType last  = first + loops < size ? first + loops : size;
+
+    fill_random_odometer<ViewType, IndexType> element(a, first);
+    for (IndexType l = first; l < last; l += 2 * batch) {
+      compute_type u[batch], v[batch], z[2 * batch];
+      draw_uniforms(l / 2, u, v);
+      for (int n = 0; n < batch; ++n) {
+        const compute_type r =
+            Kokkos::sqrt(compute_type(-2) * Kokkos::log(u[n]));
+        const compute_type theta = two_pi * v[n];
+        z[2 * n]                 = mean + std_dev * r * Kokkos::cos(theta);
+        z[2 * n + 1]             = mean + std_dev * r * Kokkos::sin(theta);
+      }
+
+      const int num = last - l < 2 * batch ? int(last - l) : 2 * batch;
+      for (int n = 0; n < num; ++n) {
+        element(a) = value_type(z[n]);
+        element.advance(a);
+      }
+    }
+  }
+};
+
 template <class ExecutionSpace, class ViewType, class RandomPool,
           class IndexType = int64_t>
 void fill_random(const ExecutionSpace& exec, ViewType a, RandomPool g,
                  typename ViewType::const_value_type begin,
                  typename ViewType::const_value_type end) {
-  int64_t LDA = a.extent(0);
-  if (LDA > 0)
+  if constexpr (is_counter_based_generator<RandomPool>::value) {
+    int64_t size = a.size();
+    if (size > 0)
+      parallel_for(
+          "Kokkos::fill_random",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (size + 127) / 128),
+          Impl::fill_random_functor_counter_based<ViewType, RandomPool, 128,
+                                                  IndexType>(a, g, begin,
+                                                             end));
+  } else {
+    int64_t LDA = a.extent(0);
+    if (LDA > 0)
+      parallel_for(
+          "Kokkos::fill_random",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (LDA + 127) / 128),
+          Impl::fill_random_functor_begin_end<ViewType, RandomPool, 128,
+                                              ViewType::rank, IndexType>(
+              a, g, begin, end));
+  }
+}
+
+template <class ExecutionSpace, class ViewType, class RandomPool>
+void fill_random_normal(const ExecutionSpace& exec, ViewType a, RandomPool g,
+                        typename ViewType::const_value_type mean,
+                        typename ViewType::const_value_type std_dev) {
+  using functor_type =
+      Impl::fill_random_normal_functor<ViewType, RandomPool, 128, int64_t>;
+  using compute_type = typename functor_type::compute_type;
+  int64_t size       = a.size();
+  if (size > 0)
     parallel_for(
-        "Kokkos::fill_random",
-        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (LDA + 127) / 128),
-        Impl::fill_random_functor_begin_end<ViewType, RandomPool, 128,
-                                            ViewType::rank, IndexType>(
-            a, g, begin, end));
+        "Kokkos::fill_random_normal",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (size + 127) / 128),
+        functor_type{a, g, compute_type(mean), compute_type(std_dev)});
 }
 
 }  // namespace Impl
@@ -1563,6 +2072,42 @@ void fill_random(ViewType a, RandomPool g,
       "fill_random: fence after since no execution space instance provided");
 }
 
+/// \brief Fills a view of floating point values with normal variates of the
+/// given mean and standard deviation.
+///
+/// Uses both outputs of each Box-Muller transform.  With a counter-based
+/// generator the result does not depend on the number of threads.
+template <class ExecutionSpace, class ViewType, class RandomPool>
+void fill_random_normal(const ExecutionSpace& exec, ViewType a, RandomPool g,
+                        typename ViewType::const_value_type mean,
+                        typename ViewType::const_value_type std_dev = 1) {
+  using value_type = typename ViewType::non_const_value_type;
+  static_assert(std::is_floating_point_v<value_type> ||
+                    Experimental::Impl::is_float16<value_type>::value ||
+                    Experimental::Impl::is_bfloat16<value_type>::value,
+                "Kokkos::fill_random_normal requires a View of floating point "
+                "values");
+  Impl::apply_to_view_of_static_rank(
+      [&](auto dst) {
+        Kokkos::Impl::fill_random_normal(exec, dst, g, mean, std_dev);
+      },
+      a);
+}
+
+template <class ViewType, class RandomPool>
+void fill_random_normal(ViewType a, RandomPool g,
+                        typename ViewType::const_value_type mean,
+                        typename ViewType::const_value_type std_dev = 1) {
+  Kokkos::fence(
+      "fill_random_normal: fence before since no execution space instance "
+      "provided");
+  typename ViewType::execution_space exec;
+  fill_random_normal(exec, a, g, mean, std_dev);
+  exec.fence(
+      "fill_random_normal: fence after since no execution space instance "
+      "provided");
+}
+
 }  // namespace Kokkos
 
 #ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_RANDOM
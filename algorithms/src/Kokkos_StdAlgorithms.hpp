@@ -110,6 +110,9 @@
 #include "std_algorithms/Kokkos_InclusiveScan.hpp"
 #include "std_algorithms/Kokkos_TransformInclusiveScan.hpp"
 
+// lazy range adaptors
+#include "std_algorithms/Kokkos_RangeAdaptors.hpp"
+
 #ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_STD_ALGORITHMS
 #undef KOKKOS_IMPL_PUBLIC_INCLUDE
 #undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_STD_ALGORITHMS
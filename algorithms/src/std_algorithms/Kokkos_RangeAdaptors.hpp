@@ -0,0 +1,262 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_RANGE_ADAPTORS_HPP
+#define KOKKOS_STD_ALGORITHMS_RANGE_ADAPTORS_HPP
+
+#include "impl/Kokkos_RangeAdaptors.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// lazy range adaptors:
+//
+//   auto r = KE::views::transform(view, f) | KE::views::filter(p);
+//   auto s = KE::reduce(exespace(), r, 0.);
+//
+// the adaptors neither allocate nor launch anything, the algorithms below
+// consume the whole pipeline in a single kernel
+//
+namespace views {
+
+template <typename ViewOrRangeType, typename UnaryOp,
+          std::enable_if_t<Impl::is_view_or_lazy_range_v<ViewOrRangeType>,
+                           int> = 0>
+auto transform(const ViewOrRangeType& view_or_range, UnaryOp op) {
+  return Impl::lazy_range_transform(view_or_range, std::move(op));
+}
+
+template <typename UnaryOp>
+auto transform(UnaryOp op) {
+  return Impl::LazyRangeTransformClosure<UnaryOp>{std::move(op)};
+}
+
+template <typename ViewOrRangeType, typename UnaryPredicate,
+          std::enable_if_t<Impl::is_view_or_lazy_range_v<ViewOrRangeType>,
+                           int> = 0>
+auto filter(const ViewOrRangeType& view_or_range, UnaryPredicate pred) {
+  return Impl::lazy_range_filter(view_or_range, std::move(pred));
+}
+
+template <typename UnaryPredicate>
+auto filter(UnaryPredicate pred) {
+  return Impl::LazyRangeFilterClosure<UnaryPredicate>{std::move(pred)};
+}
+
+}  // namespace views
+
+//
+// reduce
+//
+template <
+    typename ExecutionSpace, typename RangeType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+typename RangeType::value_type reduce(const ExecutionSpace& ex,
+                                      const RangeType& range) {
+  return Impl::lazy_range_reduce_default_functors_exespace_impl(
+      "Kokkos::reduce_default_functors_range_api", ex, range,
+      typename RangeType::value_type());
+}
+
+template <
+    typename ExecutionSpace, typename RangeType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+typename RangeType::value_type reduce(const std::string& label,
+                                      const ExecutionSpace& ex,
+                                      const RangeType& range) {
+  return Impl::lazy_range_reduce_default_functors_exespace_impl(
+      label, ex, range, typename RangeType::value_type());
+}
+
+template <
+    typename ExecutionSpace, typename RangeType, typename ValueType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+ValueType reduce(const ExecutionSpace& ex, const RangeType& range,
+                 ValueType init_reduction_value) {
+  static_assert(std::is_move_constructible_v<ValueType>,
+                "ValueType must be move constructible.");
+
+  return Impl::lazy_range_reduce_default_functors_exespace_impl(
+      "Kokkos::reduce_default_functors_range_api", ex, range,
+      init_reduction_value);
+}
+
+template <
+    typename ExecutionSpace, typename RangeType, typename ValueType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+ValueType reduce(const std::string& label, const ExecutionSpace& ex,
+                 const RangeType& range, ValueType init_reduction_value) {
+  static_assert(std::is_move_constructible_v<ValueType>,
+                "ValueType must be move constructible.");
+
+  return Impl::lazy_range_reduce_default_functors_exespace_impl(
+      label, ex, range, init_reduction_value);
+}
+
+template <
+    typename ExecutionSpace, typename RangeType, typename ValueType,
+    typename BinaryOp,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+ValueType reduce(const ExecutionSpace& ex, const RangeType& range,
+                 ValueType init_reduction_value, BinaryOp joiner) {
+  static_assert(std::is_move_constructible_v<ValueType>,
+                "ValueType must be move constructible.");
+
+  return Impl::lazy_range_reduce_exespace_impl(
+      "Kokkos::reduce_custom_functors_range_api", ex, range,
+      init_reduction_value, joiner);
+}
+
+template <
+    typename ExecutionSpace, typename RangeType, typename ValueType,
+    typename BinaryOp,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+ValueType reduce(const std::string& label, const ExecutionSpace& ex,
+                 const RangeType& range, ValueType init_reduction_value,
+                 BinaryOp joiner) {
+  static_assert(std::is_move_constructible_v<ValueType>,
+                "ValueType must be move constructible.");
+
+  return Impl::lazy_range_reduce_exespace_impl(label, ex, range,
+                                               init_reduction_value, joiner);
+}
+
+//
+// transform_reduce
+//
+template <
+    typename ExecutionSpace, typename RangeType, typename ValueType,
+    typename BinaryJoinerType, typename UnaryTransform,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+ValueType transform_reduce(const ExecutionSpace& ex, const RangeType& range,
+                           ValueType init_reduction_value,
+                           BinaryJoinerType joiner,
+                           UnaryTransform transformer) {
+  static_assert(std::is_move_constructible_v<ValueType>,
+                "ValueType must be move constructible.");
+
+  return Impl::lazy_range_reduce_exespace_impl(
+      "Kokkos::transform_reduce_custom_functors_range_api", ex,
+      views::transform(range, std::move(transformer)), init_reduction_value,
+      joiner);
+}
+
+template <
+    typename ExecutionSpace, typename RangeType, typename ValueType,
+    typename BinaryJoinerType, typename UnaryTransform,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+ValueType transform_reduce(const std::string& label, const ExecutionSpace& ex,
+                           const RangeType& range,
+                           ValueType init_reduction_value,
+                           BinaryJoinerType joiner,
+                           UnaryTransform transformer) {
+  static_assert(std::is_move_constructible_v<ValueType>,
+                "ValueType must be move constructible.");
+
+  return Impl::lazy_range_reduce_exespace_impl(
+      label, ex, views::transform(range, std::move(transformer)),
+      init_reduction_value, joiner);
+}
+
+//
+// count_if
+//
+template <
+    typename ExecutionSpace, typename RangeType, typename Predicate,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+typename RangeType::difference_type count_if(const ExecutionSpace& ex,
+                                             const RangeType& range,
+                                             Predicate predicate) {
+  return Impl::lazy_range_count_if_exespace_impl(
+      "Kokkos::count_if_range_api_default", ex, range, std::move(predicate));
+}
+
+template <
+    typename ExecutionSpace, typename RangeType, typename Predicate,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+typename RangeType::difference_type count_if(const std::string& label,
+                                             const ExecutionSpace& ex,
+                                             const RangeType& range,
+                                             Predicate predicate) {
+  return Impl::lazy_range_count_if_exespace_impl(label, ex, range,
+                                                 std::move(predicate));
+}
+
+//
+// copy_if: the selected elements are written to the front of dest, the
+// returned iterator points past the last one written
+//
+template <
+    typename ExecutionSpace, typename RangeType, typename DataType,
+    typename... Properties, typename Predicate,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+auto copy_if(const ExecutionSpace& ex, const RangeType& range,
+             const ::Kokkos::View<DataType, Properties...>& dest,
+             Predicate pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lazy_range_copy_if_exespace_impl(
+      "Kokkos::copy_if_range_api_default", ex, range, KE::begin(dest),
+      std::move(pred));
+}
+
+template <
+    typename ExecutionSpace, typename RangeType, typename DataType,
+    typename... Properties, typename Predicate,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace> &&
+                         Impl::is_lazy_range_v<RangeType>,
+                     int> = 0>
+auto copy_if(const std::string& label, const ExecutionSpace& ex,
+             const RangeType& range,
+             const ::Kokkos::View<DataType, Properties...>& dest,
+             Predicate pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lazy_range_copy_if_exespace_impl(label, ex, range,
+                                                KE::begin(dest),
+                                                std::move(pred));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
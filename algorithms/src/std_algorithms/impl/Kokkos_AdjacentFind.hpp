@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_FirstLocReduce.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -86,8 +87,8 @@ IteratorType adjacent_find_exespace_impl(const std::string& label,
 
   // note that we use below num_elements-1 because
   // each index i in the reduction checks i and (i+1).
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements - 1),
+  first_loc_parallel_reduce(
+      label, ex, index_type(num_elements - 1),
       // use CTAD
       StdAdjacentFindFunctor(first, reducer, pred), reducer);
 
@@ -20,6 +20,8 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_FirstLocReduce.hpp"
+#include "Kokkos_Mismatch.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -63,15 +65,24 @@ bool equal_exespace_impl(const std::string& label, const ExecutionSpace& ex,
   Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
   Impl::expect_valid_range(first1, last1);
 
-  // run
-  const auto num_elements = Kokkos::Experimental::distance(first1, last1);
-  std::size_t different   = 0;
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-      StdEqualFunctor(first1, first2, predicate), different);
-  ex.fence("Kokkos::equal: fence after operation");
+  // aliases
+  using index_type           = typename IteratorType1::difference_type;
+  using reducer_type         = FirstLoc<index_type>;
+  using reduction_value_type = typename reducer_type::value_type;
 
-  return !different;
+  // run: look for the first mismatch so that host backends can stop early
+  const auto num_elements = Kokkos::Experimental::distance(first1, last1);
+  reduction_value_type red_result;
+  reducer_type reducer(red_result);
+  first_loc_parallel_reduce(
+      label, ex, index_type(num_elements),
+      // use CTAD
+      StdMismatchRedFunctor(first1, first2, reducer, std::move(predicate)),
+      reducer);
+
+  // fence not needed because reducing into scalar
+  return red_result.min_loc_true ==
+         ::Kokkos::reduction_identity<index_type>::min();
 }
 
 template <class ExecutionSpace, class IteratorType1, class IteratorType2>
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_FirstLocReduce.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -100,9 +101,9 @@ IteratorType1 find_first_of_exespace_impl(
   reduction_value_type red_result;
   reducer_type reducer(red_result);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-      func_t(first, s_first, s_last, reducer, pred), reducer);
+  first_loc_parallel_reduce(label, ex, num_elements,
+                            func_t(first, s_first, s_last, reducer, pred),
+                            reducer);
 
   // fence not needed because reducing into scalar
 
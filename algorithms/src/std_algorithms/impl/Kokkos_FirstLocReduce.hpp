@@ -0,0 +1,138 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_FIRST_LOC_REDUCE_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_FIRST_LOC_REDUCE_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Host execution spaces run the search over chunks of increasing index that
+// are handed out dynamically, i.e. in order.  Each chunk is scanned
+// sequentially and stops at its first match, and chunks that start past the
+// best match found so far are skipped.  Chunks start small and double in size
+// up to a cap chosen so that there are a few chunks per thread, so that a hit
+// near the front costs about (concurrency x chunk size) element visits while
+// a miss still balances across threads.
+template <class IndexType, class FunctorType, class ReducerType>
+struct StdFirstLocChunkFunctor {
+  using red_value_type = typename ReducerType::value_type;
+
+  static constexpr IndexType min_chunk_size = 1024;
+
+  FunctorType m_functor;
+  ReducerType m_reducer;
+  IndexType* m_best;
+  IndexType m_num_elements;
+  int m_num_growing_chunks;
+
+  static IndexType chunk_begin(IndexType chunk, int num_growing_chunks) {
+    if (chunk < num_growing_chunks) {
+      return min_chunk_size * ((IndexType(1) << chunk) - 1);
+    }
+    return min_chunk_size * ((IndexType(1) << num_growing_chunks) - 1) +
+           (chunk - num_growing_chunks) *
+               (min_chunk_size << num_growing_chunks);
+  }
+
+  static IndexType num_chunks(IndexType num_elements, int num_growing_chunks) {
+    IndexType chunk = 0;
+    while (chunk < num_growing_chunks &&
+           chunk_begin(chunk + 1, num_growing_chunks) < num_elements) {
+      ++chunk;
+    }
+    if (chunk < num_growing_chunks) return chunk + 1;
+    const IndexType cap = min_chunk_size << num_growing_chunks;
+    return num_growing_chunks +
+           (num_elements - chunk_begin(num_growing_chunks, num_growing_chunks) +
+            cap - 1) /
+               cap;
+  }
+
+  void operator()(const IndexType chunk) const {
+    const IndexType begin = chunk_begin(chunk, m_num_growing_chunks);
+    if (::Kokkos::atomic_load(m_best) <= begin) {
+      return;
+    }
+    const IndexType next = chunk_begin(chunk + 1, m_num_growing_chunks);
+    const IndexType end  = next < m_num_elements ? next : m_num_elements;
+
+    red_value_type red_value;
+    m_reducer.init(red_value);
+    for (IndexType i = begin; i < end; ++i) {
+      m_functor(i, red_value);
+      if (red_value.min_loc_true !=
+          ::Kokkos::reduction_identity<IndexType>::min()) {
+        ::Kokkos::atomic_min(m_best, red_value.min_loc_true);
+        return;
+      }
+    }
+  }
+};
+
+// Computes the first index in [0, num_elements) for which the functor
+// reports a match into the FirstLoc reducer, storing it in
+// reducer.reference().  On host execution spaces the search terminates
+// early, on other spaces this is a plain parallel_reduce.
+template <class ExecutionSpace, class IndexType, class FunctorType,
+          class ReducerType>
+void first_loc_parallel_reduce(const std::string& label,
+                               const ExecutionSpace& ex,
+                               const IndexType num_elements,
+                               const FunctorType& functor,
+                               const ReducerType& reducer) {
+  if constexpr (std::is_same_v<typename ExecutionSpace::memory_space,
+                               ::Kokkos::HostSpace>) {
+    using chunk_func_t =
+        StdFirstLocChunkFunctor<IndexType, FunctorType, ReducerType>;
+
+    // grow the chunks until there are about eight per thread
+    const IndexType target_chunk_size =
+        num_elements / (IndexType(ex.concurrency()) * 8);
+    int num_growing_chunks = 0;
+    while ((chunk_func_t::min_chunk_size << num_growing_chunks) <
+           target_chunk_size) {
+      ++num_growing_chunks;
+    }
+
+    IndexType best = ::Kokkos::reduction_identity<IndexType>::min();
+    const IndexType num_chunks =
+        chunk_func_t::num_chunks(num_elements, num_growing_chunks);
+    ::Kokkos::parallel_for(
+        label,
+        RangePolicy<ExecutionSpace, Schedule<Dynamic>, IndexType>(
+            ex, 0, num_chunks, ChunkSize(1)),
+        chunk_func_t{functor, reducer, &best, num_elements,
+                     num_growing_chunks});
+    ex.fence("Kokkos::first_loc_parallel_reduce: fence after search");
+    reducer.reference().min_loc_true = best;
+  } else {
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, num_elements), functor,
+        reducer);
+  }
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_FirstLocReduce.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -95,8 +96,8 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2,
   const auto num_elemen_par_reduce = (num_e1 <= num_e2) ? num_e1 : num_e2;
   reduction_value_type red_result;
   reducer_type reducer(red_result);
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elemen_par_reduce),
+  first_loc_parallel_reduce(
+      label, ex, index_type(num_elemen_par_reduce),
       // use CTAD
       StdMismatchRedFunctor(first1, first2, reducer, std::move(predicate)),
       reducer);
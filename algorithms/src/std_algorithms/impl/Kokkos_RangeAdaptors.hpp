@@ -0,0 +1,582 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_RANGE_ADAPTORS_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_RANGE_ADAPTORS_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_RandomAccessIterator.hpp"
+#include "Kokkos_ReducerWithArbitraryJoinerNoNeutralElement.hpp"
+#include "Kokkos_Reduce.hpp"
+#include "Kokkos_CopyIf.hpp"
+#include "Kokkos_CountCountIf.hpp"
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// random access iterator applying a unary operation on dereference
+//
+template <class IteratorType, class UnaryOpType>
+class TransformIterator {
+ public:
+  // the view the base iterator refers to, used by the accessibility checks
+  using view_type     = typename IteratorType::view_type;
+  using iterator_type = TransformIterator<IteratorType, UnaryOpType>;
+
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type        = Kokkos::Impl::remove_cvref_t<std::invoke_result_t<
+      const UnaryOpType&, decltype(std::declval<const IteratorType&>()[0])>>;
+  using difference_type   = typename IteratorType::difference_type;
+  using pointer           = void;
+  using reference         = value_type;
+
+  KOKKOS_DEFAULTED_FUNCTION TransformIterator() = default;
+
+  KOKKOS_FUNCTION
+  TransformIterator(IteratorType it, UnaryOpType op)
+      : m_it(std::move(it)), m_op(std::move(op)) {}
+
+  KOKKOS_FUNCTION
+  reference operator[](difference_type n) const { return m_op(m_it[n]); }
+
+  KOKKOS_FUNCTION
+  reference operator*() const { return m_op(*m_it); }
+
+  KOKKOS_FUNCTION
+  iterator_type& operator++() {
+    ++m_it;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type& operator--() {
+    --m_it;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator--(int) {
+    auto tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type& operator+=(difference_type n) {
+    m_it += n;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type& operator-=(difference_type n) {
+    m_it -= n;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator+(difference_type n) const {
+    auto it = *this;
+    it += n;
+    return it;
+  }
+
+  KOKKOS_FUNCTION
+  friend iterator_type operator+(difference_type n, iterator_type other) {
+    return other + n;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator-(difference_type n) const {
+    auto it = *this;
+    it -= n;
+    return it;
+  }
+
+  KOKKOS_FUNCTION
+  difference_type operator-(const iterator_type& it) const {
+    return m_it - it.m_it;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator==(const iterator_type& other) const {
+    return m_it == other.m_it;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator!=(const iterator_type& other) const {
+    return m_it != other.m_it;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator<(const iterator_type& other) const { return m_it < other.m_it; }
+
+  KOKKOS_FUNCTION
+  bool operator<=(const iterator_type& other) const {
+    return m_it <= other.m_it;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator>(const iterator_type& other) const { return m_it > other.m_it; }
+
+  KOKKOS_FUNCTION
+  bool operator>=(const iterator_type& other) const {
+    return m_it >= other.m_it;
+  }
+
+  KOKKOS_FUNCTION
+  const IteratorType& base() const { return m_it; }
+
+ private:
+  IteratorType m_it;
+  UnaryOpType m_op;
+};
+
+//
+// stages of a filtered lazy range: each element of the underlying iterator is
+// read once and handed through the stages in turn; a stage computes its value
+// once and passes it on to the next one only if the element is selected
+//
+struct LazyRangeNoStage {};
+
+template <class ValueType>
+struct LazyRangeSourceStage {
+  using value_type = std::remove_cv_t<ValueType>;
+
+  template <class T, class ConsumerType>
+  KOKKOS_FUNCTION void operator()(const T& value,
+                                  const ConsumerType& consumer) const {
+    consumer(value);
+  }
+};
+
+template <class PrevStageType, class UnaryPredicateType>
+struct LazyRangeFilterStage {
+  using value_type = typename PrevStageType::value_type;
+
+  PrevStageType m_prev;
+  UnaryPredicateType m_pred;
+
+  template <class ConsumerType>
+  struct Consumer {
+    const UnaryPredicateType& m_pred;
+    const ConsumerType& m_next;
+
+    template <class T>
+    KOKKOS_FUNCTION void operator()(const T& value) const {
+      if (m_pred(value)) {
+        m_next(value);
+      }
+    }
+  };
+
+  template <class T, class ConsumerType>
+  KOKKOS_FUNCTION void operator()(const T& value,
+                                  const ConsumerType& consumer) const {
+    m_prev(value, Consumer<ConsumerType>{m_pred, consumer});
+  }
+};
+
+template <class PrevStageType, class UnaryOpType>
+struct LazyRangeTransformStage {
+  using value_type = Kokkos::Impl::remove_cvref_t<std::invoke_result_t<
+      const UnaryOpType&, const typename PrevStageType::value_type&>>;
+
+  PrevStageType m_prev;
+  UnaryOpType m_op;
+
+  template <class ConsumerType>
+  struct Consumer {
+    const UnaryOpType& m_op;
+    const ConsumerType& m_next;
+
+    template <class T>
+    KOKKOS_FUNCTION void operator()(const T& value) const {
+      m_next(m_op(value));
+    }
+  };
+
+  template <class T, class ConsumerType>
+  KOKKOS_FUNCTION void operator()(const T& value,
+                                  const ConsumerType& consumer) const {
+    m_prev(value, Consumer<ConsumerType>{m_op, consumer});
+  }
+};
+
+//
+// a random access range whose elements are computed on access and,
+// if StageType is not LazyRangeNoStage, only partly selected
+//
+template <class IteratorType, class StageType = LazyRangeNoStage>
+class LazyRange {
+ public:
+  static constexpr bool is_filtered =
+      !std::is_same_v<StageType, LazyRangeNoStage>;
+
+  using iterator        = IteratorType;
+  using stage_type      = StageType;
+  using value_type      = typename std::conditional_t<is_filtered, StageType,
+                                                 IteratorType>::value_type;
+  using difference_type = typename IteratorType::difference_type;
+
+  LazyRange(IteratorType first, IteratorType last,
+            StageType stage = StageType{})
+      : m_first(std::move(first)),
+        m_last(std::move(last)),
+        m_stage(std::move(stage)) {}
+
+  const IteratorType& begin() const { return m_first; }
+  const IteratorType& end() const { return m_last; }
+  const StageType& stage() const { return m_stage; }
+  difference_type extent() const { return m_last - m_first; }
+
+ private:
+  IteratorType m_first;
+  IteratorType m_last;
+  StageType m_stage;
+};
+
+template <class T>
+struct is_lazy_range : std::false_type {};
+
+template <class IteratorType, class StageType>
+struct is_lazy_range<LazyRange<IteratorType, StageType>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_lazy_range_v = is_lazy_range<T>::value;
+
+template <class T>
+inline constexpr bool is_view_or_lazy_range_v =
+    ::Kokkos::is_view_v<T> || is_lazy_range_v<T>;
+
+template <class ViewOrRangeType>
+auto to_lazy_range(const ViewOrRangeType& view_or_range) {
+  if constexpr (is_lazy_range_v<ViewOrRangeType>) {
+    return view_or_range;
+  } else {
+    static_assert_is_admissible_to_kokkos_std_algorithms(view_or_range);
+    return LazyRange(::Kokkos::Experimental::cbegin(view_or_range),
+                     ::Kokkos::Experimental::cend(view_or_range));
+  }
+}
+
+template <class ViewOrRangeType, class UnaryOpType>
+auto lazy_range_transform(const ViewOrRangeType& view_or_range,
+                          UnaryOpType op) {
+  const auto range = to_lazy_range(view_or_range);
+  using range_type = std::remove_const_t<decltype(range)>;
+
+  if constexpr (range_type::is_filtered) {
+    // the predicates already computed the elements, transform them once
+    // they are selected instead of recomputing them through the iterator
+    using stage_type =
+        LazyRangeTransformStage<typename range_type::stage_type, UnaryOpType>;
+    return LazyRange(range.begin(), range.end(),
+                     stage_type{range.stage(), std::move(op)});
+  } else {
+    using iterator_type =
+        TransformIterator<typename range_type::iterator, UnaryOpType>;
+    return LazyRange(iterator_type(range.begin(), op),
+                     iterator_type(range.end(), op));
+  }
+}
+
+template <class ViewOrRangeType, class UnaryPredicateType>
+auto lazy_range_filter(const ViewOrRangeType& view_or_range,
+                       UnaryPredicateType pred) {
+  const auto range = to_lazy_range(view_or_range);
+  using range_type = std::remove_const_t<decltype(range)>;
+
+  if constexpr (range_type::is_filtered) {
+    using stage_type =
+        LazyRangeFilterStage<typename range_type::stage_type,
+                             UnaryPredicateType>;
+    return LazyRange(range.begin(), range.end(),
+                     stage_type{range.stage(), std::move(pred)});
+  } else {
+    using source_type = LazyRangeSourceStage<typename range_type::value_type>;
+    using stage_type  = LazyRangeFilterStage<source_type, UnaryPredicateType>;
+    return LazyRange(range.begin(), range.end(),
+                     stage_type{source_type{}, std::move(pred)});
+  }
+}
+
+//
+// adaptor closures for the pipe syntax
+//
+template <class UnaryOpType>
+struct LazyRangeTransformClosure {
+  UnaryOpType m_op;
+};
+
+template <class UnaryPredicateType>
+struct LazyRangeFilterClosure {
+  UnaryPredicateType m_pred;
+};
+
+template <class ViewOrRangeType, class UnaryOpType,
+          std::enable_if_t<is_view_or_lazy_range_v<ViewOrRangeType>, int> = 0>
+auto operator|(const ViewOrRangeType& view_or_range,
+               const LazyRangeTransformClosure<UnaryOpType>& closure) {
+  return lazy_range_transform(view_or_range, closure.m_op);
+}
+
+template <class ViewOrRangeType, class UnaryPredicateType,
+          std::enable_if_t<is_view_or_lazy_range_v<ViewOrRangeType>, int> = 0>
+auto operator|(const ViewOrRangeType& view_or_range,
+               const LazyRangeFilterClosure<UnaryPredicateType>& closure) {
+  return lazy_range_filter(view_or_range, closure.m_pred);
+}
+
+//
+// functors for the filtered ranges, all elements of unfiltered ranges are
+// consumed by the existing iterator based implementations
+//
+template <class IteratorType, class StageType, class ReducerType>
+struct StdLazyRangeReduceFunctor {
+  using red_value_type = typename ReducerType::value_type;
+  using index_type     = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  StageType m_stage;
+  ReducerType m_reducer;
+
+  struct Consumer {
+    const ReducerType& m_reducer;
+    red_value_type& m_red_value;
+
+    template <class T>
+    KOKKOS_FUNCTION void operator()(const T& value) const {
+      auto tmp_wrapped_value = red_value_type{value, false};
+
+      if (m_red_value.is_initial) {
+        m_red_value = tmp_wrapped_value;
+      } else {
+        m_reducer.join(m_red_value, tmp_wrapped_value);
+      }
+    }
+  };
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i, red_value_type& red_value) const {
+    m_stage(m_first[i], Consumer{m_reducer, red_value});
+  }
+};
+
+template <class IteratorType, class StageType, class PredicateType>
+struct StdLazyRangeCountIfFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  StageType m_stage;
+  PredicateType m_pred;
+
+  struct Consumer {
+    const PredicateType& m_pred;
+    index_type& m_lsum;
+
+    template <class T>
+    KOKKOS_FUNCTION void operator()(const T& value) const {
+      if (m_pred(value)) {
+        m_lsum++;
+      }
+    }
+  };
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i, index_type& lsum) const {
+    m_stage(m_first[i], Consumer{m_pred, lsum});
+  }
+};
+
+template <class IteratorType, class StageType, class DestIteratorType,
+          class PredicateType>
+struct StdLazyRangeCopyIfFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  StageType m_stage;
+  DestIteratorType m_first_dest;
+  PredicateType m_pred;
+
+  struct Consumer {
+    const DestIteratorType& m_first_dest;
+    const PredicateType& m_pred;
+    index_type& m_update;
+    bool m_final_pass;
+
+    template <class T>
+    KOKKOS_FUNCTION void operator()(const T& value) const {
+      if (m_pred(value)) {
+        if (m_final_pass) {
+          m_first_dest[m_update] = value;
+        }
+        m_update += 1;
+      }
+    }
+  };
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i, index_type& update,
+                  const bool final_pass) const {
+    m_stage(m_first[i], Consumer{m_first_dest, m_pred, update, final_pass});
+  }
+};
+
+//
+// exespace impl
+//
+template <class ExecutionSpace, class RangeType, class ValueType,
+          class JoinerType>
+ValueType lazy_range_reduce_exespace_impl(const std::string& label,
+                                          const ExecutionSpace& ex,
+                                          const RangeType& range,
+                                          ValueType init_reduction_value,
+                                          JoinerType joiner) {
+  if constexpr (!RangeType::is_filtered) {
+    return reduce_custom_functors_exespace_impl(
+        label, ex, range.begin(), range.end(), std::move(init_reduction_value),
+        std::move(joiner));
+  } else {
+    // checks
+    Impl::static_assert_random_access_and_accessible(ex, range.begin());
+    Impl::static_assert_is_not_openmptarget(ex);
+    Impl::expect_valid_range(range.begin(), range.end());
+
+    // aliases
+    using iterator = typename RangeType::iterator;
+    using reducer_type =
+        ReducerWithArbitraryJoinerNoNeutralElement<ValueType, JoinerType>;
+    using reduction_value_type = typename reducer_type::value_type;
+    using func_t = StdLazyRangeReduceFunctor<iterator,
+                                             typename RangeType::stage_type,
+                                             reducer_type>;
+
+    // run
+    reduction_value_type result;
+    reducer_type reducer(result, joiner);
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, range.extent()),
+        func_t{range.begin(), range.stage(), reducer}, reducer);
+
+    // fence not needed since reducing into scalar
+    if (result.is_initial) {
+      // no element was selected, init is returned, unmodified
+      return init_reduction_value;
+    }
+    return joiner(result.val, init_reduction_value);
+  }
+}
+
+template <class ExecutionSpace, class RangeType, class ValueType>
+ValueType lazy_range_reduce_default_functors_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, const RangeType& range,
+    ValueType init_reduction_value) {
+  if constexpr (!RangeType::is_filtered) {
+    return reduce_default_functors_exespace_impl(
+        label, ex, range.begin(), range.end(), std::move(init_reduction_value));
+  } else {
+    using value_type  = Kokkos::Impl::remove_cvref_t<ValueType>;
+    using joiner_type = StdReduceDefaultJoinFunctor<value_type>;
+    return lazy_range_reduce_exespace_impl(label, ex, range,
+                                           std::move(init_reduction_value),
+                                           joiner_type());
+  }
+}
+
+template <class ExecutionSpace, class RangeType, class PredicateType>
+typename RangeType::difference_type lazy_range_count_if_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, const RangeType& range,
+    PredicateType pred) {
+  if constexpr (!RangeType::is_filtered) {
+    return count_if_exespace_impl(label, ex, range.begin(), range.end(),
+                                  std::move(pred));
+  } else {
+    // checks
+    Impl::static_assert_random_access_and_accessible(ex, range.begin());
+    Impl::expect_valid_range(range.begin(), range.end());
+
+    // aliases
+    using func_t =
+        StdLazyRangeCountIfFunctor<typename RangeType::iterator,
+                                   typename RangeType::stage_type,
+                                   PredicateType>;
+
+    // run
+    typename RangeType::difference_type count = 0;
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, range.extent()),
+        func_t{range.begin(), range.stage(), std::move(pred)}, count);
+
+    // fence not needed since reducing into scalar
+    return count;
+  }
+}
+
+template <class ExecutionSpace, class RangeType, class OutputIterator,
+          class PredicateType>
+OutputIterator lazy_range_copy_if_exespace_impl(const std::string& label,
+                                                const ExecutionSpace& ex,
+                                                const RangeType& range,
+                                                OutputIterator d_first,
+                                                PredicateType pred) {
+  if constexpr (!RangeType::is_filtered) {
+    return copy_if_exespace_impl(label, ex, range.begin(), range.end(),
+                                 d_first, std::move(pred));
+  } else {
+    // checks
+    Impl::static_assert_random_access_and_accessible(ex, range.begin(),
+                                                     d_first);
+    Impl::static_assert_iterators_have_matching_difference_type(range.begin(),
+                                                                d_first);
+    Impl::expect_valid_range(range.begin(), range.end());
+
+    // aliases
+    using func_t =
+        StdLazyRangeCopyIfFunctor<typename RangeType::iterator,
+                                  typename RangeType::stage_type,
+                                  OutputIterator, PredicateType>;
+
+    // run, see copy_if_exespace_impl for the scan
+    typename RangeType::difference_type count = 0;
+    ::Kokkos::parallel_scan(
+        label, RangePolicy<ExecutionSpace>(ex, 0, range.extent()),
+        func_t{range.begin(), range.stage(), d_first, std::move(pred)}, count);
+
+    // fence not needed because of the scan accumulating into count
+    return d_first + count;
+  }
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
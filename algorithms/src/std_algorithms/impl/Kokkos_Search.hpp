@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_FirstLocReduce.hpp"
 #include <std_algorithms/Kokkos_Equal.hpp>
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
@@ -134,8 +135,8 @@ IteratorType1 search_exespace_impl(const std::string& label,
     const auto range_size = num_elements - s_count + 1;
 
     // run par reduce
-    ::Kokkos::parallel_reduce(
-        label, RangePolicy<ExecutionSpace>(ex, 0, range_size),
+    first_loc_parallel_reduce(
+        label, ex, index_type(range_size),
         func_t(first, last, s_first, s_last, reducer, pred), reducer);
 
     // fence not needed because reducing into scalar
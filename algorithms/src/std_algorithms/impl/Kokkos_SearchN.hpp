@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_FirstLocReduce.hpp"
 #include "Kokkos_AllOfAnyOfNoneOf.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
@@ -130,8 +131,8 @@ IteratorType search_n_exespace_impl(const std::string& label,
     const auto range_size = num_elements - count + 1;
 
     // run par reduce
-    ::Kokkos::parallel_reduce(
-        label, RangePolicy<ExecutionSpace>(ex, 0, range_size),
+    first_loc_parallel_reduce(
+        label, ex, index_type(range_size),
         func_t(first, last, count, value, reducer, pred), reducer);
 
     // fence not needed because reducing into scalar
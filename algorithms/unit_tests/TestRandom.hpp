@@ -539,6 +539,119 @@ void test_duplicate_stream() {
   }
 }
 
+// Fills a rank 3 view with a counter-based generator and checks that every
+// element equals the value drawn on the host for its row-major index.
+template <class ExecutionSpace, class Generator>
+void test_counter_based_fill_random() {
+  using ViewType = Kokkos::View<double***, ExecutionSpace>;
+
+  ViewType a("a", 7, 5, 131);
+  Generator gen(2024, 1000, 3);
+  Kokkos::fill_random(ExecutionSpace(), a, gen, -1., 1.);
+  auto a_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, a);
+
+  double sum = 0.;
+  uint64_t l = 0;
+  for (size_t i = 0; i < a.extent(0); ++i) {
+    for (size_t j = 0; j < a.extent(1); ++j) {
+      for (size_t k = 0; k < a.extent(2); ++k, ++l) {
+        Generator g(gen.seed(), gen.counter() + l, gen.stream());
+        ASSERT_EQ(a_h(i, j, k), g.drand(-1., 1.));
+        ASSERT_GE(a_h(i, j, k), -1.);
+        ASSERT_LT(a_h(i, j, k), 1.);
+        sum += a_h(i, j, k);
+      }
+    }
+  }
+  // 4585 uniform draws in [-1, 1): the standard deviation of the mean is
+  // about 0.0085
+  ASSERT_LT(std::abs(sum / a.size()), 0.05);
+
+  // a different stream yields different numbers
+  ViewType b("b", 7, 5, 131);
+  Kokkos::fill_random(ExecutionSpace(), b,
+                      Generator(gen.seed(), gen.counter(), gen.stream() + 1),
+                      -1., 1.);
+  auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, b);
+  int num_equal = 0;
+  for (size_t i = 0; i < a.extent(0); ++i)
+    for (size_t j = 0; j < a.extent(1); ++j)
+      for (size_t k = 0; k < a.extent(2); ++k)
+        num_equal += a_h(i, j, k) == b_h(i, j, k);
+  ASSERT_EQ(num_equal, 0);
+}
+
+template <class ExecutionSpace, class Generator>
+struct generate_counter_based_properties {
+  using value_type = RandomProperties;
+
+  Generator gen;
+  uint64_t max_val;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(uint64_t i, RandomProperties& prop) const {
+    Generator g(gen.seed(), i);
+    const double tmp  = g.urand64() / static_cast<double>(max_val);
+    const double tmp2 = g.urand64() / static_cast<double>(max_val);
+    prop.count++;
+    prop.mean += tmp;
+    prop.variance += (tmp - 0.5) * (tmp - 0.5);
+    prop.covariance += (tmp - 0.5) * (tmp2 - 0.5);
+  }
+};
+
+template <class ExecutionSpace, class Generator>
+void test_counter_based_properties(uint64_t num_draws) {
+  RandomProperties result;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecutionSpace>(0, num_draws),
+      generate_counter_based_properties<ExecutionSpace, Generator>{
+          Generator(31891), Generator::MAX_URAND64},
+      result);
+
+  const double mean       = result.mean / result.count;
+  const double variance   = result.variance / result.count;
+  const double covariance = result.covariance / result.count;
+  EXPECT_NEAR(mean, 0.5, 0.01);
+  EXPECT_NEAR(variance, 1. / 12, 0.01);
+  EXPECT_NEAR(covariance, 0., 0.01);
+}
+
+// Checks the sample mean and standard deviation of fill_random_normal, and
+// that a counter-based generator gives the same result on every call.
+template <class ExecutionSpace, class Scalar, class RandomPool>
+void test_fill_random_normal(RandomPool pool) {
+  using ViewType = Kokkos::View<Scalar**, ExecutionSpace>;
+
+  ViewType a("a", 301, 333);
+  Kokkos::fill_random_normal(ExecutionSpace(), a, pool, Scalar(2.), Scalar(3.));
+  auto a_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, a);
+
+  double sum = 0., sum_sq = 0.;
+  for (size_t i = 0; i < a.extent(0); ++i) {
+    for (size_t j = 0; j < a.extent(1); ++j) {
+      const double x = static_cast<double>(a_h(i, j));
+      ASSERT_TRUE(Kokkos::isfinite(x));
+      sum += x;
+      sum_sq += x * x;
+    }
+  }
+  // 100233 draws: the standard deviation of the mean is about 0.0095
+  const double mean = sum / a.size();
+  EXPECT_NEAR(mean, 2., 0.05);
+  EXPECT_NEAR(std::sqrt(sum_sq / a.size() - mean * mean), 3., 0.05);
+
+  if constexpr (Kokkos::Impl::is_counter_based_generator<RandomPool>::value) {
+    ViewType b("b", 301, 333);
+    Kokkos::fill_random_normal(ExecutionSpace(), b, pool, Scalar(2.),
+                               Scalar(3.));
+    auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, b);
+    for (size_t i = 0; i < a.extent(0); ++i)
+      for (size_t j = 0; j < a.extent(1); ++j)
+        ASSERT_EQ(a_h(i, j), b_h(i, j));
+  }
+}
+
 }  // namespace AlgoRandomImpl
 
 TEST(TEST_CATEGORY, Random_XorShift64) {
@@ -610,5 +723,54 @@ TEST(TEST_CATEGORY, Multi_streams) {
   AlgoRandomImpl::test_duplicate_stream<ExecutionSpace, Pool1024>();
 }
 
+// Known answers from the Random123 distribution (kat_vectors).
+TEST(TEST_CATEGORY, Random_CounterBased_known_answers) {
+  uint32_t out[4];
+  Kokkos::Impl::Random_Philox4x32_10::block(0, 0, 0, 0, out);
+  EXPECT_EQ(out[0], 0x6627e8d5u);
+  EXPECT_EQ(out[1], 0xe169c58du);
+  EXPECT_EQ(out[2], 0xbc57ac4cu);
+  EXPECT_EQ(out[3], 0x9b00dbd8u);
+  Kokkos::Impl::Random_Philox4x32_10::block(
+      0x299f31d0a4093822ull, 0x85a308d3u, 0x0370734413198a2eull, 0x243f6a88u,
+      out);
+  EXPECT_EQ(out[0], 0xd16cfe09u);
+  EXPECT_EQ(out[1], 0x94fdccebu);
+  EXPECT_EQ(out[2], 0x5001e420u);
+  EXPECT_EQ(out[3], 0x24126ea1u);
+
+  Kokkos::Impl::Random_Threefry2x64_20::block(0, 0, 0, 0, out);
+  EXPECT_EQ(out[0] | (uint64_t(out[1]) << 32), 0xc2b6e3a8c2c69865ull);
+  EXPECT_EQ(out[2] | (uint64_t(out[3]) << 32), 0x6f81ed42f350084dull);
+}
+
+TEST(TEST_CATEGORY, Random_CounterBased) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  using Philox         = Kokkos::Random_Philox4x32<ExecutionSpace>;
+  using Threefry       = Kokkos::Random_Threefry2x64<ExecutionSpace>;
+
+  AlgoRandomImpl::test_counter_based_fill_random<ExecutionSpace, Philox>();
+  AlgoRandomImpl::test_counter_based_fill_random<ExecutionSpace, Threefry>();
+  AlgoRandomImpl::test_counter_based_properties<ExecutionSpace, Philox>(
+      1000000);
+  AlgoRandomImpl::test_counter_based_properties<ExecutionSpace, Threefry>(
+      1000000);
+  AlgoRandomImpl::TestDynRankView<ExecutionSpace, Philox>(10000).run();
+}
+
+TEST(TEST_CATEGORY, Random_fill_random_normal) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  using Philox         = Kokkos::Random_Philox4x32<ExecutionSpace>;
+  using Pool64         = Kokkos::Random_XorShift64_Pool<ExecutionSpace>;
+
+  AlgoRandomImpl::test_fill_random_normal<ExecutionSpace, double>(Philox(17));
+  AlgoRandomImpl::test_fill_random_normal<ExecutionSpace, float>(Philox(17));
+  AlgoRandomImpl::test_fill_random_normal<ExecutionSpace,
+                                          Kokkos::Experimental::half_t>(
+      Philox(17));
+  AlgoRandomImpl::test_fill_random_normal<ExecutionSpace, double>(Pool64(17));
+  AlgoRandomImpl::test_fill_random_normal<ExecutionSpace, float>(Pool64(17));
+}
+
 }  // namespace Test
 #endif
@@ -156,6 +156,35 @@ TEST(std_algorithms_find_test, test) {
   run_all_scenarios<StridedThreeTag, unsigned>();
 }
 
+// ranges large enough to be split into several chunks by the early
+// terminating search of the host backends, with matches at the front, at
+// chunk boundaries and at the back: the first match must always be returned
+TEST(std_algorithms_find_test, first_of_several_matches) {
+  constexpr int ext = 1 << 20;
+  Kokkos::View<int*> view("view", ext);
+  auto view_h = Kokkos::create_mirror_view(view);
+
+  for (int pos : {0, 1, 1023, 1024, 3071, 3072, 100000, ext - 2, ext - 1}) {
+    Kokkos::deep_copy(view_h, 0);
+    // additional matches after the first one
+    for (int i = pos; i < ext; i += 4099) {
+      view_h(i) = 1;
+    }
+    view_h(ext - 1) = 1;
+    Kokkos::deep_copy(view, view_h);
+
+    ASSERT_EQ(pos, KE::find(exespace(), view, 1) - KE::begin(view));
+    ASSERT_EQ(pos, KE::find_if_not(exespace(), view,
+                                   EqualsValFunctor<int>(0)) -
+                       KE::begin(view));
+    ASSERT_TRUE(KE::any_of(exespace(), view, NotEqualsZeroFunctor<int>()));
+  }
+
+  Kokkos::deep_copy(view, 0);
+  ASSERT_EQ(KE::end(view), KE::find(exespace(), view, 1));
+  ASSERT_FALSE(KE::any_of(exespace(), view, NotEqualsZeroFunctor<int>()));
+}
+
 }  // namespace Find
 }  // namespace stdalgos
 }  // namespace Test
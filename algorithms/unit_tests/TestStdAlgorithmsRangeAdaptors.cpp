@@ -0,0 +1,202 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace RangeAdaptors {
+
+namespace KE = Kokkos::Experimental;
+
+struct SquareFunctor {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(int a) const { return a * a; }
+};
+
+struct PlusOneFunctor {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(int a) const { return a + 1; }
+};
+
+struct IsMultipleOfThreeFunctor {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int a) const { return a % 3 == 0; }
+};
+
+struct IsEvenIntFunctor {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int a) const { return a % 2 == 0; }
+};
+
+struct AlwaysTrueFunctor {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int) const { return true; }
+};
+
+struct SumJoinFunctor {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(int a, int b) const { return a + b; }
+};
+
+struct MaxJoinFunctor {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(int a, int b) const { return a > b ? a : b; }
+};
+
+struct CountingSquareFunctor {
+  Kokkos::View<int, Kokkos::MemoryTraits<Kokkos::Atomic>> m_calls;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(int a) const {
+    m_calls() += 1;
+    return a * a;
+  }
+};
+
+template <class ViewType>
+std::vector<int> fill_and_copy_to_std(const ViewType& view) {
+  auto view_h = Kokkos::create_mirror_view(view);
+  std::vector<int> values(view.extent(0));
+  for (std::size_t i = 0; i < view.extent(0); ++i) {
+    values[i] = view_h(i) = static_cast<int>((i * 7919) % 1000) - 500;
+  }
+  Kokkos::deep_copy(view, view_h);
+  return values;
+}
+
+template <class ViewType>
+void test_pipelines(const ViewType& view) {
+  const auto values = fill_and_copy_to_std(view);
+
+  // gold: square, keep multiples of three, then add one
+  std::vector<int> gold;
+  for (int v : values) {
+    if ((v * v) % 3 == 0) {
+      gold.push_back(v * v + 1);
+    }
+  }
+
+  auto squared  = KE::views::transform(view, SquareFunctor());
+  auto pipeline = squared | KE::views::filter(IsMultipleOfThreeFunctor()) |
+                  KE::views::transform(PlusOneFunctor());
+  const int gold_sum = std::accumulate(gold.begin(), gold.end(), 0);
+
+  // reduce
+  ASSERT_EQ(gold_sum, KE::reduce(exespace(), pipeline));
+  ASSERT_EQ(gold_sum + 5, KE::reduce("label", exespace(), pipeline, 5));
+  const int gold_max =
+      gold.empty() ? -1 : *std::max_element(gold.begin(), gold.end());
+  ASSERT_EQ(std::max(gold_max, -1),
+            KE::reduce(exespace(), pipeline, -1, MaxJoinFunctor()));
+
+  // unfiltered pipeline through the iterator based implementation
+  int gold_sq_sum = 0;
+  for (int v : values) gold_sq_sum += v * v;
+  ASSERT_EQ(gold_sq_sum, KE::reduce(exespace(), squared));
+
+  // transform_reduce
+  int gold_tr = 0;
+  for (int v : gold) gold_tr += v * v;
+  ASSERT_EQ(gold_tr, KE::transform_reduce(exespace(), pipeline, 0,
+                                          SumJoinFunctor(),
+                                          SquareFunctor()));
+
+  // count_if
+  ASSERT_EQ(std::count_if(gold.begin(), gold.end(), IsEvenIntFunctor()),
+            KE::count_if(exespace(), pipeline, IsEvenIntFunctor()));
+  ASSERT_EQ(std::ptrdiff_t(values.size()),
+            KE::count_if(exespace(), squared, AlwaysTrueFunctor()));
+
+  // copy_if, the order of the selected elements is kept
+  Kokkos::View<int*> dest("dest", view.extent(0));
+  auto dest_end = KE::copy_if(exespace(), pipeline, dest, IsEvenIntFunctor());
+  std::vector<int> gold_copy;
+  std::copy_if(gold.begin(), gold.end(), std::back_inserter(gold_copy),
+               IsEvenIntFunctor());
+  ASSERT_EQ(std::ptrdiff_t(gold_copy.size()), dest_end - KE::begin(dest));
+  auto dest_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dest);
+  for (std::size_t i = 0; i < gold_copy.size(); ++i) {
+    ASSERT_EQ(gold_copy[i], dest_h(i));
+  }
+
+  // two filters in a row
+  auto twice = KE::views::filter(
+      KE::views::filter(view, IsMultipleOfThreeFunctor()), IsEvenIntFunctor());
+  ASSERT_EQ(std::count_if(values.begin(), values.end(),
+                          [](int v) { return v % 6 == 0; }),
+            KE::count_if(exespace(), twice, AlwaysTrueFunctor()));
+
+  // nothing selected: init is returned
+  auto none = KE::views::filter(squared, IsNegativeFunctor<int>());
+  ASSERT_EQ(42, KE::reduce(exespace(), none, 42));
+  ASSERT_EQ(42, KE::reduce(exespace(), none, 42, MaxJoinFunctor()));
+  ASSERT_EQ(0, KE::count_if(exespace(), none, AlwaysTrueFunctor()));
+  ASSERT_EQ(KE::begin(dest),
+            KE::copy_if(exespace(), none, dest, AlwaysTrueFunctor()));
+}
+
+template <class ViewType>
+void test_transform_evaluated_once(const ViewType& view) {
+  fill_and_copy_to_std(view);
+
+  const int ext = view.extent(0);
+  CountingSquareFunctor square{
+      Kokkos::View<int, Kokkos::MemoryTraits<Kokkos::Atomic>>("calls")};
+  auto calls = [&]() {
+    int result = 0;
+    Kokkos::deep_copy(result, square.m_calls);
+    Kokkos::deep_copy(square.m_calls, 0);
+    return result;
+  };
+
+  // the filters see the transformed values, which are then reused instead of
+  // being recomputed for the algorithm
+  auto pipeline = KE::views::transform(view, square) |
+                  KE::views::filter(IsMultipleOfThreeFunctor()) |
+                  KE::views::filter(IsEvenIntFunctor()) |
+                  KE::views::transform(PlusOneFunctor());
+
+  KE::reduce(exespace(), pipeline);
+  ASSERT_EQ(ext, calls());
+  KE::count_if(exespace(), pipeline, AlwaysTrueFunctor());
+  ASSERT_EQ(ext, calls());
+  // the scan of copy_if runs the functor twice on some backends
+  Kokkos::View<int*> dest("dest", ext);
+  KE::copy_if(exespace(), pipeline, dest, AlwaysTrueFunctor());
+  ASSERT_LE(calls(), 2 * ext);
+}
+
+TEST(std_algorithms_range_adaptors_test, pipelines) {
+  for (int ext : {0, 1, 13, 1001}) {
+    test_pipelines(Kokkos::View<int*>("view", ext));
+    test_pipelines(Kokkos::View<int*, Kokkos::LayoutStride>(
+        "view", Kokkos::LayoutStride(ext, 2)));
+  }
+}
+
+TEST(std_algorithms_range_adaptors_test, transform_evaluated_once) {
+  for (int ext : {0, 13, 1001}) {
+    test_transform_evaluated_once(Kokkos::View<int*>("view", ext));
+  }
+}
+
+}  // namespace RangeAdaptors
+}  // namespace stdalgos
+}  // namespace Test
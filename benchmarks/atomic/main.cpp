@@ -18,6 +18,32 @@
 #include <Kokkos_Timer.hpp>
 #include <Kokkos_Random.hpp>
 
+// Aggregate of N doubles used to exercise atomics on user-defined structs:
+// 16 bytes map onto a native 16-byte compare-and-swap where available, larger
+// structs go through the host lock array.
+template <int N>
+struct alignas(16) StructScalar {
+  double data[N];
+
+  KOKKOS_FUNCTION StructScalar(double val = 0) {
+    for (int i = 0; i < N; i++) data[i] = val;
+  }
+  KOKKOS_FUNCTION StructScalar operator+(const StructScalar& other) const {
+    StructScalar result;
+    for (int i = 0; i < N; i++) result.data[i] = data[i] + other.data[i];
+    return result;
+  }
+  KOKKOS_FUNCTION StructScalar operator*(const StructScalar& other) const {
+    StructScalar result;
+    for (int i = 0; i < N; i++) result.data[i] = data[i] * other.data[i];
+    return result;
+  }
+  KOKKOS_FUNCTION StructScalar& operator+=(const StructScalar& other) {
+    for (int i = 0; i < N; i++) data[i] += other.data[i];
+    return *this;
+  }
+};
+
 template <class Scalar>
 double test_atomic(int L, int N, int M, int K, int R,
                    Kokkos::View<const int**> offsets) {
@@ -40,6 +66,29 @@ double test_atomic(int L, int N, int M, int K, int R,
   return time;
 }
 
+template <class Scalar>
+double test_atomic_combining(int L, int N, int M, int K, int R,
+                             Kokkos::View<const int**> offsets) {
+  Kokkos::View<Scalar*, Kokkos::MemoryTraits<Kokkos::AtomicCombining> > output(
+      "Output", N);
+  Kokkos::Timer timer;
+
+  for (int r = 0; r < R; r++)
+    Kokkos::parallel_for(
+        L, KOKKOS_LAMBDA(const int& i) {
+          Scalar s = 2;
+          for (int m = 0; m < M; m++) {
+            for (int k = 0; k < K; k++) s = s * s + s;
+            const int idx = (i + offsets(i, m)) % N;
+            output(idx) += s;
+          }
+        });
+  Kokkos::fence();
+  double time = timer.seconds();
+
+  return time;
+}
+
 template <class Scalar>
 double test_no_atomic(int L, int N, int M, int K, int R,
                       Kokkos::View<const int**> offsets) {
@@ -77,6 +126,8 @@ int main(int argc, char* argv[]) {
       printf("       3 - float\n");
       printf("       4 - double\n");
       printf("       5 - complex<double>\n");
+      printf("       6 - struct of 2 doubles (16 bytes)\n");
+      printf("       7 - struct of 4 doubles (32 bytes)\n");
       printf("Example Input GPU:\n");
       printf("  Histogram : 1000000 1000 1 1000 1 10 1\n");
       printf("  MD Force : 100000 100000 100 1000 20 10 4\n");
@@ -103,6 +154,27 @@ int main(int argc, char* argv[]) {
     if (type == 4) time = test_atomic<double>(L, N, M, K, R, offsets);
     if (type == 5)
       time = test_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
+    if (type == 6) time = test_atomic<StructScalar<2> >(L, N, M, K, R, offsets);
+    if (type == 7) time = test_atomic<StructScalar<4> >(L, N, M, K, R, offsets);
+
+    double time_combining = 0;
+    if (type == 1)
+      time_combining = test_atomic_combining<int>(L, N, M, K, R, offsets);
+    if (type == 2)
+      time_combining = test_atomic_combining<long>(L, N, M, K, R, offsets);
+    if (type == 3)
+      time_combining = test_atomic_combining<float>(L, N, M, K, R, offsets);
+    if (type == 4)
+      time_combining = test_atomic_combining<double>(L, N, M, K, R, offsets);
+    if (type == 5)
+      time_combining = test_atomic_combining<Kokkos::complex<double> >(
+          L, N, M, K, R, offsets);
+    if (type == 6)
+      time_combining =
+          test_atomic_combining<StructScalar<2> >(L, N, M, K, R, offsets);
+    if (type == 7)
+      time_combining =
+          test_atomic_combining<StructScalar<4> >(L, N, M, K, R, offsets);
 
     double time2 = 1;
     if (type == 1) time2 = test_no_atomic<int>(L, N, M, K, R, offsets);
@@ -111,6 +183,10 @@ int main(int argc, char* argv[]) {
     if (type == 4) time2 = test_no_atomic<double>(L, N, M, K, R, offsets);
     if (type == 5)
       time2 = test_no_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
+    if (type == 6)
+      time2 = test_no_atomic<StructScalar<2> >(L, N, M, K, R, offsets);
+    if (type == 7)
+      time2 = test_no_atomic<StructScalar<4> >(L, N, M, K, R, offsets);
 
     int size = 0;
     if (type == 1) size = sizeof(int);
@@ -118,18 +194,27 @@ int main(int argc, char* argv[]) {
     if (type == 3) size = sizeof(float);
     if (type == 4) size = sizeof(double);
     if (type == 5) size = sizeof(Kokkos::complex<double>);
+    if (type == 6) size = sizeof(StructScalar<2>);
+    if (type == 7) size = sizeof(StructScalar<4>);
 
     printf("%i\n", size);
     printf(
-        "Time: %s %i %i %i %i %i %i (t_atomic: %e t_nonatomic: %e ratio: %lf "
-        ")( GUpdates/s: %lf GB/s: %lf )\n",
+        "Time: %s %i %i %i %i %i %i (t_atomic: %e t_combining: %e "
+        "t_nonatomic: %e ratio: %lf )( GUpdates/s: %lf GB/s: %lf )\n",
         (type == 1)
             ? "int"
             : ((type == 2)
                    ? "long"
-                   : ((type == 3) ? "float"
-                                  : ((type == 4) ? "double" : "complex"))),
-        L, N, M, D, K, R, time, time2, time / time2, 1.e-9 * L * R * M / time,
+                   : ((type == 3)
+                          ? "float"
+                          : ((type == 4)
+                                 ? "double"
+                                 : ((type == 5)
+                                        ? "complex"
+                                        : ((type == 6) ? "struct16"
+                                                       : "struct32"))))),
+        L, N, M, D, K, R, time, time_combining, time2, time / time2,
+        1.e-9 * L * R * M / time,
         1.0 * L * R * M * 2 * size / time / 1024 / 1024 / 1024);
   }
   Kokkos::finalize();
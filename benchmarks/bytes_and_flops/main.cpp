@@ -27,13 +27,18 @@ extern template void run_stride_unroll<int32_t>(int, int, int, int, int, int,
                                                 int, int, int, int);
 extern template void run_stride_unroll<int64_t>(int, int, int, int, int, int,
                                                 int, int, int, int);
+extern template void run_stride_unroll<Kokkos::Experimental::half_t>(
+    int, int, int, int, int, int, int, int, int, int);
+extern template void run_stride_unroll<Kokkos::Experimental::bhalf_t>(
+    int, int, int, int, int, int, int, int, int, int);
 
 int main(int argc, char* argv[]) {
   Kokkos::initialize();
 
   if (argc < 10) {
     printf("Arguments: N K R D U F T S B I\n");
-    printf("  P:   Precision (1==float, 2==double, 3==int32_t, 4==int64_t)\n");
+    printf("  P:   Precision (1==float, 2==double, 3==int32_t, 4==int64_t,\n");
+    printf("                  5==half_t, 6==bhalf_t)\n");
     printf("  N,K: dimensions of the 2D array to allocate\n");
     printf("  R:   how often to loop through the K dimension with each team\n");
     printf("  D:   distance between loaded elements (stride)\n");
@@ -86,8 +91,8 @@ int main(int argc, char* argv[]) {
     printf("D must be one of 1,2,4,8,16,32\n");
     return 0;
   }
-  if ((P < 1) || (P > 4)) {
-    printf("P must be one of 1,2,3,4\n");
+  if ((P < 1) || (P > 6)) {
+    printf("P must be one of 1,2,3,4,5,6\n");
     return 0;
   }
 
@@ -113,6 +118,14 @@ int main(int argc, char* argv[]) {
   if (P == 4) {
     run_stride_unroll<int64_t>(N, K, R, D, U, F, T, S, B, I);
   }
+  if (P == 5) {
+    run_stride_unroll<Kokkos::Experimental::half_t>(N, K, R, D, U, F, T, S, B,
+                                                    I);
+  }
+  if (P == 6) {
+    run_stride_unroll<Kokkos::Experimental::bhalf_t>(N, K, R, D, U, F, T, S,
+                                                     B, I);
+  }
 
   Kokkos::finalize();
 }
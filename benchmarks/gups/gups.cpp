@@ -35,6 +35,8 @@ using Datum = int64_t;
 
 using IndexView = Kokkos::View<Index*>;
 using DataView  = Kokkos::View<Datum*>;
+using CombiningDataView =
+    Kokkos::View<Datum*, Kokkos::MemoryTraits<Kokkos::AtomicCombining>>;
 
 using Clock    = std::chrono::steady_clock;
 using Duration = std::chrono::duration<double>;
@@ -80,8 +82,13 @@ IndexView permuted_indices(const Index indicesCount, const Index dataCount,
 }
 
 void run_gups(IndexView& indices, DataView& data, const Datum datum,
-              const bool performAtomics) {
-  if (performAtomics) {
+              const bool performAtomics, const bool performCombining) {
+  if (performCombining) {
+    CombiningDataView combining_data = data;
+    Kokkos::parallel_for(
+        "bench-gups-combining", indices.extent(0),
+        KOKKOS_LAMBDA(const Index i) { combining_data[indices[i]] ^= datum; });
+  } else if (performAtomics) {
     Kokkos::parallel_for(
         "bench-gups-atomic", indices.extent(0), KOKKOS_LAMBDA(const Index i) {
           Kokkos::atomic_fetch_xor(&data[indices[i]], datum);
@@ -99,7 +106,7 @@ enum class AccessPattern { random, permutation };
 
 int run_benchmark(const Index indicesCount, const Index dataCount,
                   const int repeats, const bool useAtomics,
-                  const AccessPattern pattern) {
+                  const bool useCombining, const AccessPattern pattern) {
   constexpr auto arbitrary_seed = 20230913;
   RNG rng(arbitrary_seed);
 
@@ -114,6 +121,7 @@ int run_benchmark(const Index indicesCount, const Index dataCount,
          static_cast<uint64_t>(indicesCount),
          1.0e-6 * ((double)indicesCount * (double)sizeof(Index)));
   printf(" - Atomics:      %15s\n", (useAtomics ? "Yes" : "No"));
+  printf(" - Combining:    %15s\n", (useCombining ? "Yes" : "No"));
   printf("Benchmark kernels will be performed for %d iterations.\n", repeats);
 
   printf(HLINE);
@@ -145,7 +153,7 @@ int run_benchmark(const Index indicesCount, const Index dataCount,
     }
 
     auto start = Clock::now();
-    run_gups(indices, data, datum, useAtomics);
+    run_gups(indices, data, datum, useAtomics, useCombining);
     gupsTime += Duration(Clock::now() - start).count();
   }
 
@@ -168,6 +176,7 @@ int main(int argc, char* argv[]) {
   int64_t data          = 33554432;
   int64_t repeats       = 10;
   bool useAtomics       = false;
+  bool useCombining     = false;
   AccessPattern pattern = AccessPattern::random;
 
   for (int i = 1; i < argc; ++i) {
@@ -182,12 +191,15 @@ int main(int argc, char* argv[]) {
       ++i;
     } else if (strcmp(argv[i], "--atomics") == 0) {
       useAtomics = true;
+    } else if (strcmp(argv[i], "--combining") == 0) {
+      useCombining = true;
     } else if (strcmp(argv[i], "--pattern-permutation") == 0) {
       pattern = AccessPattern::permutation;
     }
   }
 
-  const int rc = run_benchmark(indices, data, repeats, useAtomics, pattern);
+  const int rc =
+      run_benchmark(indices, data, repeats, useAtomics, useCombining, pattern);
 
   Kokkos::finalize();
 
@@ -42,7 +42,7 @@ int main(int argc, char* argv[]) {
     printf(
         "  test_type:      3-digit code XYZ for testing (nested) parallel_*\n");
     printf(
-        "  code key:       XYZ    X in {1,2,3,4,5}, Y in {0,1,2}, Z in "
+        "  code key:       XYZ    X in {1,2,3,4,5,6}, Y in {0,1,2}, Z in "
         "{0,1,2}\n");
     printf("                  TeamPolicy:\n");
     printf(
@@ -60,6 +60,12 @@ int main(int argc, char* argv[]) {
         "parallel_scan\n");
     printf("                    Y: 0 = none\n");
     printf("                    Z: 0 = none\n");
+    printf("                  Imbalanced TeamPolicy:\n");
+    printf(
+        "                    X: 6 = parallel_reduce over power law "
+        "distributed TeamThreadRange lengths\n");
+    printf("                    Y: 0 = none\n");
+    printf("                    Z: 0 = none\n");
     printf("  Example Input:\n");
     printf("  100000 32 32 100 100 100 8 1 1 100\n");
     Kokkos::finalize();
@@ -96,7 +102,7 @@ int main(int argc, char* argv[]) {
       test_type != 122 && test_type != 200 && test_type != 210 &&
       test_type != 211 && test_type != 212 && test_type != 220 &&
       test_type != 221 && test_type != 222 && test_type != 300 &&
-      test_type != 400 && test_type != 500) {
+      test_type != 400 && test_type != 500 && test_type != 600) {
     printf("Incorrect test_type option\n");
     Kokkos::finalize();
     return -2;
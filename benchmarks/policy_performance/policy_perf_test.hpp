@@ -33,6 +33,16 @@ struct ParallelScanFunctor {
   }
 };
 
+// Length of the TeamThreadRange of a team for test_type 600: a power law
+// (Zipf, exponent 1) over the league, with the ranks scattered so that the
+// long teams don't all land in the same static partition.
+KOKKOS_INLINE_FUNCTION
+long power_law_length(int league_rank, int team_range, int thread_range) {
+  const unsigned long r =
+      (static_cast<unsigned long>(league_rank) * 2654435761ul) % team_range;
+  return static_cast<long>(thread_range) * team_range / (r + 1);
+}
+
 template <class ScheduleType, class IndexType, class ViewType1, class ViewType2,
           class ViewType3>
 void test_policy(int team_range, int thread_range, int vector_range,
@@ -402,6 +412,34 @@ void test_policy(int team_range, int thread_range, int vector_range,
       // 0.5*(team_size*team_range)*(team_size*team_range-1);
     }
 
+    // parallel_reduce TeamPolicy with a power law distribution of the
+    // TeamThreadRange lengths, to compare the Static and Dynamic schedules
+    if (test_type == 600) {
+      Kokkos::parallel_reduce(
+          "600 outer reduce", t_policy(team_range, team_size),
+          KOKKOS_LAMBDA(const t_team& team, double& lval) {
+            const long length = power_law_length(team.league_rank(),
+                                                 team_range, thread_range);
+            double team_result = 0.0;
+            for (int tr = 0; tr < thread_repeat; tr++) {
+              double thread_result = 0.0;
+              Kokkos::parallel_reduce(
+                  Kokkos::TeamThreadRange(team, length),
+                  [&](const long t, double& tval) { tval += t % 2; },
+                  thread_result);
+              team_result += thread_result;
+            }
+            Kokkos::single(Kokkos::PerTeam(team),
+                           [&]() { lval += team_result; });
+          },
+          result);
+      result_expect = 0.0;
+      for (int lr = 0; lr < team_range; ++lr)
+        result_expect += thread_repeat *
+                         (power_law_length(lr, team_range, thread_range) / 2);
+      // sum over the teams of the number of odd t in [0, length)
+    }
+
   }  // end outer for loop
 
   time = timer.seconds();
@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \brief file random.cpp
+
+    Bandwidth of bulk random number generation: fill_random and
+    fill_random_normal with the XorShift64 pool and the Philox counter-based
+    generator, for double, float and half_t.
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define HLINE "-------------------------------------------------------------\n"
+
+using Clock    = std::chrono::steady_clock;
+using Duration = std::chrono::duration<double>;
+
+using ExecSpace = Kokkos::DefaultExecutionSpace;
+using Pool64    = Kokkos::Random_XorShift64_Pool<ExecSpace>;
+using Philox    = Kokkos::Random_Philox4x32<ExecSpace>;
+
+enum class Distribution { uniform, normal };
+
+template <class Scalar, class Generator>
+void run(const char* name, Distribution distribution, Generator gen,
+         const int64_t size, const int repeats) {
+  Kokkos::View<Scalar*> a("a", size);
+  ExecSpace exec;
+
+  // first call outside the timing to fault in the pages
+  double best = 1.0e30;
+  for (int k = 0; k <= repeats; ++k) {
+    auto start = Clock::now();
+    if (distribution == Distribution::uniform)
+      Kokkos::fill_random(exec, a, gen, Scalar(0), Scalar(1));
+    else
+      Kokkos::fill_random_normal(exec, a, gen, Scalar(0), Scalar(1));
+    exec.fence();
+    const double time = Duration(Clock::now() - start).count();
+    if (k > 0 && time < best) best = time;
+  }
+
+  printf("%-32s %-8s %12.4f GB/s %12.4f Gnum/s\n", name,
+         distribution == Distribution::uniform ? "uniform" : "normal",
+         1.0e-9 * size * sizeof(Scalar) / best, 1.0e-9 * size / best);
+}
+
+template <class Scalar>
+void run_all(const char* scalar_name, const int64_t size, const int repeats) {
+  char name[64];
+  for (auto distribution : {Distribution::uniform, Distribution::normal}) {
+    snprintf(name, sizeof(name), "%s XorShift64_Pool", scalar_name);
+    run<Scalar>(name, distribution, Pool64(20240117), size, repeats);
+    snprintf(name, sizeof(name), "%s Philox4x32", scalar_name);
+    run<Scalar>(name, distribution, Philox(20240117), size, repeats);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  printf(HLINE);
+  printf("Kokkos Random Number Generation Benchmark\n");
+  printf(HLINE);
+
+  Kokkos::initialize(argc, argv);
+
+  int64_t size = 33554432;
+  int repeats  = 10;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--size") == 0) {
+      size = std::atoll(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--repeats") == 0) {
+      repeats = std::atoi(argv[i + 1]);
+      ++i;
+    }
+  }
+
+  printf("Reports fastest timing per kernel\n");
+  printf("- Elements:      %15" PRId64 "\n", size);
+  printf("- Repeats:       %15d\n", repeats);
+  printf(HLINE);
+
+  run_all<double>("double", size, repeats);
+  run_all<float>("float", size, repeats);
+  run_all<Kokkos::Experimental::half_t>("half_t", size, repeats);
+
+  printf(HLINE);
+
+  Kokkos::finalize();
+  return 0;
+}
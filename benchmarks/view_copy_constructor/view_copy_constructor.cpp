@@ -18,6 +18,7 @@
 // and destructor overheads in Kokkos View objects
 // Please see the lines marked by "NOTE".
 
+#include <algorithm>
 #include <limits>
 #include <cstdio>
 #include <cstdlib>
@@ -25,6 +26,8 @@
 #include <sys/time.h>
 #include <Kokkos_Core.hpp>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 // NVIEWS is the number of Kokkos View objects in our ViewCollection object
 // We have chosen a large value of 40 to make it easier to see performance
@@ -258,6 +261,46 @@ void test_view_collection_serial(int N, int num_iter, bool execute_kernel) {
   }
 }
 
+// Copies of a single View made concurrently by several host threads.  With
+// borrow == false every copy updates the shared reference count; with
+// borrow == true the copies are made from a ScopedViewBorrow handle and do
+// not touch it.
+void test_view_copy_threads(int num_threads, int num_iter, bool borrow) {
+  Kokkos::View<double*> view("view", 1);
+  Kokkos::Experimental::ScopedViewBorrow borrowed(view);
+  Kokkos::View<double*> const& source = borrow ? borrowed.view() : view;
+
+  std::vector<std::thread> threads;
+  std::vector<long> counts(num_threads, 0);
+
+  Kokkos::Timer timer;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t] {
+      long count = 0;
+      for (int i = t; i < num_iter; i += num_threads) {
+        // NOTE: The following line exposes the reference counting overhead
+        Kokkos::View<double*> tmp = source;
+        count += tmp.extent(0);
+      }
+      counts[t] = count;
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  double time = timer.seconds();
+
+  long total = 0;
+  for (long count : counts) total += count;
+
+  std::cout << (borrow ? "Borrowed " : "") << "Threads Time = " << time
+            << " seconds" << std::endl;
+  if (total == num_iter) {
+    std::cout << num_threads << " threads run:" << std::endl;
+    std::cout << "SUCCESS" << std::endl;
+  } else {
+    std::cout << "FAILURE" << std::endl;
+  }
+}
+
 int main(int argc, char* argv[]) {
   // The benchmark is only testing reference counting for views on host.
 #if defined(KOKKOS_ENABLE_OPENMP) || defined(KOKKOS_ENABLE_SERIAL) || \
@@ -265,6 +308,7 @@ int main(int argc, char* argv[]) {
   int N               = 1;
   int num_iter        = 1 << 27;
   bool execute_kernel = false;
+  int num_threads     = std::max(1u, std::thread::hardware_concurrency());
 
   for (int i = 0; i < argc; i++) {
     if ((strcmp(argv[i], "-N") == 0)) {
@@ -281,11 +325,18 @@ int main(int argc, char* argv[]) {
       }
     } else if (strcmp(argv[i], "-k") == 0) {
       execute_kernel = true;
+    } else if (strcmp(argv[i], "-t") == 0) {
+      num_threads = atoi(argv[++i]);
+      if (num_threads < 1) {
+        std::cout << "Number of threads must be >= 1" << std::endl;
+        exit(1);
+      }
     } else if ((strcmp(argv[i], "-h") == 0)) {
       printf("  Options:\n");
       printf("  -N <int>: Array extent\n");
       printf("  -i <int>: Number of iterations\n");
       printf("  -k:       Execute the summation kernel\n");
+      printf("  -t <int>: Number of threads copying a single View\n");
       printf("  -h:       Print this message\n\n");
       exit(1);
     }
@@ -303,6 +354,10 @@ int main(int argc, char* argv[]) {
   // Test outside Kokkos kernel.
   test_view_collection_serial(N, num_iter, execute_kernel);
 
+  // Test concurrent copies from several host threads.
+  test_view_copy_threads(num_threads, num_iter, false);
+  test_view_copy_threads(num_threads, num_iter, true);
+
   Kokkos::finalize();
 #endif
 
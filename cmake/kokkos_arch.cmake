@@ -714,6 +714,34 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL Clang AND WIN32)
   compiler_specific_options(Clang -mcx16)
 endif()
 
+# Whether host atomics on 16-byte types use a native compare-and-swap or the
+# lock array is decided here, with the final compile options, so that every
+# translation unit makes the same choice for the same address.  Device
+# backends have no matching 16-byte path.
+if(NOT (KOKKOS_ENABLE_CUDA OR KOKKOS_ENABLE_HIP OR KOKKOS_ENABLE_SYCL OR KOKKOS_ENABLE_OPENACC
+        OR KOKKOS_ENABLE_OPENMPTARGET)
+)
+  set(CMAKE_REQUIRED_QUIET ON)
+  string(REPLACE ";" " " CMAKE_REQUIRED_FLAGS "${KOKKOS_COMPILE_OPTIONS}")
+  include(CheckCXXSourceCompiles)
+  unset(KOKKOS_IMPL_HAVE_16BYTE_COMPARE_AND_SWAP CACHE)
+  check_cxx_source_compiles(
+    "
+    #ifndef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+    #error no native 16-byte compare-and-swap
+    #endif
+    __extension__ typedef unsigned __int128 uint128;
+    int main() {
+      uint128 x = 0;
+      return int(__sync_val_compare_and_swap(&x, uint128(0), uint128(1)));
+    }
+    "
+    KOKKOS_IMPL_HAVE_16BYTE_COMPARE_AND_SWAP
+  )
+  unset(CMAKE_REQUIRED_QUIET)
+  unset(CMAKE_REQUIRED_FLAGS)
+endif()
+
 # MSVC ABI has many deprecation warnings, so ignore them
 if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC" OR "x${CMAKE_CXX_SIMULATE_ID}" STREQUAL "xMSVC")
   compiler_specific_defs(Clang _CRT_SECURE_NO_WARNINGS)
@@ -104,6 +104,12 @@ mark_as_advanced(Kokkos_ENABLE_MDSPAN_EXTERNAL)
 mark_as_advanced(Kokkos_ENABLE_IMPL_SKIP_COMPILER_MDSPAN)
 
 kokkos_enable_option(COMPLEX_ALIGN ON "Whether to align Kokkos::complex to 2*alignof(RealType)")
+kokkos_enable_option(TOOLS_TIMER ON "Whether to build the built-in kernel timer tool")
+kokkos_enable_option(
+  IMPL_GRAPH_CAPTURE OFF
+  "Whether parallel dispatches can be captured into a Kokkos::Graph - instantiates every kernel a second time"
+)
+mark_as_advanced(Kokkos_ENABLE_IMPL_GRAPH_CAPTURE)
 
 if(KOKKOS_ENABLE_TESTS)
   set(HEADER_SELF_CONTAINMENT_TESTS_DEFAULT ON)
@@ -0,0 +1,281 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_AppendBuffer.hpp
+/// \brief Append-only container that kernels can push_back into concurrently.
+
+#ifndef KOKKOS_APPEND_BUFFER_HPP
+#define KOKKOS_APPEND_BUFFER_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_APPENDBUFFER
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_DynamicView.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class AppendBuffer
+/// \brief Append-only array that threads can emplace_back into concurrently.
+///
+/// Storage is a DynamicView: a table of fixed size chunks.  Instead of
+/// contending on a single atomic counter for every element, each thread owns
+/// a slot (typically obtained from a UniqueToken) and a slot takes a whole
+/// chunk at a time with one atomic increment.  Elements are then appended to
+/// the slot's chunk without any further synchronization.  Within a chunk the
+/// elements are contiguous from index 0; a chunk abandoned before it is full
+/// leaves a gap at its tail which compact() squeezes out.
+///
+/// Device memory cannot be allocated from inside a kernel, so the chunk table
+/// only grows from the host through reserve(), between kernels, and without
+/// copying the chunks that are already filled.  An append that runs out of
+/// reserved chunks fails and sets the overflow flag; the caller then reserves
+/// more, resets the flag and re-runs the failed work, as with
+/// UnorderedMap::failed_insert().
+///
+/// The order of the elements is unspecified.
+template <typename ValueType,
+          typename Device = Kokkos::DefaultExecutionSpace::device_type>
+class AppendBuffer {
+ public:
+  using value_type      = ValueType;
+  using device_type     = typename Device::device_type;
+  using execution_space = typename device_type::execution_space;
+  using memory_space    = typename device_type::memory_space;
+  using size_type       = size_t;
+
+  using storage_type = DynamicView<value_type*, device_type>;
+  using view_type    = View<value_type*, device_type>;
+
+  static constexpr size_type invalid_index = ~size_type(0);
+
+ private:
+  enum {
+    next_chunk_idx = 0,  // chunks handed out to slots so far
+    num_chunks_idx = 1,  // chunks allocated in m_data
+    overflow_idx   = 2,  // nonzero once an append ran out of chunks
+    state_size     = 3
+  };
+
+  static constexpr unsigned invalid_chunk = ~0u;
+
+  storage_type m_data;
+  View<unsigned*, device_type> m_chunk_fill;
+  View<unsigned*, device_type> m_slot_chunk;
+  View<size_type[state_size], device_type> m_state;
+  unsigned m_chunk_shift = 0;
+
+ public:
+  AppendBuffer() = default;
+
+  /// \brief Create an empty buffer.
+  ///
+  /// \param label        Label of the allocations.
+  /// \param chunk_size   Number of elements per chunk, rounded up to a power
+  ///                     of two.  A slot claims this many elements at once.
+  /// \param max_size     Upper bound on the capacity reserve() can reach.
+  /// \param num_slots    Number of distinct slot ids the appending threads
+  ///                     use, e.g. the size() of their UniqueToken.
+  AppendBuffer(const std::string& label, unsigned chunk_size,
+               size_type max_size, int num_slots)
+      : m_data(label, chunk_size, max_size),
+        m_chunk_fill(label + " chunk fill", m_data.chunk_max()),
+        m_slot_chunk(view_alloc(WithoutInitializing, label + " slot chunk"),
+                     num_slots),
+        m_state(label + " state") {
+    while ((size_type(1) << m_chunk_shift) < m_data.chunk_size())
+      ++m_chunk_shift;
+    deep_copy(m_slot_chunk, invalid_chunk);
+  }
+
+  /// \brief As above, with one slot per id of a global UniqueToken.
+  AppendBuffer(const std::string& label, unsigned chunk_size,
+               size_type max_size)
+      : AppendBuffer(
+            label, chunk_size, max_size,
+            UniqueToken<execution_space, UniqueTokenScope::Global>().size()) {}
+
+  //--------------------------------------------------------------------------
+  // Host interface
+
+  /// \brief Make room for at least \c n elements in total.
+  ///
+  /// Only adds chunks; elements already appended stay where they are, and
+  /// the new chunks are free for the appends that failed.  Must not be
+  /// called while a kernel is appending.
+  void reserve(size_type n) {
+    if (n <= capacity()) return;
+    size_type state[state_size];
+    View<size_type[state_size], HostSpace> h_state(state);
+    deep_copy(h_state, m_state);
+    m_data.resize_serial(n);
+    // Failed appends kept counting past the allocated chunks.
+    if (state[next_chunk_idx] > state[num_chunks_idx])
+      state[next_chunk_idx] = state[num_chunks_idx];
+    state[num_chunks_idx] = m_data.allocation_extent() >> m_chunk_shift;
+    deep_copy(m_state, h_state);
+  }
+
+  /// \brief Number of elements the reserved chunks can hold.
+  ///
+  /// Gaps left at the tail of partially filled chunks count against it, so
+  /// leave about one chunk per slot of headroom.
+  size_type capacity() const {
+    return m_data.is_allocated() ? m_data.allocation_extent() : 0;
+  }
+
+  size_type chunk_size() const { return m_data.chunk_size(); }
+
+  int num_slots() const { return m_slot_chunk.extent(0); }
+
+  /// \brief Whether an append failed since the last clear() or
+  ///        reset_overflow().
+  bool overflowed() const {
+    size_type flag;
+    deep_copy(flag, Kokkos::subview(m_state, int(overflow_idx)));
+    return flag != 0;
+  }
+
+  /// \brief Clear the overflow flag, keeping the elements.
+  void reset_overflow() {
+    deep_copy(Kokkos::subview(m_state, int(overflow_idx)), size_type(0));
+  }
+
+  /// \brief Number of elements appended since the last clear().
+  size_type size() const {
+    size_type count = 0;
+    parallel_reduce(
+        "Kokkos::AppendBuffer::size",
+        RangePolicy<execution_space>(0, used_chunks()),
+        KOKKOS_CLASS_LAMBDA(size_type c, size_type & sum) {
+          sum += m_chunk_fill(c);
+        },
+        count);
+    return count;
+  }
+
+  /// \brief Remove all elements, keeping the reserved chunks.
+  void clear() {
+    deep_copy(m_chunk_fill, 0u);
+    deep_copy(m_slot_chunk, invalid_chunk);
+    deep_copy(Kokkos::subview(m_state, int(next_chunk_idx)), size_type(0));
+    deep_copy(Kokkos::subview(m_state, int(overflow_idx)), size_type(0));
+  }
+
+  /// \brief Copy the elements into a contiguous View.
+  ///
+  /// A scan over the per-chunk fill counts gives each chunk its offset, then
+  /// every element is copied once.
+  view_type compact(const std::string& label = "") const {
+    const size_type n_chunks = used_chunks();
+    View<size_type*, device_type> offsets(
+        view_alloc(WithoutInitializing, "Kokkos::AppendBuffer::offsets"),
+        n_chunks);
+    size_type total = 0;
+    parallel_scan(
+        "Kokkos::AppendBuffer::compact_scan",
+        RangePolicy<execution_space>(0, n_chunks),
+        KOKKOS_CLASS_LAMBDA(size_type c, size_type & update, bool final) {
+          if (final) offsets(c) = update;
+          update += m_chunk_fill(c);
+        },
+        total);
+
+    view_type result(view_alloc(WithoutInitializing, label), total);
+    const unsigned shift = m_chunk_shift;
+    const size_type mask = (size_type(1) << shift) - 1;
+    parallel_for(
+        "Kokkos::AppendBuffer::compact_copy",
+        RangePolicy<execution_space>(0, n_chunks << shift),
+        KOKKOS_CLASS_LAMBDA(size_type i) {
+          const size_type c = i >> shift;
+          const size_type j = i & mask;
+          if (j < m_chunk_fill(c)) result(offsets(c) + j) = m_data(i);
+        });
+    return result;
+  }
+
+  //--------------------------------------------------------------------------
+  // Device interface
+
+  /// \brief Append a value constructed from \c args on behalf of \c slot.
+  ///
+  /// \c slot must be in [0, num_slots()) and used by one thread at a time.
+  /// \return The index of the new element, or invalid_index when the reserved
+  ///         capacity is exhausted.
+  template <typename... Args>
+  KOKKOS_INLINE_FUNCTION size_type emplace_back(int slot,
+                                                Args&&... args) const {
+    const size_type i = reserve_back(slot, 1);
+    if (i != invalid_index) m_data(i) = value_type((Args&&)args...);
+    return i;
+  }
+
+  /// \brief Reserve \c n contiguous elements on behalf of \c slot.
+  ///
+  /// Lets a team append a block: one member reserves, broadcasts the first
+  /// index and the team fills [first, first + n) in parallel.  \c n must not
+  /// exceed chunk_size().
+  /// \return The index of the first element, or invalid_index when the
+  ///         reserved capacity is exhausted.
+  KOKKOS_INLINE_FUNCTION
+  size_type reserve_back(int slot, unsigned n) const {
+    KOKKOS_EXPECTS(n <= (1u << m_chunk_shift));
+    unsigned& chunk = m_slot_chunk(slot);
+    if (chunk == invalid_chunk ||
+        m_chunk_fill(chunk) + n > (1u << m_chunk_shift)) {
+      const size_type next =
+          atomic_fetch_add(&m_state(int(next_chunk_idx)), size_type(1));
+      if (next >= m_state(int(num_chunks_idx))) {
+        m_state(int(overflow_idx)) = 1;
+        chunk                      = invalid_chunk;
+        return invalid_index;
+      }
+      chunk = next;
+    }
+    const unsigned pos = m_chunk_fill(chunk);
+    m_chunk_fill(chunk) = pos + n;
+    return (size_type(chunk) << m_chunk_shift) + pos;
+  }
+
+  /// \brief Element \c i, for indices returned by emplace_back/reserve_back.
+  KOKKOS_INLINE_FUNCTION
+  value_type& operator()(size_type i) const { return m_data(i); }
+
+ private:
+  // Chunks handed out so far; the counter keeps counting past the allocated
+  // ones when appends overflow.
+  size_type used_chunks() const {
+    size_type state[state_size];
+    deep_copy(View<size_type[state_size], HostSpace>(state), m_state);
+    return state[next_chunk_idx] < state[num_chunks_idx]
+               ? state[next_chunk_idx]
+               : state[num_chunks_idx];
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_APPENDBUFFER
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_APPENDBUFFER
+#endif
+#endif  // KOKKOS_APPEND_BUFFER_HPP
@@ -28,27 +28,39 @@
 
 namespace Kokkos {
 
-template <typename Device = Kokkos::DefaultExecutionSpace>
+template <typename Device = Kokkos::DefaultExecutionSpace,
+          typename SizeType = unsigned int>
 class Bitset;
 
-template <typename Device = Kokkos::DefaultExecutionSpace>
+template <typename Device = Kokkos::DefaultExecutionSpace,
+          typename SizeType = unsigned int>
 class ConstBitset;
 
-template <typename DstDevice, typename SrcDevice>
-void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src);
+template <typename DstDevice, typename SrcDevice, typename SizeType>
+void deep_copy(Bitset<DstDevice, SizeType>& dst,
+               Bitset<SrcDevice, SizeType> const& src);
 
-template <typename DstDevice, typename SrcDevice>
-void deep_copy(Bitset<DstDevice>& dst, ConstBitset<SrcDevice> const& src);
+template <typename DstDevice, typename SrcDevice, typename SizeType>
+void deep_copy(Bitset<DstDevice, SizeType>& dst,
+               ConstBitset<SrcDevice, SizeType> const& src);
 
-template <typename DstDevice, typename SrcDevice>
-void deep_copy(ConstBitset<DstDevice>& dst, ConstBitset<SrcDevice> const& src);
+template <typename DstDevice, typename SrcDevice, typename SizeType>
+void deep_copy(ConstBitset<DstDevice, SizeType>& dst,
+               ConstBitset<SrcDevice, SizeType> const& src);
 
 /// A thread safe view to a bitset
-template <typename Device>
+///
+/// \tparam SizeType Type of bit indices and counts.  Use uint64_t for sets
+///   of 2^32 bits or more; the bits are stored in 32-bit blocks either way.
+template <typename Device, typename SizeType>
 class Bitset {
+  static_assert(std::is_unsigned_v<SizeType> && sizeof(SizeType) >= 4,
+                "Kokkos::Bitset: SizeType must be an unsigned integer type of "
+                "at least 32 bits");
+
  public:
   using execution_space = typename Device::execution_space;
-  using size_type       = unsigned int;
+  using size_type       = SizeType;
 
   static constexpr unsigned BIT_SCAN_REVERSE   = 1u;
   static constexpr unsigned MOVE_HINT_BACKWARD = 2u;
@@ -77,10 +89,10 @@ class Bitset {
   Bitset() = default;
 
   /// arg_size := number of bit in set
-  Bitset(unsigned arg_size) : Bitset(Kokkos::view_alloc(), arg_size) {}
+  Bitset(size_type arg_size) : Bitset(Kokkos::view_alloc(), arg_size) {}
 
   template <class... P>
-  Bitset(const Impl::ViewCtorProp<P...>& arg_prop, unsigned arg_size)
+  Bitset(const Impl::ViewCtorProp<P...>& arg_prop, size_type arg_size)
       : m_size(arg_size), m_last_block_mask(0u) {
     //! Ensure that allocation properties are consistent.
     using alloc_prop_t = std::decay_t<decltype(arg_prop)>;
@@ -102,16 +114,16 @@ class Bitset {
   }
 
   KOKKOS_DEFAULTED_FUNCTION
-  Bitset(const Bitset<Device>&) = default;
+  Bitset(const Bitset&) = default;
 
   KOKKOS_DEFAULTED_FUNCTION
-  Bitset& operator=(const Bitset<Device>&) = default;
+  Bitset& operator=(const Bitset&) = default;
 
   KOKKOS_DEFAULTED_FUNCTION
-  Bitset(Bitset<Device>&&) = default;
+  Bitset(Bitset&&) = default;
 
   KOKKOS_DEFAULTED_FUNCTION
-  Bitset& operator=(Bitset<Device>&&) = default;
+  Bitset& operator=(Bitset&&) = default;
 
   KOKKOS_DEFAULTED_FUNCTION
   ~Bitset() = default;
@@ -119,12 +131,12 @@ class Bitset {
   /// number of bits in the set
   /// can be call from the host or the device
   KOKKOS_FORCEINLINE_FUNCTION
-  unsigned size() const { return m_size; }
+  size_type size() const { return m_size; }
 
   /// number of bits which are set to 1
   /// can only be called from the host
-  unsigned count() const {
-    Impl::BitsetCount<Bitset<Device>> f(*this);
+  size_type count() const {
+    Impl::BitsetCount<Bitset> f(*this);
     return f.apply();
   }
 
@@ -155,7 +167,7 @@ class Bitset {
   /// set i'th bit to 1
   /// can only be called from the device
   KOKKOS_FORCEINLINE_FUNCTION
-  bool set(unsigned i) const {
+  bool set(size_type i) const {
     if (i < m_size) {
       unsigned* block_ptr = &m_blocks[i >> block_shift];
       const unsigned mask = 1u << static_cast<int>(i & block_mask);
@@ -168,7 +180,7 @@ class Bitset {
   /// set i'th bit to 0
   /// can only be called from the device
   KOKKOS_FORCEINLINE_FUNCTION
-  bool reset(unsigned i) const {
+  bool reset(size_type i) const {
     if (i < m_size) {
       unsigned* block_ptr = &m_blocks[i >> block_shift];
       const unsigned mask = 1u << static_cast<int>(i & block_mask);
@@ -181,7 +193,7 @@ class Bitset {
   /// return true if the i'th bit set to 1
   /// can only be called from the device
   KOKKOS_FORCEINLINE_FUNCTION
-  bool test(unsigned i) const {
+  bool test(size_type i) const {
     if (i < m_size) {
 #ifdef KOKKOS_ENABLE_SYCL
       const unsigned block = Kokkos::atomic_load(&m_blocks[i >> block_shift]);
@@ -198,17 +210,17 @@ class Bitset {
   /// returns the max number of times those functions should be call
   /// when searching for an available bit
   KOKKOS_FORCEINLINE_FUNCTION
-  unsigned max_hint() const { return m_blocks.extent(0); }
+  size_type max_hint() const { return m_blocks.extent(0); }
 
   /// find a bit set to 1 near the hint
-  /// returns a pair< bool, unsigned> where if result.first is true then
+  /// returns a pair< bool, size_type> where if result.first is true then
   /// result.second is the bit found and if result.first is false the
   /// result.second is a new hint
   KOKKOS_INLINE_FUNCTION
-  Kokkos::pair<bool, unsigned> find_any_set_near(
-      unsigned hint,
+  Kokkos::pair<bool, size_type> find_any_set_near(
+      size_type hint,
       unsigned scan_direction = BIT_SCAN_FORWARD_MOVE_HINT_FORWARD) const {
-    const unsigned block_idx =
+    const size_type block_idx =
         (hint >> block_shift) < m_blocks.extent(0) ? (hint >> block_shift) : 0;
     const unsigned offset = hint & block_mask;
 #ifdef KOKKOS_ENABLE_SYCL
@@ -224,14 +236,14 @@ class Bitset {
   }
 
   /// find a bit set to 0 near the hint
-  /// returns a pair< bool, unsigned> where if result.first is true then
+  /// returns a pair< bool, size_type> where if result.first is true then
   /// result.second is the bit found and if result.first is false the
   /// result.second is a new hint
   KOKKOS_INLINE_FUNCTION
-  Kokkos::pair<bool, unsigned> find_any_unset_near(
-      unsigned hint,
+  Kokkos::pair<bool, size_type> find_any_unset_near(
+      size_type hint,
       unsigned scan_direction = BIT_SCAN_FORWARD_MOVE_HINT_FORWARD) const {
-    const unsigned block_idx = hint >> block_shift;
+    const size_type block_idx = hint >> block_shift;
     const unsigned offset    = hint & block_mask;
 #ifdef KOKKOS_ENABLE_SYCL
     unsigned block = Kokkos::atomic_load(&m_blocks[block_idx]);
@@ -251,10 +263,10 @@ class Bitset {
 
  private:
   KOKKOS_FORCEINLINE_FUNCTION
-  Kokkos::pair<bool, unsigned> find_any_helper(unsigned block_idx,
-                                               unsigned offset, unsigned block,
-                                               unsigned scan_direction) const {
-    Kokkos::pair<bool, unsigned> result(block > 0u, 0);
+  Kokkos::pair<bool, size_type> find_any_helper(size_type block_idx,
+                                                unsigned offset, unsigned block,
+                                                unsigned scan_direction) const {
+    Kokkos::pair<bool, size_type> result(block > 0u, 0);
 
     if (!result.first) {
       result.second = update_hint(block_idx, offset, scan_direction);
@@ -266,8 +278,8 @@ class Bitset {
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  unsigned scan_block(unsigned block_start, int offset, unsigned block,
-                      unsigned scan_direction) const {
+  size_type scan_block(size_type block_start, int offset, unsigned block,
+                       unsigned scan_direction) const {
     offset = !(scan_direction & BIT_SCAN_REVERSE)
                  ? offset
                  : (offset + block_mask) & block_mask;
@@ -281,47 +293,49 @@ class Bitset {
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  unsigned update_hint(long long block_idx, unsigned offset,
-                       unsigned scan_direction) const {
+  size_type update_hint(long long block_idx, unsigned offset,
+                        unsigned scan_direction) const {
     block_idx += scan_direction & MOVE_HINT_BACKWARD ? -1 : 1;
     block_idx = block_idx >= 0 ? block_idx : m_blocks.extent(0) - 1;
     block_idx =
         block_idx < static_cast<long long>(m_blocks.extent(0)) ? block_idx : 0;
 
-    return static_cast<unsigned>(block_idx) * block_size + offset;
+    return static_cast<size_type>(block_idx) * block_size + offset;
   }
 
  private:
-  unsigned m_size            = 0;
+  size_type m_size           = 0;
   unsigned m_last_block_mask = 0;
   block_view_type m_blocks;
 
  private:
-  template <typename DDevice>
+  template <typename DDevice, typename SSizeType>
   friend class Bitset;
 
-  template <typename DDevice>
+  template <typename DDevice, typename SSizeType>
   friend class ConstBitset;
 
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
-  template <typename DstDevice, typename SrcDevice>
-  friend void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src);
+  template <typename DstDevice, typename SrcDevice, typename SSizeType>
+  friend void deep_copy(Bitset<DstDevice, SSizeType>& dst,
+                        Bitset<SrcDevice, SSizeType> const& src);
 
-  template <typename DstDevice, typename SrcDevice>
-  friend void deep_copy(Bitset<DstDevice>& dst,
-                        ConstBitset<SrcDevice> const& src);
+  template <typename DstDevice, typename SrcDevice, typename SSizeType>
+  friend void deep_copy(Bitset<DstDevice, SSizeType>& dst,
+                        ConstBitset<SrcDevice, SSizeType> const& src);
 };
 
 /// a thread-safe view to a const bitset
 /// i.e. can only test bits
-template <typename Device>
+template <typename Device, typename SizeType>
 class ConstBitset {
  public:
   using execution_space = typename Device::execution_space;
-  using size_type       = unsigned int;
-  using block_view_type = typename Bitset<Device>::block_view_type::const_type;
+  using size_type       = SizeType;
+  using block_view_type =
+      typename Bitset<Device, SizeType>::block_view_type::const_type;
 
  private:
   enum { block_size = static_cast<unsigned>(sizeof(unsigned) * CHAR_BIT) };
@@ -333,15 +347,15 @@ class ConstBitset {
   ConstBitset() : m_size(0) {}
 
   KOKKOS_FUNCTION
-  ConstBitset(Bitset<Device> const& rhs)
+  ConstBitset(Bitset<Device, SizeType> const& rhs)
       : m_size(rhs.m_size), m_blocks(rhs.m_blocks) {}
 
   KOKKOS_FUNCTION
-  ConstBitset(ConstBitset<Device> const& rhs)
+  ConstBitset(ConstBitset const& rhs)
       : m_size(rhs.m_size), m_blocks(rhs.m_blocks) {}
 
   KOKKOS_FUNCTION
-  ConstBitset<Device>& operator=(Bitset<Device> const& rhs) {
+  ConstBitset& operator=(Bitset<Device, SizeType> const& rhs) {
     this->m_size   = rhs.m_size;
     this->m_blocks = rhs.m_blocks;
 
@@ -349,7 +363,7 @@ class ConstBitset {
   }
 
   KOKKOS_FUNCTION
-  ConstBitset<Device>& operator=(ConstBitset<Device> const& rhs) {
+  ConstBitset& operator=(ConstBitset const& rhs) {
     this->m_size   = rhs.m_size;
     this->m_blocks = rhs.m_blocks;
 
@@ -357,15 +371,15 @@ class ConstBitset {
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  unsigned size() const { return m_size; }
+  size_type size() const { return m_size; }
 
-  unsigned count() const {
-    Impl::BitsetCount<ConstBitset<Device>> f(*this);
+  size_type count() const {
+    Impl::BitsetCount<ConstBitset> f(*this);
     return f.apply();
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  bool test(unsigned i) const {
+  bool test(size_type i) const {
     if (i < m_size) {
       const unsigned block = m_blocks[i >> block_shift];
       const unsigned mask  = 1u << static_cast<int>(i & block_mask);
@@ -375,27 +389,28 @@ class ConstBitset {
   }
 
  private:
-  unsigned m_size;
+  size_type m_size;
   block_view_type m_blocks;
 
  private:
-  template <typename DDevice>
+  template <typename DDevice, typename SSizeType>
   friend class ConstBitset;
 
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
-  template <typename DstDevice, typename SrcDevice>
-  friend void deep_copy(Bitset<DstDevice>& dst,
-                        ConstBitset<SrcDevice> const& src);
+  template <typename DstDevice, typename SrcDevice, typename SSizeType>
+  friend void deep_copy(Bitset<DstDevice, SSizeType>& dst,
+                        ConstBitset<SrcDevice, SSizeType> const& src);
 
-  template <typename DstDevice, typename SrcDevice>
-  friend void deep_copy(ConstBitset<DstDevice>& dst,
-                        ConstBitset<SrcDevice> const& src);
+  template <typename DstDevice, typename SrcDevice, typename SSizeType>
+  friend void deep_copy(ConstBitset<DstDevice, SSizeType>& dst,
+                        ConstBitset<SrcDevice, SSizeType> const& src);
 };
 
-template <typename DstDevice, typename SrcDevice>
-void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src) {
+template <typename DstDevice, typename SrcDevice, typename SizeType>
+void deep_copy(Bitset<DstDevice, SizeType>& dst,
+               Bitset<SrcDevice, SizeType> const& src) {
   if (dst.size() != src.size()) {
     Kokkos::Impl::throw_runtime_exception(
         "Error: Cannot deep_copy bitsets of different sizes!");
@@ -403,8 +418,9 @@ void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src) {
   Kokkos::deep_copy(dst.m_blocks, src.m_blocks);
 }
 
-template <typename DstDevice, typename SrcDevice>
-void deep_copy(Bitset<DstDevice>& dst, ConstBitset<SrcDevice> const& src) {
+template <typename DstDevice, typename SrcDevice, typename SizeType>
+void deep_copy(Bitset<DstDevice, SizeType>& dst,
+               ConstBitset<SrcDevice, SizeType> const& src) {
   if (dst.size() != src.size()) {
     Kokkos::Impl::throw_runtime_exception(
         "Error: Cannot deep_copy bitsets of different sizes!");
@@ -412,8 +428,9 @@ void deep_copy(Bitset<DstDevice>& dst, ConstBitset<SrcDevice> const& src) {
   Kokkos::deep_copy(dst.m_blocks, src.m_blocks);
 }
 
-template <typename DstDevice, typename SrcDevice>
-void deep_copy(ConstBitset<DstDevice>& dst, ConstBitset<SrcDevice> const& src) {
+template <typename DstDevice, typename SrcDevice, typename SizeType>
+void deep_copy(ConstBitset<DstDevice, SizeType>& dst,
+               ConstBitset<SrcDevice, SizeType> const& src) {
   if (dst.size() != src.size()) {
     Kokkos::Impl::throw_runtime_exception(
         "Error: Cannot deep_copy bitsets of different sizes!");
@@ -85,6 +85,43 @@ inline const Kokkos::Cuda& get_cuda_space(const NonCudaExecSpace&) {
 
 #endif  // KOKKOS_ENABLE_CUDA
 
+// Bookkeeping of DualView::enable_range_tracking(): one bit per block of
+// rows_per_block rows along the first extent.
+
+// Mark the blocks overlapping the rows [rows.first, rows.second), clipped to
+// the extent.
+inline void dualview_mark_row_blocks(uint64_t* bits, size_t rows_per_block,
+                                     size_t extent,
+                                     const Kokkos::pair<size_t, size_t>& rows) {
+  const size_t end = rows.second < extent ? rows.second : extent;
+  if (rows.first >= end) return;
+  for (size_t b = rows.first / rows_per_block; b <= (end - 1) / rows_per_block;
+       ++b)
+    bits[b / 64] |= uint64_t(1) << (b % 64);
+}
+
+// Call f(rows) once for every run of consecutive marked blocks, with the
+// rows of the run clipped to the extent.
+template <class F>
+void dualview_for_each_row_run(const uint64_t* bits, size_t rows_per_block,
+                               size_t extent, const F& f) {
+  auto marked = [bits](size_t b) {
+    return (bits[b / 64] & (uint64_t(1) << (b % 64))) != 0;
+  };
+  const size_t num_blocks = (extent + rows_per_block - 1) / rows_per_block;
+  for (size_t b = 0; b < num_blocks;) {
+    if (!marked(b)) {
+      ++b;
+      continue;
+    }
+    const size_t first = b;
+    while (b < num_blocks && marked(b)) ++b;
+    const size_t last =
+        b * rows_per_block < extent ? b * rows_per_block : extent;
+    f(Kokkos::pair<size_t, size_t>(first * rows_per_block, last));
+  }
+}
+
 }  // namespace Impl
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
@@ -208,6 +245,24 @@ class DualView : public ViewTraits<DataType, Properties...> {
   using t_modified_flags = View<unsigned int[2], LayoutLeft, Kokkos::HostSpace>;
   t_modified_flags modified_flags;
 
+  // Optional tracking of modified rows, see enable_range_tracking().  A few
+  // header words followed by a bitmap with one bit per block of rows along
+  // the first extent.
+  enum : size_t {
+    blocks_rows_idx    = 0,  // rows per block
+    blocks_partial_idx = 1,  // nonzero while only the marked blocks differ
+    blocks_data_idx    = 2,  // h_view.data() the bitmap describes
+    blocks_extent_idx  = 3,  // h_view.extent(0) the bitmap describes
+    blocks_header_size = 4
+  };
+  using t_modified_blocks = View<uint64_t*, LayoutLeft, Kokkos::HostSpace>;
+  t_modified_blocks modified_blocks;
+
+  // Blocks of rows are contiguous in memory and can be copied on their own.
+  static constexpr bool impl_rows_are_contiguous =
+      traits::rank == 1 ||
+      std::is_same_v<typename traits::array_layout, LayoutRight>;
+
  public:
   //@}
 
@@ -304,6 +359,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
   template <typename DT, typename... DP>
   DualView(const DualView<DT, DP...>& src)
       : modified_flags(src.modified_flags),
+        modified_blocks(src.modified_blocks),
         d_view(src.d_view),
         h_view(src.h_view) {}
 
@@ -311,6 +367,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
   template <class DT, class... DP, class Arg0, class... Args>
   DualView(const DualView<DT, DP...>& src, const Arg0& arg0, Args... args)
       : modified_flags(src.modified_flags),
+        modified_blocks(src.modified_blocks),
         d_view(Kokkos::subview(src.d_view, arg0, args...)),
         h_view(Kokkos::subview(src.h_view, arg0, args...)) {}
 
@@ -593,7 +650,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
         }
 #endif
 
-        deep_copy(args..., d_view, h_view);
+        if (!impl_copy_modified_rows(d_view, h_view, args...))
+          deep_copy(args..., d_view, h_view);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_device_sync();
       }
@@ -610,7 +668,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
         }
 #endif
 
-        deep_copy(args..., h_view, d_view);
+        if (!impl_copy_modified_rows(h_view, d_view, args...))
+          deep_copy(args..., h_view, d_view);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_host_sync();
       }
@@ -703,7 +762,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
       }
 #endif
 
-      deep_copy(args..., h_view, d_view);
+      if (!impl_copy_modified_rows(h_view, d_view, args...))
+        deep_copy(args..., h_view, d_view);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_host_sync();
     }
@@ -734,7 +794,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
       }
 #endif
 
-      deep_copy(args..., d_view, h_view);
+      if (!impl_copy_modified_rows(d_view, h_view, args...))
+        deep_copy(args..., d_view, h_view);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_device_sync();
     }
@@ -807,6 +868,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
     }
 
     int dev = get_device_side<Device>();
+    impl_mark_all_rows_modified();
 
     if (dev == 1) {  // if Device is the same as DualView's device type
       // Increment the device's modified count.
@@ -849,6 +911,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
                 nullptr>
   inline void modify_host() {
     if (modified_flags.data() != nullptr) {
+      impl_mark_all_rows_modified();
       modified_flags(0) =
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
@@ -879,6 +942,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
                 nullptr>
   inline void modify_device() {
     if (modified_flags.data() != nullptr) {
+      impl_mark_all_rows_modified();
       modified_flags(1) =
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
@@ -907,8 +971,172 @@ class DualView : public ViewTraits<DataType, Properties...> {
   inline void clear_sync_state() {
     if (modified_flags.data() != nullptr)
       modified_flags(1) = modified_flags(0) = 0;
+    impl_mark_all_rows_modified();
   }
 
+  //@}
+  //! \name Methods for tracking modified ranges of rows.
+  //@{
+
+  /// \brief Track which rows along the first extent get modified.
+  ///
+  /// Rows are grouped into blocks of \c rows_per_block rows (by default about
+  /// a thousandth of extent(0)).  After this call, marking a range of rows as
+  /// modified with modify(rows), modify_host(rows) or modify_device(rows)
+  /// lets the next sync copy only the blocks that overlap those ranges,
+  /// instead of the whole View.  A plain modify() still marks everything.
+  ///
+  /// The tracking state is shared with copies of this DualView made after
+  /// this call.  Tracking needs the rows to be contiguous, i.e. rank one or
+  /// LayoutRight; for other layouts, and when host and device share memory,
+  /// this call has no effect and ranges mark the whole View as modified.
+  void enable_range_tracking(size_t rows_per_block = 0) {
+    if constexpr (impl_rows_are_contiguous &&
+                  !impl_dualview_is_single_device::value) {
+      // Distinct devices can still share one host allocation
+      if (h_view.data() == d_view.data()) return;
+      const size_t n = h_view.extent(0);
+      if (rows_per_block == 0) rows_per_block = (n + 1023) / 1024;
+      if (rows_per_block == 0) rows_per_block = 1;
+      const size_t num_blocks = (n + rows_per_block - 1) / rows_per_block;
+      modified_blocks         = t_modified_blocks(
+          "DualView::modified_blocks",
+          blocks_header_size + (num_blocks + 63) / 64);
+      modified_blocks(blocks_rows_idx) = rows_per_block;
+      modified_blocks(blocks_data_idx) =
+          reinterpret_cast<uintptr_t>(h_view.data());
+      modified_blocks(blocks_extent_idx) = n;
+    } else {
+      (void)rows_per_block;
+    }
+  }
+
+  /// \brief Whether modified ranges of rows are tracked for this View.
+  bool range_tracking_enabled() const {
+    return modified_blocks.data() != nullptr && h_view.span_is_contiguous() &&
+           modified_blocks(blocks_data_idx) ==
+               reinterpret_cast<uintptr_t>(h_view.data()) &&
+           modified_blocks(blocks_extent_idx) == h_view.extent(0);
+  }
+
+  /// \brief Mark the rows [rows.first, rows.second) as modified on \c Device.
+  ///
+  /// Like modify<Device>(), but if range tracking is enabled and nothing
+  /// else is pending on the other side, the next sync only copies the
+  /// blocks overlapping the ranges marked since the last sync.
+  template <class Device>
+  void modify(const Kokkos::pair<size_t, size_t>& rows) {
+    if constexpr (!impl_dualview_is_single_device::value) {
+      const int dev = get_device_side<Device>();
+      if (dev == 1) modify_device(rows);
+      if (dev == 0) modify_host(rows);
+    } else {
+      (void)rows;
+    }
+  }
+
+  /// \brief Mark the rows [rows.first, rows.second) as modified on the host.
+  void modify_host(const Kokkos::pair<size_t, size_t>& rows) {
+    if constexpr (!impl_dualview_is_single_device::value) {
+      if (modified_flags.data() == nullptr) {
+        modified_flags = t_modified_flags("DualView::modified_flags");
+      }
+      const bool was_clean = !modified_flags(0) && !modified_flags(1);
+      const bool extends   = impl_partially_modified() &&
+                           modified_flags(0) > modified_flags(1);
+      modify_host();
+      impl_mark_rows_modified(rows, was_clean, extends);
+    } else {
+      (void)rows;
+    }
+  }
+
+  /// \brief Mark the rows [rows.first, rows.second) as modified on the
+  /// device.
+  void modify_device(const Kokkos::pair<size_t, size_t>& rows) {
+    if constexpr (!impl_dualview_is_single_device::value) {
+      if (modified_flags.data() == nullptr) {
+        modified_flags = t_modified_flags("DualView::modified_flags");
+      }
+      const bool was_clean = !modified_flags(0) && !modified_flags(1);
+      const bool extends   = impl_partially_modified() &&
+                           modified_flags(1) > modified_flags(0);
+      modify_device();
+      impl_mark_rows_modified(rows, was_clean, extends);
+    } else {
+      (void)rows;
+    }
+  }
+
+ private:
+  bool impl_partially_modified() const {
+    return range_tracking_enabled() && modified_blocks(blocks_partial_idx);
+  }
+
+  void impl_mark_all_rows_modified() {
+    if (modified_blocks.data() != nullptr)
+      modified_blocks(blocks_partial_idx) = 0;
+  }
+
+  // Only a run of range modifications on one side, starting from a synced
+  // state, keeps the modification partial.
+  void impl_mark_rows_modified(const Kokkos::pair<size_t, size_t>& rows,
+                               bool was_clean, bool extends) {
+    if (!range_tracking_enabled() || !(was_clean || extends)) return;
+    uint64_t* const bits = modified_blocks.data() + blocks_header_size;
+    if (was_clean) {
+      const size_t num_words = modified_blocks.extent(0) - blocks_header_size;
+      for (size_t w = 0; w < num_words; ++w) bits[w] = 0;
+    }
+    Impl::dualview_mark_row_blocks(bits, modified_blocks(blocks_rows_idx),
+                                   h_view.extent(0), rows);
+    modified_blocks(blocks_partial_idx) = 1;
+  }
+
+  template <class ViewType, size_t... Is>
+  static auto impl_rows_subview(const ViewType& v,
+                                const Kokkos::pair<size_t, size_t>& rows,
+                                std::index_sequence<Is...>) {
+    return Kokkos::subview(v, rows, ((void)Is, Kokkos::ALL)...);
+  }
+
+  // Copy the modified blocks of rows from src to dst if only part of the
+  // View is modified.  Each run of consecutive modified blocks becomes one
+  // asynchronous deep_copy on the given execution space instance, or on a
+  // default device instance that is fenced once at the end.
+  template <class Dst, class Src, class... Args>
+  bool impl_copy_modified_rows(const Dst& dst, const Src& src,
+                               Args const&... args) {
+    if constexpr (impl_rows_are_contiguous &&
+                  !impl_dualview_is_single_device::value) {
+      if (!impl_partially_modified()) return false;
+      modified_blocks(blocks_partial_idx) = 0;
+
+      auto copy_rows = [&](const Kokkos::pair<size_t, size_t>& rows) {
+        using trailing = std::make_index_sequence<traits::rank - 1>;
+        auto dst_rows  = impl_rows_subview(dst, rows, trailing{});
+        auto src_rows  = impl_rows_subview(src, rows, trailing{});
+        if constexpr (sizeof...(Args) == 0)
+          deep_copy(typename t_dev::execution_space(), dst_rows, src_rows);
+        else
+          deep_copy(args..., dst_rows, src_rows);
+      };
+
+      Impl::dualview_for_each_row_run(
+          modified_blocks.data() + blocks_header_size,
+          modified_blocks(blocks_rows_idx), h_view.extent(0), copy_rows);
+      if constexpr (sizeof...(Args) == 0)
+        typename t_dev::execution_space().fence(
+            "Kokkos::DualView<>::sync: fence after copying modified rows");
+      return true;
+    } else {
+      (void)dst, (void)src, ((void)args, ...);
+      return false;
+    }
+  }
+
+ public:
+
   //@}
   //! \name Methods for reallocating or resizing the View objects.
   //@{
@@ -972,6 +1200,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       modified_flags = t_modified_flags("DualView::modified_flags");
     } else
       modified_flags(1) = modified_flags(0) = 0;
+    impl_rebind_range_tracking();
   }
 
   template <class... ViewCtorArgs>
@@ -1053,6 +1282,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         /* Mark Device copy as modified */
         ++modified_flags(1);
+        impl_rebind_range_tracking();
       }
     };
 
@@ -1067,6 +1297,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         /* Mark Host copy as modified */
         ++modified_flags(0);
+        impl_rebind_range_tracking();
       }
     };
 
@@ -1083,6 +1314,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         ::Kokkos::resize(arg_prop, h_view, n0, n1, n2, n3, n4, n5, n6, n7);
         d_view =
             create_mirror_view_and_copy(typename t_dev::memory_space(), h_view);
+        impl_rebind_range_tracking();
       }
       return;
     } else if constexpr (alloc_prop_input::has_execution_space) {
@@ -1116,6 +1348,13 @@ class DualView : public ViewTraits<DataType, Properties...> {
   }
 
  private:
+  // Keep tracking modified rows, with the same block size, after the Views
+  // were reallocated.
+  void impl_rebind_range_tracking() {
+    if (modified_blocks.data() != nullptr)
+      enable_range_tracking(modified_blocks(blocks_rows_idx));
+  }
+
   // resync host mirror from device
   // this code was relocated from a lambda as it contains a `if constexpr`.
   // In some cases, both branches were evaluated, leading to a compile error
@@ -438,6 +438,7 @@ create_mirror(const StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type,
 //----------------------------------------------------------------------------
 
 #include <impl/Kokkos_StaticCrsGraph_factory.hpp>
+#include <impl/Kokkos_StaticCrsGraph_reorder.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
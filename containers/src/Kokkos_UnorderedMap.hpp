@@ -56,7 +56,10 @@ enum : unsigned { UnorderedMapInvalidIndex = ~0u };
 ///      ignored and the old value was left in place. </li>
 /// </ol>
 
-class UnorderedMapInsertResult {
+///
+/// \tparam SizeType Type of the entry index, see UnorderedMap.
+template <typename SizeType>
+class BasicUnorderedMapInsertResult {
  private:
   enum Status : uint32_t {
     SUCCESS          = 1u << 31,
@@ -76,7 +79,7 @@ class UnorderedMapInsertResult {
 
   /// Did the map fail to insert the key due to insufficient capacity
   KOKKOS_FORCEINLINE_FUNCTION
-  bool failed() const { return m_index == UnorderedMapInvalidIndex; }
+  bool failed() const { return m_index == invalid_index; }
 
   /// Did the map lose a race condition to insert a dupulicate key/value pair
   /// where an index was claimed that needed to be released
@@ -90,10 +93,10 @@ class UnorderedMapInsertResult {
 
   /// Index where the key can be found as long as the insert did not fail
   KOKKOS_FORCEINLINE_FUNCTION
-  uint32_t index() const { return m_index; }
+  SizeType index() const { return m_index; }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  UnorderedMapInsertResult() : m_index(UnorderedMapInvalidIndex), m_status(0) {}
+  BasicUnorderedMapInsertResult() : m_index(invalid_index), m_status(0) {}
 
   KOKKOS_FORCEINLINE_FUNCTION
   void increment_list_position() {
@@ -101,23 +104,27 @@ class UnorderedMapInsertResult {
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  void set_existing(uint32_t i, bool arg_freed_existing) {
+  void set_existing(SizeType i, bool arg_freed_existing) {
     m_index = i;
     m_status =
         EXISTING | (arg_freed_existing ? FREED_EXISTING : 0u) | list_position();
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  void set_success(uint32_t i) {
+  void set_success(SizeType i) {
     m_index  = i;
     m_status = SUCCESS | list_position();
   }
 
  private:
-  uint32_t m_index;
+  static constexpr SizeType invalid_index = ~static_cast<SizeType>(0);
+
+  SizeType m_index;
   uint32_t m_status;
 };
 
+using UnorderedMapInsertResult = BasicUnorderedMapInsertResult<uint32_t>;
+
 /// \class UnorderedMapInsertOpTypes
 ///
 /// \brief Operations applied to the values array upon subsequent insertions.
@@ -169,8 +176,9 @@ struct UnorderedMapInsertOpTypes {
 /// memory if the original allocation did not suffice to hold the new
 /// element.  In this class, insertion does <i>not</i> reallocate
 /// memory.  This means that it might fail.  insert() returns an enum
-/// which indicates whether the insert failed.  There are three
-/// possible conditions:
+/// which indicates whether the insert failed.  (See reserve_growth() for
+/// a mode in which the map grows from inside kernels within reserved
+/// storage.)  There are three possible conditions:
 /// <ol>
 /// <li> <tt>INSERT_FAILED</tt>: The insert failed.  This usually
 ///      means that the UnorderedMap ran out of space. </li>
@@ -203,11 +211,24 @@ struct UnorderedMapInsertOpTypes {
 /// \tparam EqualTo Definition of the equality function for instances of
 ///   <tt>Key</tt>.  The default will do a bitwise equality comparison.
 ///
+/// \tparam SizeType Type of entry indices, capacities and sizes.  With the
+///   default uint32_t the capacity is below 2^32 entries.  uint64_t lifts
+///   that limit at the cost of twice the memory for the index arrays.  When
+///   the hash function returns 32 bits, a 64-bit map combines two seeded
+///   hashes so that more than 2^32 buckets can be used.  Failed lookups
+///   return ~size_type(0), so use valid_at() rather than comparing with
+///   UnorderedMapInvalidIndex.
+///
 template <typename Key, typename Value,
-          typename Device  = Kokkos::DefaultExecutionSpace,
-          typename Hasher  = pod_hash<std::remove_const_t<Key>>,
-          typename EqualTo = pod_equal_to<std::remove_const_t<Key>>>
+          typename Device   = Kokkos::DefaultExecutionSpace,
+          typename Hasher   = pod_hash<std::remove_const_t<Key>>,
+          typename EqualTo  = pod_equal_to<std::remove_const_t<Key>>,
+          typename SizeType = uint32_t>
 class UnorderedMap {
+  static_assert(std::is_same_v<SizeType, uint32_t> ||
+                    std::is_same_v<SizeType, uint64_t>,
+                "Kokkos::UnorderedMap: SizeType must be uint32_t or uint64_t");
+
  private:
   using host_mirror_space =
       typename ViewTraits<Key, Device, void, void>::host_mirror_space;
@@ -229,19 +250,21 @@ class UnorderedMap {
   using execution_space = typename Device::execution_space;
   using hasher_type     = Hasher;
   using equal_to_type   = EqualTo;
-  using size_type       = uint32_t;
+  using size_type       = SizeType;
 
   // map_types
   using declared_map_type =
       UnorderedMap<declared_key_type, declared_value_type, device_type,
-                   hasher_type, equal_to_type>;
-  using insertable_map_type = UnorderedMap<key_type, value_type, device_type,
-                                           hasher_type, equal_to_type>;
+                   hasher_type, equal_to_type, size_type>;
+  using insertable_map_type =
+      UnorderedMap<key_type, value_type, device_type, hasher_type,
+                   equal_to_type, size_type>;
   using modifiable_map_type =
       UnorderedMap<const_key_type, value_type, device_type, hasher_type,
-                   equal_to_type>;
-  using const_map_type = UnorderedMap<const_key_type, const_value_type,
-                                      device_type, hasher_type, equal_to_type>;
+                   equal_to_type, size_type>;
+  using const_map_type =
+      UnorderedMap<const_key_type, const_value_type, device_type, hasher_type,
+                   equal_to_type, size_type>;
 
   static constexpr bool is_set = std::is_void_v<value_type>;
   static constexpr bool has_const_key =
@@ -254,10 +277,10 @@ class UnorderedMap {
   static constexpr bool is_modifiable_map = has_const_key && !has_const_value;
   static constexpr bool is_const_map      = has_const_key && has_const_value;
 
-  using insert_result = UnorderedMapInsertResult;
+  using insert_result = BasicUnorderedMapInsertResult<size_type>;
 
   using HostMirror =
-      UnorderedMap<Key, Value, host_mirror_space, Hasher, EqualTo>;
+      UnorderedMap<Key, Value, host_mirror_space, Hasher, EqualTo, SizeType>;
 
   using histogram_type = Impl::UnorderedMapHistogram<const_map_type>;
   //@}
@@ -280,18 +303,24 @@ class UnorderedMap {
       is_insertable_map, View<size_type *, device_type>,
       View<const size_type *, device_type, MemoryTraits<RandomAccess>>>;
 
-  using bitset_type = std::conditional_t<is_insertable_map, Bitset<Device>,
-                                         ConstBitset<Device>>;
+  using bitset_type =
+      std::conditional_t<is_insertable_map, Bitset<Device, size_type>,
+                         ConstBitset<Device, size_type>>;
 
   enum { modified_idx = 0, erasable_idx = 1, failed_insert_idx = 2 };
   enum { num_scalars = 3 };
   using scalars_view = View<int[num_scalars], LayoutLeft, device_type>;
 
+  // when growing in place: the number of leading entries insert() may claim
+  // and the number of claimed entries
+  enum { growth_window_idx = 0, growth_claimed_idx = 1 };
+  using growth_view = View<size_type[2], LayoutLeft, device_type>;
+
  public:
   //! \name Public member functions
   //@{
   using default_op_type =
-      typename UnorderedMapInsertOpTypes<value_type_view, uint32_t>::NoOp;
+      typename UnorderedMapInsertOpTypes<value_type_view, size_type>::NoOp;
 
   /// \brief Constructor
   ///
@@ -388,8 +417,12 @@ class UnorderedMap {
     m_available_indexes.clear();
 
     Kokkos::deep_copy(m_hash_lists, invalid_index);
-    Kokkos::deep_copy(m_next_index, invalid_index);
-    {
+    // the reserved storage of a growing map is left untouched
+    if (m_growth.is_allocated()) {
+      Kokkos::deep_copy(
+          Kokkos::subview(m_growth, static_cast<int>(growth_claimed_idx)), 0);
+    } else {
+      Kokkos::deep_copy(m_next_index, invalid_index);
       const key_type tmp = key_type();
       Kokkos::deep_copy(m_keys, tmp);
     }
@@ -411,7 +444,8 @@ class UnorderedMap {
   /// into the resized / rehashed map.
   ///
   /// This is <i>not</i> a device function; it may <i>not</i> be
-  /// called in a parallel kernel.
+  /// called in a parallel kernel.  The rehashed map has a fixed capacity,
+  /// also if reserve_growth() was called before.
   bool rehash(size_type requested_capacity = 0) {
     const bool bounded_insert = (capacity() == 0) || (size() == 0u);
     return rehash(requested_capacity, bounded_insert);
@@ -438,6 +472,60 @@ class UnorderedMap {
     return true;
   }
 
+  /// \brief Let insert() grow the map in place up to \c max_capacity entries.
+  ///
+  /// Storage for \c max_capacity entries is allocated but, apart from the
+  /// bitset and the hash lists, not initialized.  Inserts claim entries in a
+  /// window of leading indices sized for the current number of entries.
+  /// Whenever an insert finds the window full it doubles the window from
+  /// inside the kernel, so a single pass succeeds for up to \c max_capacity
+  /// keys.  Host memory past the window is not touched.  capacity() returns
+  /// \c max_capacity.  The current entries are copied into the new storage.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  bool reserve_growth(size_type max_capacity) {
+    if (!is_insertable_map) return false;
+
+    const size_type curr_size = size();
+    max_capacity = calculate_capacity(
+        (max_capacity < curr_size) ? curr_size : max_capacity);
+
+    insertable_map_type tmp;
+    tmp.m_bounded_insert = true;
+    tmp.m_hasher         = m_hasher;
+    tmp.m_equal_to       = m_equal_to;
+    tmp.m_size           = shared_size_t("UnorderedMap - size");
+    tmp.m_available_indexes =
+        bitset_type(view_alloc("UnorderedMap - bitset"), max_capacity);
+    tmp.m_hash_lists = size_type_view(
+        view_alloc(WithoutInitializing, "UnorderedMap - hash list"),
+        Impl::find_hash_size(max_capacity));
+    tmp.m_next_index = size_type_view(
+        view_alloc(WithoutInitializing, "UnorderedMap - next index"),
+        max_capacity + 1);
+    tmp.m_keys = key_type_view(
+        view_alloc(WithoutInitializing, "UnorderedMap - keys"), max_capacity);
+    tmp.m_values = value_type_view(
+        view_alloc(WithoutInitializing, "UnorderedMap - values"),
+        is_set ? 0 : max_capacity);
+    tmp.m_scalars = scalars_view("UnorderedMap - scalars");
+    tmp.m_growth  = growth_view("UnorderedMap - growth");
+    Kokkos::deep_copy(tmp.m_hash_lists, invalid_index);
+    Kokkos::deep_copy(
+        Kokkos::subview(tmp.m_growth, static_cast<int>(growth_window_idx)),
+        calculate_capacity(curr_size));
+
+    if (curr_size) {
+      Impl::UnorderedMapRehash<insertable_map_type> f(tmp, *this);
+      f.apply();
+    }
+
+    *this = tmp;
+
+    return true;
+  }
+
   /// \brief The number of entries in the table.
   ///
   /// This method has undefined behavior when erasable() is true.
@@ -546,19 +634,25 @@ class UnorderedMap {
 
     int volatile &failed_insert_ref = m_scalars((int)failed_insert_idx);
 
-    const size_type hash_value = m_hasher(k);
+    const size_type hash_value = hash(k);
     const size_type hash_list  = hash_value % m_hash_lists.extent(0);
 
     size_type *curr_ptr = &m_hash_lists[hash_list];
     size_type new_index = invalid_index;
 
+    // entries claimable by this insert, see reserve_growth()
+    size_type window =
+        m_growth.data()
+            ? Kokkos::atomic_load(&m_growth((int)growth_window_idx))
+            : capacity();
+
     // Force integer multiply to long
     size_type index_hint = static_cast<size_type>(
-        (static_cast<double>(hash_list) * capacity()) / m_hash_lists.extent(0));
+        (static_cast<double>(hash_list) * window) / m_hash_lists.extent(0));
 
     size_type find_attempts = 0;
 
-    enum : unsigned { bounded_find_attempts = 32u };
+    constexpr size_type bounded_find_attempts = 32u;
     const size_type max_attempts =
         (m_bounded_insert &&
          (bounded_find_attempts < m_available_indexes.max_hint()))
@@ -616,6 +710,8 @@ class UnorderedMap {
           // Release this unused entry immediately.
           if (!m_available_indexes.reset(new_index)) {
             Kokkos::printf("Unable to free existing\n");
+          } else if (m_growth.data()) {
+            Kokkos::atomic_dec(&m_growth((int)growth_claimed_idx));
           }
         }
 
@@ -637,12 +733,28 @@ class UnorderedMap {
           Kokkos::tie(found, index_hint) =
               m_available_indexes.find_any_unset_near(index_hint, hash_list);
 
+          if (window <= index_hint) {
+            // the search left the window of a growing map, continue at the
+            // other end of the window
+            found      = false;
+            index_hint = (hash_list & bitset_type::MOVE_HINT_BACKWARD)
+                             ? window - 1
+                             : index_hint % window;
+          }
+
           // found and index and this thread set it
           if (!found && ++find_attempts >= max_attempts) {
-            failed_insert_ref = true;
-            not_done          = false;
+            if (grow_window(window, index_hint)) {
+              find_attempts = 0;
+            } else {
+              failed_insert_ref = true;
+              not_done          = false;
+            }
           } else if (m_available_indexes.set(index_hint)) {
             new_index = index_hint;
+            if (m_growth.data()) {
+              Kokkos::atomic_inc(&m_growth((int)growth_claimed_idx));
+            }
             // Set key and value
             KOKKOS_NONTEMPORAL_PREFETCH_STORE(&m_keys[new_index]);
 // FIXME_SYCL replacement for memory_fence
@@ -651,6 +763,10 @@ class UnorderedMap {
 #else
             m_keys[new_index] = k;
 #endif
+            // the reserved storage of a growing map is not initialized
+            if (m_growth.data()) {
+              m_next_index[new_index] = invalid_index;
+            }
 
             if (!is_set) {
               KOKKOS_NONTEMPORAL_PREFETCH_STORE(&m_values[new_index]);
@@ -698,7 +814,10 @@ class UnorderedMap {
 
       size_type index = find(k);
       if (valid_at(index)) {
-        m_available_indexes.reset(index);
+        // give the entry back to the window of a growing map
+        if (m_available_indexes.reset(index) && m_growth.data()) {
+          Kokkos::atomic_dec(&m_growth((int)growth_claimed_idx));
+        }
         result = true;
       }
     }
@@ -716,7 +835,7 @@ class UnorderedMap {
   KOKKOS_INLINE_FUNCTION
   size_type find(const key_type &k) const {
     size_type curr = 0u < capacity()
-                         ? m_hash_lists(m_hasher(k) % m_hash_lists.extent(0))
+                         ? m_hash_lists(hash(k) % m_hash_lists.extent(0))
                          : invalid_index;
 
     KOKKOS_NONTEMPORAL_PREFETCH_LOAD(&m_keys[curr != invalid_index ? curr : 0]);
@@ -770,7 +889,7 @@ class UnorderedMap {
 
   template <typename SKey, typename SValue>
   UnorderedMap(
-      UnorderedMap<SKey, SValue, Device, Hasher, EqualTo> const &src,
+      UnorderedMap<SKey, SValue, Device, Hasher, EqualTo, SizeType> const &src,
       std::enable_if_t<
           Impl::UnorderedMapCanAssign<declared_key_type, declared_value_type,
                                       SKey, SValue>::value,
@@ -784,14 +903,16 @@ class UnorderedMap {
         m_next_index(src.m_next_index),
         m_keys(src.m_keys),
         m_values(src.m_values),
-        m_scalars(src.m_scalars) {}
+        m_scalars(src.m_scalars),
+        m_growth(src.m_growth) {}
 
   template <typename SKey, typename SValue>
   std::enable_if_t<
       Impl::UnorderedMapCanAssign<declared_key_type, declared_value_type, SKey,
                                   SValue>::value,
       declared_map_type &>
-  operator=(UnorderedMap<SKey, SValue, Device, Hasher, EqualTo> const &src) {
+  operator=(UnorderedMap<SKey, SValue, Device, Hasher, EqualTo, SizeType> const
+                &src) {
     m_bounded_insert    = src.m_bounded_insert;
     m_hasher            = src.m_hasher;
     m_equal_to          = src.m_equal_to;
@@ -802,6 +923,7 @@ class UnorderedMap {
     m_keys              = src.m_keys;
     m_values            = src.m_values;
     m_scalars           = src.m_scalars;
+    m_growth            = src.m_growth;
     return *this;
   }
 
@@ -811,7 +933,8 @@ class UnorderedMap {
   std::enable_if_t<std::is_same_v<std::remove_const_t<SKey>, key_type> &&
                    std::is_same_v<std::remove_const_t<SValue>, value_type>>
   create_copy_view(
-      UnorderedMap<SKey, SValue, SDevice, Hasher, EqualTo> const &src) {
+      UnorderedMap<SKey, SValue, SDevice, Hasher, EqualTo, SizeType> const
+          &src) {
     if (m_hash_lists.data() != src.m_hash_lists.data()) {
       allocate_view(src);
       deep_copy_view(src);
@@ -824,7 +947,8 @@ class UnorderedMap {
   std::enable_if_t<std::is_same_v<std::remove_const_t<SKey>, key_type> &&
                    std::is_same_v<std::remove_const_t<SValue>, value_type>>
   allocate_view(
-      UnorderedMap<SKey, SValue, SDevice, Hasher, EqualTo> const &src) {
+      UnorderedMap<SKey, SValue, SDevice, Hasher, EqualTo, SizeType> const
+          &src) {
     insertable_map_type tmp;
 
     tmp.m_bounded_insert    = src.m_bounded_insert;
@@ -845,6 +969,9 @@ class UnorderedMap {
         value_type_view(view_alloc(WithoutInitializing, "UnorderedMap values"),
                         src.m_values.extent(0));
     tmp.m_scalars = scalars_view("UnorderedMap scalars");
+    if (src.m_growth.is_allocated()) {
+      tmp.m_growth = growth_view("UnorderedMap growth");
+    }
 
     *this = tmp;
   }
@@ -855,7 +982,8 @@ class UnorderedMap {
   std::enable_if_t<std::is_same_v<std::remove_const_t<SKey>, key_type> &&
                    std::is_same_v<std::remove_const_t<SValue>, value_type>>
   deep_copy_view(
-      UnorderedMap<SKey, SValue, SDevice, Hasher, EqualTo> const &src) {
+      UnorderedMap<SKey, SValue, SDevice, Hasher, EqualTo, SizeType> const
+          &src) {
 #ifndef KOKKOS_ENABLE_DEPRECATED_CODE_4
     // To deep copy UnorderedMap, capacity must be identical
     KOKKOS_EXPECTS(capacity() == src.capacity());
@@ -884,6 +1012,10 @@ class UnorderedMap {
         Kokkos::deep_copy(exec_space, m_values, src.m_values);
       }
       Kokkos::deep_copy(exec_space, m_scalars, src.m_scalars);
+      if (m_growth.is_allocated() &&
+          src.m_growth.is_allocated()) {
+        Kokkos::deep_copy(exec_space, m_growth, src.m_growth);
+      }
 
       Kokkos::fence(
           "Kokkos::UnorderedMap::deep_copy_view: fence after copy to dst.");
@@ -894,6 +1026,51 @@ class UnorderedMap {
  private:  // private member functions
   bool modified() const { return get_flag(modified_idx); }
 
+  // Called when a bounded search for an unclaimed entry failed.  Doubles the
+  // window of claimable entries, up to the capacity, once it is 7/8 claimed,
+  // and moves the hint into the new entries.  Returns false if the map does
+  // not grow or the window already spans the capacity.
+  KOKKOS_INLINE_FUNCTION
+  bool grow_window(size_type &window, size_type &hint) const {
+    if (!m_growth.data()) return false;
+    size_type *const window_ptr = &m_growth((int)growth_window_idx);
+
+    const size_type curr = Kokkos::atomic_load(window_ptr);
+    if (window < curr) {
+      // another thread grew the window
+      hint   = window + (curr - window) / 2;
+      window = curr;
+      return true;
+    }
+    const size_type claimed =
+        Kokkos::atomic_load(&m_growth((int)growth_claimed_idx));
+    if (claimed < window - window / 8) return true;  // keep searching
+
+    const size_type cap = capacity();
+    if (cap <= window) return false;
+    const size_type grown = (window < cap - window) ? 2 * window : cap;
+    const size_type prev =
+        Kokkos::atomic_compare_exchange(window_ptr, window, grown);
+    const size_type next = (prev == window) ? grown : prev;
+    hint                 = window + (next - window) / 2;
+    window               = next;
+    return true;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type hash(const key_type &k) const {
+    using hash_value_type = decltype(m_hasher(k));
+    if constexpr (sizeof(size_type) <= sizeof(hash_value_type) ||
+                  !std::is_invocable_v<const hasher_type &, const key_type &,
+                                       uint32_t>) {
+      return m_hasher(k);
+    } else {
+      // widen a 32-bit hash with a second, differently seeded one
+      return m_hasher(k) |
+             (static_cast<size_type>(m_hasher(k, 0x9e3779b9u)) << 32);
+    }
+  }
+
   void set_flag(int flag) const {
     auto scalar = Kokkos::subview(m_scalars, flag);
     Kokkos::deep_copy(typename device_type::execution_space{}, scalar,
@@ -922,10 +1099,10 @@ class UnorderedMap {
     return result;
   }
 
-  static uint32_t calculate_capacity(uint32_t capacity_hint) {
+  static size_type calculate_capacity(size_type capacity_hint) {
     // increase by 16% and round to nears multiple of 128
     return capacity_hint
-               ? ((static_cast<uint32_t>(7ull * capacity_hint / 6u) + 127u) /
+               ? ((static_cast<size_type>(7ull * capacity_hint / 6u) + 127u) /
                   128u) *
                      128u
                : 128u;
@@ -943,9 +1120,10 @@ class UnorderedMap {
   key_type_view m_keys;
   value_type_view m_values;
   scalars_view m_scalars;
+  growth_view m_growth;
 
   template <typename KKey, typename VValue, typename DDevice, typename HHash,
-            typename EEqualTo>
+            typename EEqualTo, typename SSizeType>
   friend class UnorderedMap;
 
   template <typename UMap>
@@ -960,21 +1138,23 @@ class UnorderedMap {
 
 // Specialization of deep_copy() for two UnorderedMap objects.
 template <typename DKey, typename DT, typename DDevice, typename SKey,
-          typename ST, typename SDevice, typename Hasher, typename EqualTo>
+          typename ST, typename SDevice, typename Hasher, typename EqualTo,
+          typename SizeType>
 inline void deep_copy(
-    UnorderedMap<DKey, DT, DDevice, Hasher, EqualTo> &dst,
-    const UnorderedMap<SKey, ST, SDevice, Hasher, EqualTo> &src) {
+    UnorderedMap<DKey, DT, DDevice, Hasher, EqualTo, SizeType> &dst,
+    const UnorderedMap<SKey, ST, SDevice, Hasher, EqualTo, SizeType> &src) {
   dst.deep_copy_view(src);
 }
 
 // Specialization of create_mirror() for an UnorderedMap object.
 template <typename Key, typename ValueType, typename Device, typename Hasher,
-          typename EqualTo>
-typename UnorderedMap<Key, ValueType, Device, Hasher, EqualTo>::HostMirror
-create_mirror(
-    const UnorderedMap<Key, ValueType, Device, Hasher, EqualTo> &src) {
-  typename UnorderedMap<Key, ValueType, Device, Hasher, EqualTo>::HostMirror
-      dst;
+          typename EqualTo, typename SizeType>
+typename UnorderedMap<Key, ValueType, Device, Hasher, EqualTo,
+                      SizeType>::HostMirror
+create_mirror(const UnorderedMap<Key, ValueType, Device, Hasher, EqualTo,
+                                 SizeType> &src) {
+  typename UnorderedMap<Key, ValueType, Device, Hasher, EqualTo,
+                        SizeType>::HostMirror dst;
   dst.allocate_view(src);
   return dst;
 }
@@ -146,27 +146,32 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
 
     size_t sum       = 0;
     row_work_host[0] = 0;
-    for (size_t i = 0; i < length; ++i) {
-      row_work_host[i + 1] = sum += input[i].size();
-    }
+    Kokkos::parallel_scan(
+        "Kokkos::create_staticcrsgraph::row_map",
+        RangePolicy<DefaultHostExecutionSpace>(0, length),
+        [&](size_t i, size_t& update, bool final_pass) {
+          update += input[i].size();
+          if (final_pass) row_work_host[i + 1] = update;
+        },
+        sum);
 
     deep_copy(row_work, row_work_host);
 
     output.entries = entries_type(label, sum);
     output.row_map = row_work;
-  }
 
-  // Fill in the entries:
-  {
+    // Fill in the entries:
     typename entries_type::HostMirror host_entries =
         create_mirror_view(output.entries);
 
-    size_t sum = 0;
-    for (size_t i = 0; i < length; ++i) {
-      for (size_t j = 0; j < input[i].size(); ++j, ++sum) {
-        host_entries(sum) = input[i][j];
-      }
-    }
+    Kokkos::parallel_for(
+        "Kokkos::create_staticcrsgraph::entries",
+        RangePolicy<DefaultHostExecutionSpace>(0, length), [&](size_t i) {
+          size_t k = row_work_host[i];
+          for (size_t j = 0; j < input[i].size(); ++j, ++k) {
+            host_entries(k) = input[i][j];
+          }
+        });
 
     deep_copy(output.entries, host_entries);
   }
@@ -174,6 +179,53 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
   return output;
 }
 
+//----------------------------------------------------------------------------
+
+/// \brief Build a graph with \c nrows rows from the edges (rows(k), cols(k)).
+///
+/// Runs in parallel on the graph's execution space without atomics; the
+/// entries of each row keep their order in the input.
+template <class StaticCrsGraphType, class RowIndices, class ColumnIndices>
+inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, size_t nrows, const RowIndices& rows,
+    const ColumnIndices& cols) {
+  using output_type  = StaticCrsGraphType;
+  using entries_type = typename output_type::entries_type;
+  using work_type    = View<
+      typename output_type::size_type*, typename output_type::array_layout,
+      typename output_type::device_type, typename output_type::memory_traits>;
+
+  work_type row_map;
+  entries_type entries;
+  Impl::crs_from_coo(row_map, entries, nrows, rows, cols, "row_map", label);
+  return output_type(entries, row_map);
+}
+
+/// \brief Transpose \c in into \c out, see transpose_crs(Crs&, Crs const&).
+template <class DataType, class Arg1Type, class Arg2Type, class Arg3Type,
+          typename SizeType>
+void transpose_crs(
+    StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type, SizeType>& out,
+    const StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type, SizeType>&
+        in) {
+  using graph_type =
+      StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type, SizeType>;
+  using entries_type = typename graph_type::entries_type;
+  using rows_type    = View<DataType*, typename graph_type::device_type>;
+  using work_type    = View<SizeType*, typename graph_type::array_layout,
+                         typename graph_type::device_type,
+                         typename graph_type::memory_traits>;
+
+  rows_type rows(view_alloc(WithoutInitializing, "transpose_rows"),
+                 in.entries.extent(0));
+  Impl::CrsEntryRows<graph_type, rows_type> rows_functor(in, rows);
+  work_type row_map;
+  entries_type entries;
+  Impl::crs_from_coo(row_map, entries, in.numRows(), in.entries, rows,
+                     "transpose_row_map", "transpose_entries");
+  out = graph_type(entries, row_map);
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,570 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_STATICCRSGRAPH_REORDER_HPP
+#define KOKKOS_IMPL_STATICCRSGRAPH_REORDER_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_StaticCrsGraph.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+//----------------------------------------------------------------------------
+// Locality improving orderings of graph rows.  An ordering is a permutation
+// perm with perm(new_index) == old_index, the same convention as the
+// permutation vector of BinSort.
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/// Level synchronous reverse Cuthill-McKee.  Every level of the breadth
+/// first search is one set of kernels over the current frontier: each
+/// unvisited neighbor is claimed by the frontier vertex with the lowest
+/// position (atomic min, so the result does not depend on scheduling), the
+/// claims are counted and scanned, and every frontier vertex writes its
+/// children sorted by degree after the frontier.
+template <class GraphType>
+struct StaticCrsGraphRcmFunctor {
+  using execution_space = typename GraphType::execution_space;
+  using device_type     = typename GraphType::device_type;
+  using ordinal_type    = std::remove_const_t<typename GraphType::data_type>;
+  using perm_type       = View<ordinal_type*, device_type>;
+  using index_view      = View<int64_t*, device_type>;
+
+  struct Degree {};
+  struct Init {};
+  struct Root {};
+  struct FirstUnvisited {};
+  struct MinDegreeOfRange {};
+  struct Claim {};
+  struct Count {};
+  struct Scan {};
+  struct Place {};
+  struct Reset {};
+  struct Reverse {};
+
+  GraphType m_graph;
+  perm_type m_perm;
+  perm_type m_by_degree;  // vertices sorted by key()
+  View<int*, device_type> m_level;
+  index_view m_parent;  // claiming frontier position, m_n while unclaimed
+  index_view m_counts;  // children per frontier position, then offsets
+  int64_t m_n;
+  int64_t m_frontier_end = 0;
+  int64_t m_root         = 0;
+  int m_next_level       = 0;
+
+  explicit StaticCrsGraphRcmFunctor(const GraphType& graph)
+      : m_graph(graph),
+        m_perm(view_alloc(WithoutInitializing, "Kokkos::rcm_ordering::perm"),
+               graph.numRows()),
+        m_level(view_alloc(WithoutInitializing, "Kokkos::rcm_ordering::level"),
+                graph.numRows()),
+        m_parent(
+            view_alloc(WithoutInitializing, "Kokkos::rcm_ordering::parent"),
+            graph.numRows()),
+        m_counts(
+            view_alloc(WithoutInitializing, "Kokkos::rcm_ordering::counts"),
+            graph.numRows()),
+        m_n(graph.numRows()) {}
+
+  // Sort key: degree first, then index.
+  KOKKOS_INLINE_FUNCTION
+  int64_t key(int64_t v) const {
+    return int64_t(m_graph.row_map(v + 1) - m_graph.row_map(v)) * m_n + v;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Degree, int64_t v, int64_t& max_degree) const {
+    m_counts(v) = m_graph.row_map(v + 1) - m_graph.row_map(v);
+    m_perm(v)   = v;
+    if (m_counts(v) > max_degree) max_degree = m_counts(v);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Init, int64_t v) const {
+    m_level(v)  = -1;
+    m_parent(v) = m_n;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Root, int64_t p) const {
+    m_perm(p)        = m_root;
+    m_level(m_root)  = 0;
+    m_parent(m_root) = -1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(FirstUnvisited, int64_t p, int64_t& first) const {
+    if (m_level(m_by_degree(p)) < 0 && p < first) first = p;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(MinDegreeOfRange, int64_t p, int64_t& min_key) const {
+    if (key(m_perm(p)) < min_key) min_key = key(m_perm(p));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Claim, int64_t p) const {
+    const auto v = m_perm(p);
+    for (auto j = m_graph.row_map(v); j < m_graph.row_map(v + 1); ++j) {
+      const auto u = m_graph.entries(j);
+      if (m_level(u) < 0 && p < m_parent(u)) atomic_min(&m_parent(u), p);
+    }
+  }
+
+  // Only the claiming vertex touches a child, so no atomics from here on.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, int64_t p) const {
+    const auto v = m_perm(p);
+    int64_t count = 0;
+    for (auto j = m_graph.row_map(v); j < m_graph.row_map(v + 1); ++j) {
+      const auto u = m_graph.entries(j);
+      if (m_parent(u) == p && m_level(u) < 0) {
+        m_level(u) = m_next_level;
+        ++count;
+      }
+    }
+    m_counts(p) = count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Scan, int64_t p, int64_t& update, bool final_pass) const {
+    const int64_t count = m_counts(p);
+    if (final_pass) m_counts(p) = update;
+    update += count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Place, int64_t p) const {
+    const auto v      = m_perm(p);
+    const int64_t beg = m_frontier_end + m_counts(p);
+    int64_t end       = beg;
+    for (auto j = m_graph.row_map(v); j < m_graph.row_map(v + 1); ++j) {
+      const auto u = m_graph.entries(j);
+      if (m_parent(u) == p) {
+        m_parent(u) = -1;
+        // insertion sort by degree, the children of one vertex are few
+        int64_t k = end++;
+        for (; k > beg && key(m_perm(k - 1)) > key(u); --k)
+          m_perm(k) = m_perm(k - 1);
+        m_perm(k) = u;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Reset, int64_t p) const {
+    m_level(m_perm(p))  = -1;
+    m_parent(m_perm(p)) = m_n;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Reverse, int64_t p) const {
+    const auto tmp      = m_perm(p);
+    m_perm(p)           = m_perm(m_n - 1 - p);
+    m_perm(m_n - 1 - p) = tmp;
+  }
+
+  template <class Tag>
+  void run(int64_t begin, int64_t end) const {
+    parallel_for("Kokkos::rcm_ordering",
+                 RangePolicy<execution_space, Tag>(begin, end), *this);
+  }
+
+  template <class Tag, class Reducer>
+  int64_t reduce(int64_t begin, int64_t end) const {
+    int64_t result = 0;
+    parallel_reduce("Kokkos::rcm_ordering",
+                    RangePolicy<execution_space, Tag>(begin, end), *this,
+                    Reducer(result));
+    return result;
+  }
+
+  // Lowest degree vertex not yet visited, looking at the vertices sorted by
+  // degree in windows from cursor on.
+  int64_t next_root(int64_t& cursor) const {
+    constexpr int64_t window = 4096;
+    while (true) {
+      const int64_t end   = cursor + window < m_n ? cursor + window : m_n;
+      const int64_t first = reduce<FirstUnvisited, Min<int64_t>>(cursor, end);
+      if (first < end) {
+        cursor = first + 1;
+        ordinal_type root;
+        deep_copy(root, Kokkos::subview(m_by_degree, first));
+        return root;
+      }
+      cursor = end;
+    }
+  }
+
+  struct BfsResult {
+    int64_t end;
+    int64_t last_level_begin;
+    int depth;
+  };
+
+  // Breadth first search of the component of root, whose vertices are
+  // written to m_perm starting at position base.
+  BfsResult bfs(int64_t base, int64_t root) {
+    m_root = root;
+    run<Root>(base, base + 1);
+    int64_t frontier_begin = base;
+    m_frontier_end         = base + 1;
+    int depth              = 0;
+    while (true) {
+      m_next_level = depth + 1;
+      run<Claim>(frontier_begin, m_frontier_end);
+      run<Count>(frontier_begin, m_frontier_end);
+      int64_t children = 0;
+      parallel_scan("Kokkos::rcm_ordering",
+                    RangePolicy<execution_space, Scan>(frontier_begin,
+                                                       m_frontier_end),
+                    *this, children);
+      if (children == 0) break;
+      run<Place>(frontier_begin, m_frontier_end);
+      frontier_begin = m_frontier_end;
+      m_frontier_end += children;
+      ++depth;
+    }
+    return {m_frontier_end, frontier_begin, depth};
+  }
+
+  perm_type execute() {
+    // Candidate roots in order of increasing degree, with the bucketing of
+    // Kokkos_Crs.hpp.
+    const int64_t max_degree = reduce<Degree, Max<int64_t>>(0, m_n);
+    View<int64_t*, device_type> degree_begin;
+    Impl::crs_from_coo(degree_begin, m_by_degree, max_degree + 1, m_counts,
+                       m_perm, "Kokkos::rcm_ordering::degree_begin",
+                       "Kokkos::rcm_ordering::by_degree");
+    run<Init>(0, m_n);
+    int64_t base   = 0;
+    int64_t cursor = 0;
+    while (base < m_n) {
+      // Start from a pseudo-peripheral vertex (George and Liu): restart
+      // from a lowest degree vertex of the last level while that makes the
+      // search deeper.
+      const int64_t root = next_root(cursor);
+      BfsResult result   = bfs(base, root);
+      for (int iter = 0; iter < 4 && result.depth > 0; ++iter) {
+        const int64_t candidate =
+            reduce<MinDegreeOfRange, Min<int64_t>>(result.last_level_begin,
+                                                    result.end) %
+            m_n;
+        run<Reset>(base, result.end);
+        const int depth = result.depth;
+        result          = bfs(base, candidate);
+        if (result.depth <= depth) break;
+      }
+      base = result.end;
+    }
+    run<Reverse>(0, m_n / 2);
+    execution_space().fence(
+        "Kokkos::rcm_ordering: fence after computing the ordering");
+    return m_perm;
+  }
+};
+
+/// Keys along a Morton (Z-order) or Hilbert curve through the bounding box
+/// of a set of points, sorted with a stable radix sort built on the parallel
+/// COO bucketing of Kokkos_Crs.hpp.
+template <class CoordView, class IndexType>
+struct SpaceFillingCurveFunctor {
+  using execution_space = typename CoordView::execution_space;
+  using device_type     = typename CoordView::device_type;
+  using perm_type       = View<IndexType*, device_type>;
+
+  static constexpr int digit_bits = 16;
+
+  struct Bounds {};
+  struct Keys {};
+  struct Digits {};
+
+  CoordView m_coords;
+  View<uint64_t*, device_type> m_keys;
+  View<uint16_t*, device_type> m_digits;
+  perm_type m_perm;
+  int m_dim;
+  int m_bits;  // per coordinate
+  bool m_hilbert;
+  int m_bound_dim   = 0;
+  int m_shift       = 0;
+  double m_lo[3]    = {0, 0, 0};
+  double m_scale[3] = {0, 0, 0};
+
+  SpaceFillingCurveFunctor(const CoordView& coords, bool hilbert)
+      : m_coords(coords),
+        m_keys(view_alloc(WithoutInitializing, "Kokkos::curve_ordering::keys"),
+               coords.extent(0)),
+        m_digits(
+            view_alloc(WithoutInitializing, "Kokkos::curve_ordering::digits"),
+            coords.extent(0)),
+        m_perm(view_alloc(WithoutInitializing, "Kokkos::curve_ordering::perm"),
+               coords.extent(0)),
+        m_dim(coords.extent(1)),
+        m_bits(m_dim == 3 ? 21 : 32),
+        m_hilbert(hilbert) {
+    if (m_dim < 1 || m_dim > 3)
+      Kokkos::abort(
+          "Kokkos::hilbert_ordering/morton_ordering: coordinates must have "
+          "one to three dimensions");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Bounds, int64_t i, double& lo, double& hi) const {
+    const double x = m_coords(i, m_bound_dim);
+    if (x < lo) lo = x;
+    if (x > hi) hi = x;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Keys, int64_t i) const {
+    uint64_t x[3]     = {0, 0, 0};
+    const double qmax = double((uint64_t(1) << m_bits) - 1);
+    for (int d = 0; d < m_dim; ++d) {
+      const double q = (m_coords(i, d) - m_lo[d]) * m_scale[d] * qmax;
+      x[d] = q <= 0 ? 0 : q >= qmax ? uint64_t(qmax) : uint64_t(q);
+    }
+    if (m_hilbert && m_dim > 1) {
+      // Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707
+      // (2004): turn the axes into the transposed Hilbert index.
+      const uint64_t m = uint64_t(1) << (m_bits - 1);
+      for (uint64_t q = m; q > 1; q >>= 1) {
+        const uint64_t p = q - 1;
+        for (int d = 0; d < m_dim; ++d) {
+          if (x[d] & q) {
+            x[0] ^= p;
+          } else {
+            const uint64_t t = (x[0] ^ x[d]) & p;
+            x[0] ^= t;
+            x[d] ^= t;
+          }
+        }
+      }
+      for (int d = 1; d < m_dim; ++d) x[d] ^= x[d - 1];
+      uint64_t t = 0;
+      for (uint64_t q = m; q > 1; q >>= 1)
+        if (x[m_dim - 1] & q) t ^= q - 1;
+      for (int d = 0; d < m_dim; ++d) x[d] ^= t;
+    }
+    uint64_t key = 0;
+    for (int b = m_bits - 1; b >= 0; --b)
+      for (int d = 0; d < m_dim; ++d) key = (key << 1) | ((x[d] >> b) & 1);
+    m_keys(i) = key;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Digits, int64_t k) const {
+    m_digits(k) = (m_keys(m_perm(k)) >> m_shift) & ((1u << digit_bits) - 1);
+  }
+
+  perm_type execute() {
+    const int64_t n = m_coords.extent(0);
+    for (m_bound_dim = 0; m_bound_dim < m_dim; ++m_bound_dim) {
+      double lo = 0, hi = 0;
+      parallel_reduce("Kokkos::curve_ordering::bounds",
+                      RangePolicy<execution_space, Bounds>(0, n), *this,
+                      Kokkos::Min<double>(lo), Kokkos::Max<double>(hi));
+      m_lo[m_bound_dim]    = lo;
+      m_scale[m_bound_dim] = hi > lo ? 1.0 / (hi - lo) : 0.0;
+    }
+    parallel_for("Kokkos::curve_ordering::keys",
+                 RangePolicy<execution_space, Keys>(0, n), *this);
+    parallel_for("Kokkos::curve_ordering::iota",
+                 RangePolicy<execution_space>(0, n), IotaFunctor{m_perm});
+
+    // least significant digit first radix sort, one stable bucketing per
+    // digit
+    View<int64_t*, device_type> buckets;
+    for (m_shift = 0; m_shift < m_dim * m_bits; m_shift += digit_bits) {
+      parallel_for("Kokkos::curve_ordering::digits",
+                   RangePolicy<execution_space, Digits>(0, n), *this);
+      perm_type sorted;
+      Impl::crs_from_coo(buckets, sorted, size_t(1) << digit_bits, m_digits,
+                         m_perm, "Kokkos::curve_ordering::buckets",
+                         "Kokkos::curve_ordering::perm");
+      m_perm = sorted;
+    }
+    return m_perm;
+  }
+
+  struct IotaFunctor {
+    perm_type perm;
+    KOKKOS_INLINE_FUNCTION
+    void operator()(int64_t i) const { perm(i) = i; }
+  };
+};
+
+template <class GraphType, class PermView>
+struct StaticCrsGraphPermuteFunctor {
+  using execution_space = typename GraphType::execution_space;
+  using device_type     = typename GraphType::device_type;
+  using size_type       = typename GraphType::size_type;
+  using ordinal_type    = std::remove_const_t<typename GraphType::data_type>;
+  using row_map_type =
+      View<size_type*, typename GraphType::array_layout, device_type>;
+  using entries_type = View<ordinal_type*, typename GraphType::array_layout,
+                            device_type, typename GraphType::memory_traits>;
+
+  struct Inverse {};
+  struct Count {};
+  struct Fill {};
+
+  GraphType m_graph;
+  PermView m_perm;
+  View<ordinal_type*, device_type> m_inverse;
+  View<size_type*, device_type> m_counts;
+  row_map_type m_row_map;
+  entries_type m_entries;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Inverse, int64_t i) const { m_inverse(m_perm(i)) = i; }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, int64_t i) const {
+    m_counts(i) = m_graph.row_map(m_perm(i) + 1) - m_graph.row_map(m_perm(i));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Fill, int64_t i) const {
+    auto k = m_row_map(i);
+    for (auto j = m_graph.row_map(m_perm(i));
+         j < m_graph.row_map(m_perm(i) + 1); ++j, ++k)
+      m_entries(k) = m_inverse(m_graph.entries(j));
+  }
+
+  StaticCrsGraphPermuteFunctor(const GraphType& graph, const PermView& perm)
+      : m_graph(graph), m_perm(perm) {}
+
+  GraphType execute(const std::string& label) {
+    const int64_t n = m_graph.numRows();
+    m_inverse       = View<ordinal_type*, device_type>(
+        view_alloc(WithoutInitializing, "Kokkos::permute_graph::inverse"), n);
+    m_counts = View<size_type*, device_type>(
+        view_alloc(WithoutInitializing, "Kokkos::permute_graph::counts"), n);
+    parallel_for("Kokkos::permute_graph",
+                 RangePolicy<execution_space, Inverse>(0, n), *this);
+    parallel_for("Kokkos::permute_graph",
+                 RangePolicy<execution_space, Count>(0, n), *this);
+    Kokkos::get_crs_row_map_from_counts(m_row_map, m_counts);
+    m_entries = entries_type(view_alloc(WithoutInitializing, label),
+                             m_graph.entries.extent(0));
+    parallel_for("Kokkos::permute_graph",
+                 RangePolicy<execution_space, Fill>(0, n), *this);
+    execution_space().fence(
+        "Kokkos::permute_graph: fence after permuting the graph");
+    return GraphType(m_entries, m_row_map);
+  }
+};
+
+template <class DstView, class SrcView, class PermView>
+struct PermuteRowsFunctor {
+  DstView dst;
+  SrcView src;
+  PermView perm;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int64_t i) const {
+    const auto k = perm(i);
+    if constexpr (DstView::rank == 1) {
+      dst(i) = src(k);
+    } else if constexpr (DstView::rank == 2) {
+      for (size_t j = 0; j < dst.extent(1); ++j) dst(i, j) = src(k, j);
+    } else {
+      for (size_t j = 0; j < dst.extent(1); ++j)
+        for (size_t l = 0; l < dst.extent(2); ++l) dst(i, j, l) = src(k, j, l);
+    }
+  }
+};
+
+}  // namespace Impl
+
+/// \brief Reverse Cuthill-McKee ordering of the rows of a graph.
+///
+/// The graph should be structurally symmetric.  Each connected component is
+/// ordered from a pseudo-peripheral vertex; the result is deterministic.
+template <class DataType, class Arg1Type, class Arg2Type, class Arg3Type,
+          typename SizeType>
+View<std::remove_const_t<DataType>*,
+     typename StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type,
+                             SizeType>::device_type>
+rcm_ordering(const StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type,
+                                  SizeType>& graph) {
+  using graph_type =
+      StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type, SizeType>;
+  return Impl::StaticCrsGraphRcmFunctor<graph_type>(graph).execute();
+}
+
+/// \brief Order points with coordinates coords(i, 0..dim-1), 1 <= dim <= 3,
+///   along a Hilbert curve.
+template <class IndexType = int, class CoordView>
+View<IndexType*, typename CoordView::device_type> hilbert_ordering(
+    const CoordView& coords) {
+  static_assert(CoordView::rank == 2,
+                "Kokkos::hilbert_ordering: coordinates must be rank two");
+  return Impl::SpaceFillingCurveFunctor<CoordView, IndexType>(coords, true)
+      .execute();
+}
+
+/// \brief Order points with coordinates coords(i, 0..dim-1), 1 <= dim <= 3,
+///   along a Morton (Z-order) curve.
+template <class IndexType = int, class CoordView>
+View<IndexType*, typename CoordView::device_type> morton_ordering(
+    const CoordView& coords) {
+  static_assert(CoordView::rank == 2,
+                "Kokkos::morton_ordering: coordinates must be rank two");
+  return Impl::SpaceFillingCurveFunctor<CoordView, IndexType>(coords, false)
+      .execute();
+}
+
+/// \brief Renumber the rows and columns of a graph: row i of the result is
+///   row perm(i) of \c graph, and every entry c becomes the new index of c.
+template <class DataType, class Arg1Type, class Arg2Type, class Arg3Type,
+          typename SizeType, class PermView>
+StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type, SizeType> permute_graph(
+    const StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type, SizeType>&
+        graph,
+    const PermView& perm, const std::string& label = "permuted_entries") {
+  using graph_type =
+      StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type, SizeType>;
+  return Impl::StaticCrsGraphPermuteFunctor<graph_type, PermView>(graph, perm)
+      .execute(label);
+}
+
+/// \brief Gather rows of \c src into \c dst: dst(i, ...) = src(perm(i), ...).
+///
+/// Applies an ordering to data associated with the rows of a graph.  \c dst
+/// and \c src must not alias.
+template <class DstView, class SrcView, class PermView>
+void permute_rows(const DstView& dst, const SrcView& src,
+                  const PermView& perm) {
+  static_assert(DstView::rank >= 1 && DstView::rank <= 3 &&
+                    int(DstView::rank) == int(SrcView::rank),
+                "Kokkos::permute_rows: Views must have the same rank, one to "
+                "three");
+  using execution_space = typename DstView::execution_space;
+  parallel_for("Kokkos::permute_rows",
+               RangePolicy<execution_space>(0, perm.extent(0)),
+               Impl::PermuteRowsFunctor<DstView, SrcView, PermView>{dst, src,
+                                                                   perm});
+}
+
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_IMPL_STATICCRSGRAPH_REORDER_HPP */
@@ -78,5 +78,23 @@ uint32_t find_hash_size(uint32_t size) {
   return hsize;
 }
 
+uint64_t find_hash_size(uint64_t size) {
+  constexpr uint32_t largest_tabulated = 268435399;
+  if (size <= largest_tabulated) {
+    return find_hash_size(static_cast<uint32_t>(size));
+  }
+
+  // Beyond the table keep the average list length at about four and use the
+  // next prime, found by trial division.
+  uint64_t hsize = size / 4 > largest_tabulated ? size / 4 : largest_tabulated;
+  for (hsize |= 1u;; hsize += 2) {
+    bool is_prime = true;
+    for (uint64_t d = 3; d * d <= hsize && is_prime; d += 2) {
+      is_prime = hsize % d != 0;
+    }
+    if (is_prime) return hsize;
+  }
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -41,6 +41,8 @@ auto append_to_label(const ViewCtorProp<P...>& view_ctor_prop,
 
 uint32_t find_hash_size(uint32_t size);
 
+uint64_t find_hash_size(uint64_t size);
+
 template <typename Map>
 struct UnorderedMapRehash {
   using map_type        = Map;
@@ -191,7 +193,7 @@ struct UnorderedMapHistogram {
     const size_type invalid_index = map_type::invalid_index;
 
     uint32_t length     = 0;
-    size_type min_index = ~0u, max_index = 0;
+    size_type min_index = invalid_index, max_index = 0;
     for (size_type curr = m_map.m_hash_lists(i); curr != invalid_index;
          curr           = m_map.m_next_index[curr]) {
       ++length;
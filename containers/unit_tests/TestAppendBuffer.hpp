@@ -0,0 +1,179 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_APPEND_BUFFER_HPP
+#define KOKKOS_TEST_APPEND_BUFFER_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_AppendBuffer.hpp>
+
+#include <algorithm>
+
+namespace Test {
+
+namespace {
+
+// Every appended value must show up exactly once after compact().
+template <typename View>
+void check_each_once(const View& values, unsigned n) {
+  ASSERT_EQ(values.extent(0), n);
+  auto h_values = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      values);
+  std::sort(h_values.data(), h_values.data() + h_values.size());
+  for (unsigned i = 0; i < n; ++i) ASSERT_EQ(h_values(i), i);
+}
+
+template <typename Device>
+void test_append_buffer_emplace_back(unsigned n) {
+  using execution_space = typename Device::execution_space;
+  using buffer_type     = Kokkos::Experimental::AppendBuffer<unsigned, Device>;
+  using token_type      = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+
+  token_type token;
+  buffer_type buffer("append", 64, 4 * n, token.size());
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_EQ(buffer.chunk_size(), 64u);
+
+  // Too small: the appends have to fail and report it.
+  buffer.reserve(n / 4);
+  Kokkos::View<unsigned, Device> failed("failed");
+  Kokkos::View<bool*, Device> pending("pending", n);
+  Kokkos::deep_copy(pending, true);
+  auto append = [&]() {
+    Kokkos::deep_copy(failed, 0u);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space>(0, n),
+        KOKKOS_LAMBDA(unsigned i) {
+          if (!pending(i)) return;
+          const int slot = token.acquire();
+          if (buffer.emplace_back(slot, i) == buffer_type::invalid_index)
+            Kokkos::atomic_inc(&failed());
+          else
+            pending(i) = false;
+          token.release(slot);
+        });
+    unsigned h_failed;
+    Kokkos::deep_copy(h_failed, failed);
+    return h_failed;
+  };
+  const unsigned num_failed = append();
+  EXPECT_GT(num_failed, 0u);
+  EXPECT_TRUE(buffer.overflowed());
+  EXPECT_EQ(buffer.size(), n - num_failed);
+  EXPECT_LE(buffer.size(), buffer.capacity());
+
+  // Growing keeps what is already there; re-run only the failed appends.
+  buffer.reserve(n + token.size() * buffer.chunk_size());
+  buffer.reset_overflow();
+  EXPECT_FALSE(buffer.overflowed());
+  EXPECT_EQ(buffer.size(), n - num_failed);
+  EXPECT_EQ(append(), 0u);
+  EXPECT_FALSE(buffer.overflowed());
+  EXPECT_EQ(buffer.size(), n);
+  check_each_once(buffer.compact("values"), n);
+
+  // Start over to append everything at once.
+  buffer.clear();
+  EXPECT_EQ(buffer.size(), 0u);
+  Kokkos::deep_copy(pending, true);
+  EXPECT_EQ(append(), 0u);
+  EXPECT_FALSE(buffer.overflowed());
+  EXPECT_EQ(buffer.size(), n);
+  check_each_once(buffer.compact("values"), n);
+
+  // Elements are reachable through the returned indices.
+  Kokkos::View<unsigned*, Device> indices("indices", n);
+  buffer.clear();
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, n), KOKKOS_LAMBDA(unsigned i) {
+        const int slot = token.acquire();
+        indices(i)     = buffer.emplace_back(slot, i);
+        token.release(slot);
+      });
+  unsigned errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, n),
+      KOKKOS_LAMBDA(unsigned i, unsigned& err) {
+        if (buffer(indices(i)) != i) ++err;
+      },
+      errors);
+  EXPECT_EQ(errors, 0u);
+}
+
+template <typename Device>
+void test_append_buffer_team(unsigned league_size) {
+  using execution_space = typename Device::execution_space;
+  using buffer_type     = Kokkos::Experimental::AppendBuffer<unsigned, Device>;
+  using policy_type     = Kokkos::TeamPolicy<execution_space>;
+  using member_type     = typename policy_type::member_type;
+  using token_type      = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+
+  // Team t appends the t % 17 values [t * 16, t * 16 + t % 17).  A block that
+  // does not fit the rest of a chunk starts a new one, so leave headroom.
+  constexpr unsigned block = 16;
+  token_type token;
+  buffer_type buffer("append team", 64, 2 * league_size * block, token.size());
+  buffer.reserve(2 * league_size * block);
+  Kokkos::parallel_for(
+      policy_type(league_size, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const member_type& team) {
+        const unsigned t = team.league_rank();
+        const unsigned n = t % (block + 1);
+        size_t first     = 0;
+        Kokkos::single(
+            Kokkos::PerTeam(team),
+            [&](size_t& f) {
+              const int slot = token.acquire();
+              f              = buffer.reserve_back(slot, n);
+              token.release(slot);
+            },
+            first);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, n),
+                             [&](unsigned j) {
+                               buffer(first + j) = t * block + j;
+                             });
+      });
+  EXPECT_FALSE(buffer.overflowed());
+
+  auto values   = buffer.compact();
+  auto h_values = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      values);
+  std::sort(h_values.data(), h_values.data() + h_values.size());
+  size_t k = 0;
+  for (unsigned t = 0; t < league_size; ++t)
+    for (unsigned j = 0; j < t % (block + 1); ++j, ++k) {
+      ASSERT_LT(k, h_values.extent(0));
+      ASSERT_EQ(h_values(k), t * block + j);
+    }
+  EXPECT_EQ(k, h_values.extent(0));
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, append_buffer_emplace_back) {
+  test_append_buffer_emplace_back<TEST_EXECSPACE>(100000);
+}
+
+TEST(TEST_CATEGORY, append_buffer_team) {
+  test_append_buffer_team<TEST_EXECSPACE>(1000);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_APPEND_BUFFER_HPP
@@ -150,10 +150,10 @@ struct TestBitsetAny {
 };
 }  // namespace Impl
 
-template <typename Device>
+template <typename Device, typename SizeType = unsigned>
 void test_bitset() {
-  using bitset_type       = Kokkos::Bitset<Device>;
-  using const_bitset_type = Kokkos::ConstBitset<Device>;
+  using bitset_type       = Kokkos::Bitset<Device, SizeType>;
+  using const_bitset_type = Kokkos::ConstBitset<Device, SizeType>;
 
   {
     unsigned ts = 100u;
@@ -243,6 +243,10 @@ void test_bitset() {
 
 TEST(TEST_CATEGORY, bitset) { test_bitset<TEST_EXECSPACE>(); }
 
+TEST(TEST_CATEGORY, bitset_64bit_index) {
+  test_bitset<TEST_EXECSPACE, uint64_t>();
+}
+
 TEST(TEST_CATEGORY, bitset_default_constructor_no_alloc) {
   using namespace Kokkos::Test::Tools;
   listen_tool_events(Config::DisableAll(), Config::EnableAllocs());
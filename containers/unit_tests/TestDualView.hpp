@@ -21,6 +21,8 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstdio>
+#include <algorithm>
+#include <vector>
 #include <Kokkos_Timer.hpp>
 #include <Kokkos_DualView.hpp>
 
@@ -666,6 +668,113 @@ TEST(TEST_CATEGORY, dualview_sequential_host_init) {
   ASSERT_EQ(dv.d_view.size(), 3u);
   ASSERT_EQ(dv.h_view.size(), 3u);
 }
+
+// Marks a few rows as modified after changing all of them, so on a DualView
+// with separate host and device allocations only the marked blocks arrive.
+template <typename DualViewType>
+void test_dualview_modified_rows(bool contiguous_rows) {
+  using exec_space = typename DualViewType::t_dev::execution_space;
+  constexpr bool two_sides =
+      !DualViewType::impl_dualview_is_single_device::value;
+  const int n = 1000, m = 3;
+
+  DualViewType dv("dv", n, m);
+  const bool copies  = dv.h_view.data() != dv.d_view.data();
+  const bool tracked = copies && contiguous_rows;
+  dv.enable_range_tracking(16);
+  EXPECT_EQ(dv.range_tracking_enabled(), tracked);
+
+  auto check_device = [&](auto&& expected) {
+    auto d = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                 dv.d_view);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < m; ++j) ASSERT_EQ(d(i, j), expected(i, j));
+  };
+
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < m; ++j) dv.h_view(i, j) = i * m + j + 1;
+  dv.modify_host(Kokkos::make_pair(100, 110));
+  dv.modify_host(Kokkos::make_pair(500, 501));
+  EXPECT_EQ(dv.need_sync_device(), two_sides);
+  dv.sync_device(exec_space());
+  exec_space().fence();
+  EXPECT_FALSE(dv.need_sync_device());
+  check_device([&](int i, int j) {
+    const bool marked = (96 <= i && i < 112) || (496 <= i && i < 512);
+    return !tracked || marked ? i * m + j + 1 : 0;
+  });
+
+  // A plain modify marks everything again.
+  dv.modify_host(Kokkos::make_pair(0, 1));
+  dv.modify_host();
+  dv.sync_device();
+  check_device([&](int i, int j) { return i * m + j + 1; });
+
+  // Ranges marked on the device come back to the host.
+  auto d_view = dv.d_view;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, 20), KOKKOS_LAMBDA(int i) {
+        for (int j = 0; j < m; ++j) d_view(i, j) = -1;
+      });
+  dv.modify_device(Kokkos::make_pair(0, 20));
+  dv.sync_host();
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < m; ++j)
+      ASSERT_EQ(dv.h_view(i, j), i < 20 ? -1 : i * m + j + 1);
+
+  // Tracking follows the new allocation.
+  dv.resize(2 * n, m);
+  EXPECT_EQ(dv.range_tracking_enabled(), tracked);
+}
+
+// The block bookkeeping behind the partial sync, which host-only builds
+// never reach through a DualView.
+TEST(TEST_CATEGORY, dualview_modified_row_blocks) {
+  using rows_type = Kokkos::pair<size_t, size_t>;
+  const size_t rows_per_block = 16, extent = 1999;
+  const size_t num_blocks = (extent + rows_per_block - 1) / rows_per_block;
+  std::vector<uint64_t> bits((num_blocks + 63) / 64, 0);
+
+  auto runs = [&]() {
+    std::vector<rows_type> result;
+    Kokkos::Impl::dualview_for_each_row_run(
+        bits.data(), rows_per_block, extent,
+        [&](const rows_type& rows) { result.push_back(rows); });
+    return result;
+  };
+  auto mark = [&](size_t first, size_t last) {
+    Kokkos::Impl::dualview_mark_row_blocks(bits.data(), rows_per_block,
+                                           extent, rows_type(first, last));
+  };
+
+  EXPECT_TRUE(runs().empty());
+
+  // Ranges are widened to whole blocks; adjacent blocks form one run, the
+  // last one is clipped to the extent, and empty ranges mark nothing.
+  mark(100, 110);
+  mark(500, 501);
+  mark(510, 530);
+  mark(1990, 5000);
+  mark(300, 300);
+  const std::vector<rows_type> expected = {
+      {96, 112}, {496, 544}, {1984, 1999}};
+  EXPECT_EQ(runs(), expected);
+
+  // Blocks straddling a word of the bitmap.
+  std::fill(bits.begin(), bits.end(), 0);
+  mark(63 * rows_per_block, 65 * rows_per_block - 1);
+  const std::vector<rows_type> straddling = {
+      {63 * rows_per_block, 65 * rows_per_block}};
+  EXPECT_EQ(runs(), straddling);
+}
+
+TEST(TEST_CATEGORY, dualview_modified_rows) {
+  test_dualview_modified_rows<
+      Kokkos::DualView<int**, Kokkos::LayoutRight, TEST_EXECSPACE>>(true);
+  test_dualview_modified_rows<
+      Kokkos::DualView<int**, Kokkos::LayoutLeft, TEST_EXECSPACE>>(false);
+}
+
 }  // anonymous namespace
 }  // namespace Test
 
@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <set>
 #include <vector>
 
 #define KOKKOS_IMPL_DO_NOT_WARN_INCLUDE_STATIC_CRS_GRAPH
@@ -249,6 +252,159 @@ void run_test_graph4() {
                               Kokkos::MemoryUnmanaged>));
 }
 
+// Build a graph from an edge list, transpose it and compare both against
+// reference adjacency lists.
+template <class Space>
+void run_test_graph_coo_transpose(unsigned N) {
+  using dView     = Kokkos::StaticCrsGraph<unsigned, Space>;
+  using edge_view = Kokkos::View<unsigned*, Space>;
+
+  std::vector<unsigned> src, dst;
+  std::vector<std::vector<unsigned> > out_edges(N), in_edges(N);
+  for (unsigned i = 0; i < N; ++i) {
+    // a few hubs with many edges, the rest with a handful
+    const unsigned degree = (i % 101 == 0) ? N / 2 : i % 5;
+    for (unsigned j = 0; j < degree; ++j) {
+      const unsigned k = (i * 7919u + j * 104729u) % N;
+      src.push_back(i);
+      dst.push_back(k);
+      out_edges[i].push_back(k);
+      in_edges[k].push_back(i);
+    }
+  }
+  const size_t nnz = src.size();
+  edge_view d_src("src", nnz), d_dst("dst", nnz);
+  Kokkos::deep_copy(
+      d_src, Kokkos::View<unsigned*, Kokkos::HostSpace>(src.data(), nnz));
+  Kokkos::deep_copy(
+      d_dst, Kokkos::View<unsigned*, Kokkos::HostSpace>(dst.data(), nnz));
+
+  auto check = [](const dView& graph,
+                  const std::vector<std::vector<unsigned> >& expected) {
+    auto hx = Kokkos::create_mirror(graph);
+    ASSERT_EQ(hx.numRows(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(hx.row_map(i + 1) - hx.row_map(i), expected[i].size());
+      for (size_t j = 0; j < expected[i].size(); ++j)
+        ASSERT_EQ(hx.entries(hx.row_map(i) + j), expected[i][j]);
+    }
+  };
+
+  dView graph = Kokkos::create_staticcrsgraph<dView>("graph", N, d_src, d_dst);
+  check(graph, out_edges);
+
+  dView transposed;
+  Kokkos::transpose_crs(transposed, graph);
+  check(transposed, in_edges);
+}
+
+// A shuffled nx by nx grid plus a path of five vertices and an isolated
+// vertex: reordering must give a permutation that keeps the edges and
+// brings the bandwidth of the grid down to about nx.
+template <class Space>
+void run_test_graph_reorder(unsigned nx) {
+  using dView     = Kokkos::StaticCrsGraph<unsigned, Space>;
+  using edge_view = Kokkos::View<unsigned*, Space>;
+  using perm_view = Kokkos::View<unsigned*, Space>;
+
+  const unsigned n_grid = nx * nx;
+  const unsigned N      = n_grid + 6;
+  auto label            = [&](unsigned i) {
+    return i < n_grid ? (i * 7919u) % n_grid : i;
+  };
+
+  std::vector<unsigned> src, dst;
+  std::set<std::pair<unsigned, unsigned> > edges;
+  auto add_edge = [&](unsigned i, unsigned j) {
+    for (auto e : {std::make_pair(label(i), label(j)),
+                   std::make_pair(label(j), label(i))}) {
+      src.push_back(e.first);
+      dst.push_back(e.second);
+      edges.insert(e);
+    }
+  };
+  for (unsigned y = 0; y < nx; ++y)
+    for (unsigned x = 0; x < nx; ++x) {
+      if (x + 1 < nx) add_edge(y * nx + x, y * nx + x + 1);
+      if (y + 1 < nx) add_edge(y * nx + x, (y + 1) * nx + x);
+    }
+  for (unsigned i = n_grid; i + 2 < N; ++i) add_edge(i, i + 1);
+
+  const size_t nnz = src.size();
+  edge_view d_src("src", nnz), d_dst("dst", nnz);
+  Kokkos::deep_copy(
+      d_src, Kokkos::View<unsigned*, Kokkos::HostSpace>(src.data(), nnz));
+  Kokkos::deep_copy(
+      d_dst, Kokkos::View<unsigned*, Kokkos::HostSpace>(dst.data(), nnz));
+  dView graph = Kokkos::create_staticcrsgraph<dView>("graph", N, d_src, d_dst);
+
+  perm_view perm = Kokkos::rcm_ordering(graph);
+  auto h_perm = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), perm);
+  ASSERT_EQ(h_perm.extent(0), N);
+  std::vector<unsigned> inverse(N, N);
+  for (unsigned i = 0; i < N; ++i) {
+    ASSERT_LT(h_perm(i), N);
+    ASSERT_EQ(inverse[h_perm(i)], N);
+    inverse[h_perm(i)] = i;
+  }
+
+  auto h_permuted = Kokkos::create_mirror(Kokkos::permute_graph(graph, perm));
+  ASSERT_EQ(h_permuted.numRows(), N);
+  ASSERT_EQ(h_permuted.entries.extent(0), nnz);
+  unsigned bandwidth = 0;
+  for (unsigned i = 0; i < N; ++i)
+    for (auto j = h_permuted.row_map(i); j < h_permuted.row_map(i + 1); ++j) {
+      const unsigned k = h_permuted.entries(j);
+      ASSERT_EQ(edges.count(std::make_pair(h_perm(i), h_perm(k))), 1u);
+      bandwidth = std::max(bandwidth, i > k ? i - k : k - i);
+    }
+  EXPECT_LE(bandwidth, 2 * nx);
+
+  // Along curves through the grid points.  With a power of two points per
+  // side every point falls into its own cell of the curve, so consecutive
+  // points on a Hilbert curve are neighbors and Morton order visits the
+  // grid by 2 x 2 blocks.
+  Kokkos::View<double**, Kokkos::LayoutRight, Space> coords("coords", n_grid,
+                                                            2);
+  auto h_coords = Kokkos::create_mirror_view(coords);
+  for (unsigned i = 0; i < n_grid; ++i) {
+    h_coords(label(i), 0) = i % nx;
+    h_coords(label(i), 1) = i / nx;
+  }
+  Kokkos::deep_copy(coords, h_coords);
+
+  Kokkos::View<double**, Kokkos::LayoutRight, Space> sorted("sorted", n_grid,
+                                                            2);
+  auto h_sorted = Kokkos::create_mirror_view(sorted);
+  Kokkos::permute_rows(sorted, coords, Kokkos::hilbert_ordering(coords));
+  Kokkos::deep_copy(h_sorted, sorted);
+  const bool aligned = (nx & (nx - 1)) == 0;
+  for (unsigned i = 0; aligned && i + 1 < n_grid; ++i)
+    ASSERT_EQ(std::abs(h_sorted(i + 1, 0) - h_sorted(i, 0)) +
+                  std::abs(h_sorted(i + 1, 1) - h_sorted(i, 1)),
+              1.0);
+
+  Kokkos::permute_rows(sorted, coords, Kokkos::morton_ordering(coords));
+  Kokkos::deep_copy(h_sorted, sorted);
+  for (unsigned i = 0; aligned && i < n_grid; i += 4)
+    for (unsigned j = 1; j < 4; ++j) {
+      ASSERT_EQ(std::floor(h_sorted(i + j, 0) / 2),
+                std::floor(h_sorted(i, 0) / 2));
+      ASSERT_EQ(std::floor(h_sorted(i + j, 1) / 2),
+                std::floor(h_sorted(i, 1) / 2));
+    }
+
+  // rank one: dst(i) == src(perm(i))
+  edge_view labels("labels", N), permuted_labels("permuted_labels", N);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<typename Space::execution_space>(0, N),
+      KOKKOS_LAMBDA(unsigned i) { labels(i) = 3 * i; });
+  Kokkos::permute_rows(permuted_labels, labels, perm);
+  auto h_labels = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      permuted_labels);
+  for (unsigned i = 0; i < N; ++i) ASSERT_EQ(h_labels(i), 3 * h_perm(i));
+}
+
 } /* namespace TestStaticCrsGraph */
 
 TEST(TEST_CATEGORY, staticcrsgraph) {
@@ -267,5 +423,10 @@ TEST(TEST_CATEGORY, staticcrsgraph) {
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 10000);
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 100000);
   TestStaticCrsGraph::run_test_graph4<TEST_EXECSPACE>();
+  TestStaticCrsGraph::run_test_graph_coo_transpose<TEST_EXECSPACE>(1);
+  TestStaticCrsGraph::run_test_graph_coo_transpose<TEST_EXECSPACE>(1000);
+  TestStaticCrsGraph::run_test_graph_coo_transpose<TEST_EXECSPACE>(20000);
+  TestStaticCrsGraph::run_test_graph_reorder<TEST_EXECSPACE>(16);
+  TestStaticCrsGraph::run_test_graph_reorder<TEST_EXECSPACE>(100);
 }
 }  // namespace Test
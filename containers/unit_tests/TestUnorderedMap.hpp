@@ -279,13 +279,13 @@ void test_insert(uint32_t num_nodes, uint32_t num_inserts,
   }
 }
 
-template <typename Device>
+template <typename Device, typename SizeType = uint32_t>
 void test_inserts(uint32_t num_nodes, uint32_t num_inserts,
                   uint32_t num_duplicates, bool near) {
   using key_type        = uint32_t;
   using value_type      = uint32_t;
   using value_view_type = Kokkos::View<value_type *, Device>;
-  using size_type       = uint32_t;
+  using size_type       = SizeType;
   using hasher_type     = typename Kokkos::pod_hash<key_type>;
   using equal_to_type   = typename Kokkos::pod_equal_to<key_type>;
 
@@ -294,10 +294,10 @@ void test_inserts(uint32_t num_nodes, uint32_t num_inserts,
   using noop_type = typename map_op_type::NoOp;
 
   using map_type = Kokkos::UnorderedMap<key_type, value_type, Device,
-                                        hasher_type, equal_to_type>;
+                                        hasher_type, equal_to_type, size_type>;
   using const_map_type =
       Kokkos::UnorderedMap<const key_type, const value_type, Device,
-                           hasher_type, equal_to_type>;
+                           hasher_type, equal_to_type, size_type>;
 
   test_insert<Device, map_type, const_map_type, noop_type>(
       num_nodes, num_inserts, num_duplicates, near);
@@ -406,8 +406,98 @@ TEST(TEST_CATEGORY, UnorderedMap_insert) {
     test_all_insert_ops<TEST_EXECSPACE>(1000, 900, 10, false);
   }
 }
+
+TEST(TEST_CATEGORY, UnorderedMap_insert_64bit_index) {
+  for (int i = 0; i < 50; ++i) {
+    test_inserts<TEST_EXECSPACE, uint64_t>(100000, 90000, 100, true);
+    test_inserts<TEST_EXECSPACE, uint64_t>(100000, 90000, 100, false);
+  }
+}
 #endif
 
+// Inserts many more keys than the initial capacity in a single kernel into a
+// map that grows in place, and checks that the entries stay packed.
+template <typename Device>
+void test_growing_insert(uint32_t num_keys) {
+  using map_type  = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using exec_type = typename Device::execution_space;
+
+  // an existing entry is carried over
+  map_type map;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_type>(0, 1),
+      KOKKOS_LAMBDA(int) { map.insert(num_keys, 1u); });
+  ASSERT_TRUE(map.reserve_growth(8u * num_keys));
+  ASSERT_GE(map.capacity(), 8u * num_keys);
+
+  uint32_t num_failed = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<exec_type>(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t & failed) {
+        // every key twice
+        if (map.insert(i / 2, i / 2 * 2).failed()) ++failed;
+      },
+      num_failed);
+  EXPECT_EQ(num_failed, 0u);
+  EXPECT_FALSE(map.failed_insert());
+  EXPECT_EQ(map.size(), num_keys / 2 + 1);
+
+  auto map_h = Kokkos::create_mirror(map);
+  Kokkos::deep_copy(map_h, map);
+  uint32_t max_index = 0;
+  for (uint32_t i = 0; i < map_h.capacity(); ++i) {
+    if (map_h.valid_at(i)) max_index = i;
+  }
+  // the window doubles, and the bounded search may pass a few blocks
+  EXPECT_LT(max_index, 3u * num_keys);
+  for (uint32_t k = 0; k < num_keys / 2; ++k) {
+    const auto idx = map_h.find(k);
+    ASSERT_TRUE(map_h.valid_at(idx));
+    ASSERT_EQ(map_h.value_at(idx), 2 * k);
+  }
+  EXPECT_EQ(map_h.value_at(map_h.find(num_keys)), 1u);
+}
+
+// Entries erased from a growing map are claimed again by later inserts, so
+// rounds of erasing and inserting the same number of keys stay packed.
+template <typename Device>
+void test_growing_insert_after_erase(uint32_t num_keys) {
+  using map_type  = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using exec_type = typename Device::execution_space;
+
+  map_type map;
+  ASSERT_TRUE(map.reserve_growth(8u * num_keys));
+
+  for (uint32_t round = 0; round < 8; ++round) {
+    const uint32_t first = round * num_keys;
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<exec_type>(0, num_keys),
+        KOKKOS_LAMBDA(uint32_t i) { map.insert(first + i, i); });
+    ASSERT_FALSE(map.failed_insert());
+    ASSERT_EQ(map.size(), num_keys);
+
+    auto map_h = Kokkos::create_mirror(map);
+    Kokkos::deep_copy(map_h, map);
+    uint32_t max_index = 0;
+    for (uint32_t i = 0; i < map_h.capacity(); ++i) {
+      if (map_h.valid_at(i)) max_index = i;
+    }
+    EXPECT_LT(max_index, 3u * num_keys) << "round " << round;
+
+    map.begin_erase();
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<exec_type>(0, num_keys),
+        KOKKOS_LAMBDA(uint32_t i) { map.erase(first + i); });
+    map.end_erase();
+    ASSERT_EQ(map.size(), 0u);
+  }
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_growing_insert) {
+  test_growing_insert<TEST_EXECSPACE>(100000);
+  test_growing_insert_after_erase<TEST_EXECSPACE>(10000);
+}
+
 TEST(TEST_CATEGORY, UnorderedMap_failed_insert) {
   for (int i = 0; i < 1000; ++i) test_failed_insert<TEST_EXECSPACE>(10000);
 }
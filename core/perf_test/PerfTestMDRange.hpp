@@ -14,6 +14,9 @@
 //
 //@HEADER
 
+#include <iostream>
+#include <type_traits>
+
 namespace Test {
 template <class DeviceType, typename ScalarType = double,
           typename TestLayout = Kokkos::LayoutRight>
@@ -73,11 +76,12 @@ struct MultiDimRangePerf3D {
   static double test_multi_index(const unsigned int icount,
                                  const unsigned int jcount,
                                  const unsigned int kcount,
-                                 const unsigned int Ti = 1,
-                                 const unsigned int Tj = 1,
-                                 const unsigned int Tk = 1,
+                                 const unsigned int Ti = 0,
+                                 const unsigned int Tj = 0,
+                                 const unsigned int Tk = 0,
                                  const long iter       = 1) {
     // This test performs multidim range over all dims
+    // Tiles of 0 are chosen by the MDRangePolicy
     view_type Atest("Atest", icount, jcount, kcount);
     view_type Btest("Btest", icount + 2, jcount + 2, kcount + 2);
     using FunctorType =
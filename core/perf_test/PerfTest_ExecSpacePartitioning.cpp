@@ -18,6 +18,8 @@
 #include <benchmark/benchmark.h>
 #include "PerfTest_Category.hpp"
 
+#include <thread>
+
 namespace Test {
 
 namespace {
@@ -695,4 +697,69 @@ BENCHMARK(OverlapTeamPolicy)
     ->ArgNames({"N", "M", "R"})
     ->Args({20, 1'000'000, 10});
 
+#ifdef KOKKOS_ENABLE_OPENMP
+namespace {
+
+// Run the same memory bound kernel on every instance, each launched from
+// its own host thread, and return the time until all of them are done.
+double time_concurrent_partitions(std::vector<Kokkos::OpenMP> const& instances,
+                                  int N, int M, int R) {
+  std::vector<Kokkos::View<double**, Kokkos::OpenMP>> views;
+  for (auto const& instance : instances) {
+    // First touch by the instance places the data near its threads
+    views.emplace_back(
+        Kokkos::view_alloc(instance, Kokkos::WithoutInitializing, "A"), N, M);
+    Kokkos::deep_copy(instance, views.back(), 1.0);
+  }
+  Kokkos::fence();
+
+  Kokkos::Timer timer;
+  std::vector<std::thread> threads;
+  for (size_t p = 0; p < instances.size(); ++p) {
+    threads.emplace_back([&, p]() {
+      auto a = views[p];
+      Kokkos::parallel_for(
+          "default_exec::overlap_topology::kernel",
+          Kokkos::RangePolicy<Kokkos::OpenMP>(instances[p], 0, N),
+          [=](const int i) {
+            for (int r = 0; r < R; r++)
+              for (int j = 0; j < M; j++) a(i, j) += 1.0;
+          });
+      instances[p].fence();
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  return timer.seconds();
+}
+
+}  // namespace
+
+static void OverlapTopologyPartition(benchmark::State& state) {
+  int N = state.range(0);
+  int M = state.range(1);
+  int R = state.range(2);
+
+  Kokkos::OpenMP space;
+  std::vector<Kokkos::OpenMP> numa_instances =
+      Kokkos::Experimental::partition_space_by_numa(space);
+  // The same number of instances, split by thread count only
+  std::vector<Kokkos::OpenMP> weight_instances =
+      Kokkos::Experimental::partition_space(
+          space, std::vector<int>(numa_instances.size(), 1));
+
+  for (auto _ : state) {
+    double time_weights = time_concurrent_partitions(weight_instances, N, M, R);
+    double time_numa    = time_concurrent_partitions(numa_instances, N, M, R);
+
+    state.counters["Partitions"]   = benchmark::Counter(numa_instances.size());
+    state.counters["Time Weights"] = benchmark::Counter(time_weights);
+    state.counters["Time NUMA"]    = benchmark::Counter(time_numa);
+  }
+}
+
+BENCHMARK(OverlapTopologyPartition)
+    ->ArgNames({"N", "M", "R"})
+    ->Args({2'000, 10'000, 10});
+#endif
+
 }  // namespace Test
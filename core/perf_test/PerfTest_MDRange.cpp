@@ -0,0 +1,70 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+#include "PerfTestMDRange.hpp"
+
+namespace Test {
+
+// 3D stencil with the default tiles chosen by MDRangePolicy (tiles of 0)
+// compared to fixed tiles of two points in the non-contiguous dimensions and
+// the full extent in the contiguous one, the host default before tiles were
+// sized from the cache hierarchy.
+template <class Layout>
+static void MDRange_Stencil3D(benchmark::State& state) {
+  using execution_space = Kokkos::DefaultExecutionSpace;
+
+  if (!Kokkos::SpaceAccessibility<execution_space,
+                                  Kokkos::HostSpace>::accessible) {
+    state.SkipWithError("fixed tiles are only meaningful on host backends");
+    return;
+  }
+
+  const unsigned int n  = state.range(0);
+  const bool fixed_tile = state.range(1);
+  const bool right      = std::is_same_v<Layout, Kokkos::LayoutRight>;
+
+  const unsigned int ti = fixed_tile ? (right ? 2 : n) : 0;
+  const unsigned int tj = fixed_tile ? 2 : 0;
+  const unsigned int tk = fixed_tile ? (right ? n : 2) : 0;
+
+  for (auto _ : state) {
+    const double time =
+        MultiDimRangePerf3D<execution_space, double, Layout>::test_multi_index(
+            n, n, n, ti, tj, tk);
+
+    state.SetIterationTime(time);
+    state.counters["Points/s"] = benchmark::Counter(
+        static_cast<double>(n) * n * n / time, benchmark::Counter::kDefaults,
+        benchmark::Counter::OneK::kIs1000);
+  }
+}
+
+BENCHMARK(MDRange_Stencil3D<Kokkos::LayoutRight>)
+    ->ArgNames({"N", "FixedTile"})
+    ->ArgsProduct({{64, 128, 256}, {0, 1}})
+    ->UseManualTime()
+    ->Iterations(5);
+
+BENCHMARK(MDRange_Stencil3D<Kokkos::LayoutLeft>)
+    ->ArgNames({"N", "FixedTile"})
+    ->ArgsProduct({{64, 128, 256}, {0, 1}})
+    ->UseManualTime()
+    ->Iterations(5);
+
+}  // namespace Test
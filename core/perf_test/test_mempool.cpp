@@ -243,6 +243,77 @@ static void Mempool_Alloc_Dealloc(benchmark::State& state) {
   }
 }
 
+// Every thread repeatedly allocates a few small blocks and frees them again,
+// the pattern of many short-lived allocations from all threads at once.
+struct ContentionFunctor {
+  using token_type = Kokkos::Experimental::UniqueToken<ExecSpace>;
+
+  enum : unsigned { live = 8 };
+
+  token_type token;
+  MemoryPool pool;
+  unsigned repeat;
+  bool cached;
+
+  ContentionFunctor(size_t total_alloc_size, unsigned classes_per_doubling,
+                    bool arg_cached, unsigned arg_repeat)
+      : token(),
+        pool(MemorySpace(), total_alloc_size, 64, 4096, 1 << 16,
+             classes_per_doubling, arg_cached ? token.size() : 0),
+        repeat(arg_repeat),
+        cached(arg_cached) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i, long& failed) const noexcept {
+    const int slot = token.acquire();
+    void* ptrs[live];
+    for (unsigned k = 0; k < repeat; ++k) {
+      for (unsigned j = 0; j < live; ++j) {
+        const unsigned size = 33 + ((i + j * 37 + k * 101) % 224);
+        ptrs[j] = cached ? pool.allocate_cached(slot, size, 8)
+                         : pool.allocate(size, 8);
+        if (nullptr == ptrs[j]) ++failed;
+      }
+      for (unsigned j = 0; j < live; ++j) {
+        const unsigned size = 33 + ((i + j * 37 + k * 101) % 224);
+        if (cached)
+          pool.deallocate_cached(slot, ptrs[j], size);
+        else
+          pool.deallocate(ptrs[j], size);
+      }
+    }
+    token.release(slot);
+  }
+};
+
+static void Mempool_Contention(benchmark::State& state) {
+  long total_alloc_size =
+      get_parameter("--alloc_size=", static_cast<long>(state.range(0)));
+  int classes      = get_parameter("--classes=", state.range(1));
+  int cached       = get_parameter("--cached=", state.range(2));
+  int number_tasks = get_parameter("--tasks=", state.range(3));
+  int repeat_inner = get_parameter("--repeat_inner=", state.range(4));
+
+  ContentionFunctor functor(total_alloc_size, classes, cached, repeat_inner);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+
+    long failed = 0;
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<ExecSpace>(0, number_tasks),
+                            functor, failed);
+    if (failed) {
+      Kokkos::abort("contention ");
+    }
+
+    state.SetIterationTime(timer.seconds());
+    state.counters[KokkosBenchmark::benchmark_fom("cycle ops per second")] =
+        benchmark::Counter(2.0 * ContentionFunctor::live * number_tasks *
+                               repeat_inner,
+                           benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
 const std::vector<std::string> ARG_NAMES = {
     "total_alloc_size", "min_superblock_size", "chunk_span",
     "fill_stride",      "fill_level",          "repeat_inner"};
@@ -254,3 +325,12 @@ BENCHMARK(Mempool_Alloc_Dealloc)
     ->ArgNames(ARG_NAMES)
     ->Args(ARGS)
     ->UseManualTime();
+
+BENCHMARK(Mempool_Contention)
+    ->ArgNames({"total_alloc_size", "classes_per_doubling", "cached", "tasks",
+                "repeat_inner"})
+    ->Args({16'000'000, 1, 0, 100'000, 10})
+    ->Args({16'000'000, 1, 1, 100'000, 10})
+    ->Args({16'000'000, 4, 0, 100'000, 10})
+    ->Args({16'000'000, 4, 1, 100'000, 10})
+    ->UseManualTime();
@@ -968,6 +968,9 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
   const Policy m_policy;
 
  public:
+  const FunctorType& get_functor() const { return m_functor; }
+  const Policy& get_policy() const { return m_policy; }
+
   void execute_range(const Member i_chunk) const {
     const auto r = get_chunk_range(i_chunk, m_policy.begin(),
                                    m_policy.chunk_size(), m_policy.end());
@@ -1029,12 +1032,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
         m_policy(Policy(0, arg_policy.m_num_tiles).set_chunk_size(1)) {}
   template <typename Policy, typename Functor>
   static int max_tile_size_product(const Policy &, const Functor &) {
-    /**
-     * 1024 here is just our guess for a reasonable max tile size,
-     * it isn't a hardware constraint. If people see a use for larger
-     * tile size products, we're happy to change this.
-     */
-    return 1024;
+    return host_max_tile_size_product();
   }
 };
 }  // namespace Impl
@@ -1242,12 +1240,7 @@ class ParallelReduce<CombinedFunctorReducerType,
 
   template <typename Policy, typename Functor>
   static int max_tile_size_product(const Policy &, const Functor &) {
-    /**
-     * 1024 here is just our guess for a reasonable max tile size,
-     * it isn't a hardware constraint. If people see a use for larger
-     * tile size products, we're happy to change this.
-     */
-    return 1024;
+    return host_max_tile_size_product();
   }
 };
 }  // namespace Impl
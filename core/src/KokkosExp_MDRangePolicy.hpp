@@ -28,6 +28,7 @@ static_assert(false,
 #include <Kokkos_Rank.hpp>
 #include <Kokkos_Array.hpp>
 #include <impl/KokkosExp_Host_IterateTile.hpp>
+#include <impl/Kokkos_CPUDiscovery.hpp>
 #include <Kokkos_ExecPolicy.hpp>
 #include <type_traits>
 #include <cmath>
@@ -139,8 +140,17 @@ struct TileSizeProperties {
   int default_largest_tile_size;
   int default_tile_size;
   int max_total_tile_size;
+  // Data cache sizes used to pick default tiles on host backends, 0 if the
+  // default tiles should not depend on the cache hierarchy.
+  int l1_cache_size = 0;
+  int l2_cache_size = 0;
 };
 
+// Working set assumed per iteration point when sizing host tiles: three
+// double precision arrays, e.g. the input, output and coefficients of a
+// stencil.
+constexpr int host_tile_bytes_per_point = 3 * sizeof(double);
+
 template <typename ExecutionSpace>
 TileSizeProperties get_tile_size_properties(const ExecutionSpace&) {
   // Host settings
@@ -149,9 +159,21 @@ TileSizeProperties get_tile_size_properties(const ExecutionSpace&) {
   properties.default_largest_tile_size = 0;
   properties.default_tile_size         = 2;
   properties.max_total_tile_size       = std::numeric_limits<int>::max();
+  if constexpr (SpaceAccessibility<ExecutionSpace, HostSpace>::accessible) {
+    properties.l1_cache_size = host_data_cache_size(1);
+    properties.l2_cache_size = host_data_cache_size(2);
+  }
   return properties;
 }
 
+// Upper bound for the product of host tile dimensions, used by every host
+// backend as the search space of the MDRangePolicy tuner.  Tiles whose
+// working set does not fit in L2 are not worth exploring; 1024 points, the
+// former fixed bound, is kept as a floor when the cache size is unknown.
+inline int host_max_tile_size_product() {
+  return std::max(1024, host_data_cache_size(2) / host_tile_bytes_per_point);
+}
+
 }  // namespace Impl
 
 // multi-dimensional iteration pattern
@@ -332,6 +354,11 @@ struct MDRangePolicy<P, Properties...>
   bool impl_tune_tile_size() const { return m_tune_tile_size; }
 
   tile_type tile_size_recommended() const {
+    auto properties = Impl::get_tile_size_properties(m_space);
+    if (properties.l2_cache_size > 0 && properties.l1_cache_size > 0) {
+      return cache_aware_tiles(tile_type{}, properties);
+    }
+
     tile_type rec_tile_sizes = {};
 
     for (std::size_t i = 0; i < rec_tile_sizes.size(); ++i) {
@@ -369,7 +396,80 @@ struct MDRangePolicy<P, Properties...>
                : properties.default_largest_tile_size;
   }
 
+  // Picks the tiles the user left unspecified from the data cache sizes: the
+  // contiguous dimension is kept whole as long as it fits in L1, and the
+  // other dimensions are grown evenly until a tile fills half of L2, while
+  // leaving enough tiles to keep every thread busy.
+  tile_type cache_aware_tiles(
+      const tile_type& user_tile,
+      const Impl::TileSizeProperties& properties) const {
+    using size_type = array_index_type;
+
+    constexpr int bytes_per_point = Impl::host_tile_bytes_per_point;
+
+    const int inner = (inner_direction == Iterate::Right) ? rank - 1 : 0;
+    const int outer = (inner_direction == Iterate::Right) ? -1 : rank;
+    const int step  = (inner_direction == Iterate::Right) ? -1 : 1;
+
+    const auto extent = [&](int i) {
+      return std::max<size_type>(m_upper[i] - m_lower[i], 1);
+    };
+
+    tile_type tile = user_tile;
+    if (tile[inner] <= 0) {
+      const size_type length     = extent(inner);
+      const size_type max_length =
+          std::max(properties.l1_cache_size / bytes_per_point, 1);
+      const size_type num_chunks = (length + max_length - 1) / max_length;
+
+      tile[inner] = (length + num_chunks - 1) / num_chunks;
+    }
+
+    const size_type max_points = std::max<size_type>(
+        properties.l2_cache_size / 2 / bytes_per_point / tile[inner], 1);
+    const size_type min_num_tiles = 4 * m_space.concurrency();
+
+    // number of tiles if dimension grown was twice as large
+    const auto num_tiles = [&](int grown) {
+      size_type n = 1;
+      for (int i = 0; i < rank; ++i) {
+        const size_type t = (i == grown) ? 2 * tile[i] : tile[i];
+        n *= (extent(i) + t - 1) / t;
+      }
+      return n;
+    };
+
+    size_type points = 1;
+    for (int i = inner + step; i != outer; i += step) {
+      if (tile[i] <= 0) tile[i] = 1;
+      points *= tile[i];
+    }
+    for (bool grown = true; grown;) {
+      grown = false;
+      for (int i = inner + step; i != outer; i += step) {
+        if (user_tile[i] <= 0 && tile[i] < extent(i) &&
+            2 * points <= max_points && num_tiles(i) >= min_num_tiles) {
+          tile[i] *= 2;
+          points *= 2;
+          grown = true;
+        }
+      }
+    }
+    return tile;
+  }
+
   void init_helper(Impl::TileSizeProperties properties) {
+    if (properties.l2_cache_size > 0 && properties.l1_cache_size > 0) {
+      for (int i = 0; i < rank; ++i) {
+        if (m_tile[i] <= 0) {
+          m_tune_tile_size = true;
+          m_tile           = cache_aware_tiles(m_tile, properties);
+          break;
+        }
+      }
+    }
+
+    m_num_tiles      = 1;
     m_prod_tile_dims = 1;
     int increment    = 1;
     int rank_start   = 0;
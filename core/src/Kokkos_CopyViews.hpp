@@ -26,6 +26,7 @@ static_assert(false,
 #include <Kokkos_Parallel.hpp>
 #include <KokkosExp_MDRangePolicy.hpp>
 #include <Kokkos_Layout.hpp>
+#include <Kokkos_Half.hpp>
 #include <impl/Kokkos_HostSpace_ZeroMemset.hpp>
 
 //----------------------------------------------------------------------------
@@ -48,6 +49,45 @@ struct ViewFillLayoutSelector<Kokkos::LayoutRight> {
   static const Kokkos::Iterate iterate = Kokkos::Iterate::Right;
 };
 
+// Tiles of the MDRangePolicy copying into or filling a View with the given
+// layout.  LayoutTiled Views are walked one layout tile per policy tile and
+// LayoutAoSoA Views one vector block per tile of index 0, as long as the
+// backend accepts tiles that large.  Zero leaves the choice to the policy.
+template <class Layout, int Rank>
+struct ViewCopyTiles {
+  int64_t value[Rank] = {};
+
+  template <class ExecSpace>
+  explicit ViewCopyTiles(const ExecSpace&) {}
+};
+
+template <size_t... TileDims, int Rank>
+struct ViewCopyTiles<Kokkos::Experimental::LayoutTiled<TileDims...>, Rank> {
+  static_assert(sizeof...(TileDims) == Rank);
+
+  int64_t value[Rank] = {};
+
+  template <class ExecSpace>
+  explicit ViewCopyTiles(const ExecSpace& space) {
+    constexpr size_t tile_size = (size_t(1) * ... * TileDims);
+    if (tile_size <= size_t(get_tile_size_properties(space).max_threads)) {
+      int r = 0;
+      ((value[r++] = TileDims), ...);
+    }
+  }
+};
+
+template <size_t VectorLength, int Rank>
+struct ViewCopyTiles<Kokkos::Experimental::LayoutAoSoA<VectorLength>, Rank> {
+  int64_t value[Rank] = {};
+
+  template <class ExecSpace>
+  explicit ViewCopyTiles(const ExecSpace& space) {
+    if (VectorLength <= size_t(get_tile_size_properties(space).max_threads))
+      value[0] = VectorLength;
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -72,6 +112,7 @@ struct ViewFill<ViewType, Layout, ExecSpace, 1, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
+    Impl::GraphCaptureBypass bypass_capture;
     Kokkos::parallel_for("Kokkos::ViewFill-1D",
                          policy_type(space, 0, a.extent(0)), *this);
   }
@@ -93,9 +134,12 @@ struct ViewFill<ViewType, Layout, ExecSpace, 2, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
-    Kokkos::parallel_for("Kokkos::ViewFill-2D",
-                         policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}),
-                         *this);
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewType::array_layout, 2> tiles(space);
+    Kokkos::parallel_for(
+        "Kokkos::ViewFill-2D",
+        policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}, tiles.value),
+        *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -115,10 +159,13 @@ struct ViewFill<ViewType, Layout, ExecSpace, 3, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
-    Kokkos::parallel_for(
-        "Kokkos::ViewFill-3D",
-        policy_type(space, {0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)}),
-        *this);
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewType::array_layout, 3> tiles(space);
+    Kokkos::parallel_for("Kokkos::ViewFill-3D",
+                         policy_type(space, {0, 0, 0},
+                                     {a.extent(0), a.extent(1), a.extent(2)},
+                                     tiles.value),
+                         *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -140,10 +187,13 @@ struct ViewFill<ViewType, Layout, ExecSpace, 4, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewType::array_layout, 4> tiles(space);
     Kokkos::parallel_for(
         "Kokkos::ViewFill-4D",
         policy_type(space, {0, 0, 0, 0},
-                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)}),
+                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)},
+                    tiles.value),
         *this);
   }
 
@@ -167,10 +217,13 @@ struct ViewFill<ViewType, Layout, ExecSpace, 5, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewType::array_layout, 5> tiles(space);
     Kokkos::parallel_for("Kokkos::ViewFill-5D",
                          policy_type(space, {0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4)}),
+                                      a.extent(3), a.extent(4)},
+                                     tiles.value),
                          *this);
   }
 
@@ -194,10 +247,13 @@ struct ViewFill<ViewType, Layout, ExecSpace, 6, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewType::array_layout, 6> tiles(space);
     Kokkos::parallel_for("Kokkos::ViewFill-6D",
                          policy_type(space, {0, 0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4), a.extent(5)}),
+                                      a.extent(3), a.extent(4), a.extent(5)},
+                                     tiles.value),
                          *this);
   }
 
@@ -221,6 +277,7 @@ struct ViewFill<ViewType, Layout, ExecSpace, 7, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
+    Impl::GraphCaptureBypass bypass_capture;
     // MDRangePolicy is not supported for 7D views
     // Iterate separately over extent(2)
     Kokkos::parallel_for("Kokkos::ViewFill-7D",
@@ -251,6 +308,7 @@ struct ViewFill<ViewType, Layout, ExecSpace, 8, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
+    Impl::GraphCaptureBypass bypass_capture;
     // MDRangePolicy is not supported for 8D views
     // Iterate separately over extent(2) and extent(4)
     Kokkos::parallel_for("Kokkos::ViewFill-8D",
@@ -281,6 +339,7 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 1, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    Impl::GraphCaptureBypass bypass_capture;
     Kokkos::parallel_for("Kokkos::ViewCopy-1D",
                          policy_type(space, 0, a.extent(0)), *this);
   }
@@ -311,9 +370,12 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 2, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
-    Kokkos::parallel_for("Kokkos::ViewCopy-2D",
-                         policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}),
-                         *this);
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewTypeA::array_layout, 2> tiles(space);
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopy-2D",
+        policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}, tiles.value),
+        *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -343,10 +405,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 3, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
-    Kokkos::parallel_for(
-        "Kokkos::ViewCopy-3D",
-        policy_type(space, {0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)}),
-        *this);
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewTypeA::array_layout, 3> tiles(space);
+    Kokkos::parallel_for("Kokkos::ViewCopy-3D",
+                         policy_type(space, {0, 0, 0},
+                                     {a.extent(0), a.extent(1), a.extent(2)},
+                                     tiles.value),
+                         *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -375,10 +440,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 4, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewTypeA::array_layout, 4> tiles(space);
     Kokkos::parallel_for(
         "Kokkos::ViewCopy-4D",
         policy_type(space, {0, 0, 0, 0},
-                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)}),
+                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)},
+                    tiles.value),
         *this);
   }
 
@@ -409,10 +477,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 5, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewTypeA::array_layout, 5> tiles(space);
     Kokkos::parallel_for("Kokkos::ViewCopy-5D",
                          policy_type(space, {0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4)}),
+                                      a.extent(3), a.extent(4)},
+                                     tiles.value),
                          *this);
   }
 
@@ -443,10 +514,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 6, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    Impl::GraphCaptureBypass bypass_capture;
+    const ViewCopyTiles<typename ViewTypeA::array_layout, 6> tiles(space);
     Kokkos::parallel_for("Kokkos::ViewCopy-6D",
                          policy_type(space, {0, 0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4), a.extent(5)}),
+                                      a.extent(3), a.extent(4), a.extent(5)},
+                                     tiles.value),
                          *this);
   }
 
@@ -477,6 +551,7 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 7, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    Impl::GraphCaptureBypass bypass_capture;
     // MDRangePolicy is not supported for 7D views
     // Iterate separately over extent(2)
     Kokkos::parallel_for("Kokkos::ViewCopy-7D",
@@ -514,6 +589,7 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 8, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    Impl::GraphCaptureBypass bypass_capture;
     // MDRangePolicy is not supported for 8D views
     // Iterate separately over extent(2) and extent(4)
     Kokkos::parallel_for("Kokkos::ViewCopy-8D",
@@ -554,6 +630,10 @@ Kokkos::Iterate get_iteration_order(const DstType& dst) {
       iterate = Kokkos::Iterate::Right;
     else
       iterate = Kokkos::Iterate::Left;
+  } else if (layout_iterate_type_selector<typename DstType::array_layout>::
+                 inner_iteration_pattern != Kokkos::Iterate::Default) {
+    iterate = layout_iterate_type_selector<
+        typename DstType::array_layout>::inner_iteration_pattern;
   } else {
     if (std::is_same_v<typename DstType::execution_space::array_layout,
                        Kokkos::LayoutRight>)
@@ -564,6 +644,47 @@ Kokkos::Iterate get_iteration_order(const DstType& dst) {
   return iterate;
 }
 
+// Converts contiguous arrays between two value types in chunks with
+// Kokkos::Experimental::Impl::convert_n.
+template <class ExecSpace, class DstValue, class SrcValue>
+struct ViewConvert {
+  enum : size_t { chunk = 4096 };
+
+  DstValue* dst;
+  const SrcValue* src;
+  size_t n;
+
+  ViewConvert(DstValue* dst_, const SrcValue* src_, size_t n_,
+              const ExecSpace& space)
+      : dst(dst_), src(src_), n(n_) {
+    Impl::GraphCaptureBypass bypass_capture;
+    Kokkos::parallel_for(
+        "Kokkos::ViewConvert",
+        Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<size_t>>(
+            space, 0, (n + chunk - 1) / chunk),
+        *this);
+  }
+
+  KOKKOS_FUNCTION
+  void operator()(const size_t c) const {
+    const size_t begin = c * chunk;
+    Kokkos::Experimental::Impl::convert_n(
+        dst + begin, src + begin, n - begin < chunk ? n - begin : chunk);
+  }
+};
+
+// True if both views are contiguous and map every index to the same offset,
+// so they can be processed as flat arrays.
+template <class DstType, class SrcType>
+bool view_copy_is_flat(const DstType& dst, const SrcType& src) {
+  if (!dst.span_is_contiguous() || !src.span_is_contiguous() ||
+      dst.span() != src.span())
+    return false;
+  for (unsigned r = 0; r < DstType::rank; ++r)
+    if (dst.stride(r) != src.stride(r)) return false;
+  return true;
+}
+
 template <class ExecutionSpace, class DstType, class SrcType>
 void view_copy(const ExecutionSpace& space, const DstType& dst,
                const SrcType& src) {
@@ -579,6 +700,18 @@ void view_copy(const ExecutionSpace& space, const DstType& dst,
     Kokkos::Impl::throw_runtime_exception(
         "Kokkos::Impl::view_copy called with invalid execution space");
   } else {
+    // Conversions between float and a half type have vectorized versions
+    if constexpr (Kokkos::Experimental::Impl::has_bulk_conversion<
+                      typename DstType::non_const_value_type,
+                      typename SrcType::non_const_value_type>::value) {
+      if (view_copy_is_flat(dst, src)) {
+        ViewConvert<ExecutionSpace, typename DstType::non_const_value_type,
+                    typename SrcType::non_const_value_type>(
+            dst.data(), src.data(), dst.span(), space);
+        return;
+      }
+    }
+
     // Figure out iteration order in case we need it
     Kokkos::Iterate iterate = get_iteration_order(dst);
 
@@ -2440,7 +2573,9 @@ inline std::enable_if_t<
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                    Kokkos::LayoutLeft> ||
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                   Kokkos::LayoutRight>>
+                   Kokkos::LayoutRight> ||
+    Impl::is_blocked_layout<
+        typename Kokkos::View<T, P...>::array_layout>::value>
 impl_resize(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
             Kokkos::View<T, P...>& v, const size_t n0, const size_t n1,
             const size_t n2, const size_t n3, const size_t n4, const size_t n5,
@@ -2493,7 +2628,9 @@ inline std::enable_if_t<
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                    Kokkos::LayoutLeft> ||
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                   Kokkos::LayoutRight>>
+                   Kokkos::LayoutRight> ||
+    Impl::is_blocked_layout<
+        typename Kokkos::View<T, P...>::array_layout>::value>
 resize(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
        Kokkos::View<T, P...>& v, const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
        const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
@@ -2511,7 +2648,9 @@ inline std::enable_if_t<
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                    Kokkos::LayoutLeft> ||
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                   Kokkos::LayoutRight>>
+                   Kokkos::LayoutRight> ||
+    Impl::is_blocked_layout<
+        typename Kokkos::View<T, P...>::array_layout>::value>
 resize(Kokkos::View<T, P...>& v, const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
        const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
        const size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
@@ -2530,7 +2669,9 @@ inline std::enable_if_t<
     (std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                     Kokkos::LayoutLeft> ||
      std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                    Kokkos::LayoutRight>)>
+                    Kokkos::LayoutRight> ||
+     Impl::is_blocked_layout<
+         typename Kokkos::View<T, P...>::array_layout>::value)>
 resize(const I& arg_prop, Kokkos::View<T, P...>& v,
        const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
        const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
@@ -2663,7 +2804,9 @@ inline std::enable_if_t<
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                    Kokkos::LayoutLeft> ||
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                   Kokkos::LayoutRight>>
+                   Kokkos::LayoutRight> ||
+    Impl::is_blocked_layout<
+        typename Kokkos::View<T, P...>::array_layout>::value>
 impl_realloc(Kokkos::View<T, P...>& v, const size_t n0, const size_t n1,
              const size_t n2, const size_t n3, const size_t n4, const size_t n5,
              const size_t n6, const size_t n7,
@@ -2709,7 +2852,9 @@ inline std::enable_if_t<
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                    Kokkos::LayoutLeft> ||
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                   Kokkos::LayoutRight>>
+                   Kokkos::LayoutRight> ||
+    Impl::is_blocked_layout<
+        typename Kokkos::View<T, P...>::array_layout>::value>
 realloc(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
         Kokkos::View<T, P...>& v,
         const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
@@ -2728,7 +2873,9 @@ inline std::enable_if_t<
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                    Kokkos::LayoutLeft> ||
     std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                   Kokkos::LayoutRight>>
+                   Kokkos::LayoutRight> ||
+    Impl::is_blocked_layout<
+        typename Kokkos::View<T, P...>::array_layout>::value>
 realloc(Kokkos::View<T, P...>& v,
         const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
         const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
@@ -2747,7 +2894,9 @@ inline std::enable_if_t<
     (std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
                     Kokkos::LayoutLeft> ||
      std::is_same_v<typename Kokkos::View<T, P...>::array_layout,
-                    Kokkos::LayoutRight>)>
+                    Kokkos::LayoutRight> ||
+     Impl::is_blocked_layout<
+         typename Kokkos::View<T, P...>::array_layout>::value)>
 realloc(const I& arg_prop, Kokkos::View<T, P...>& v,
         const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
         const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
@@ -303,6 +303,10 @@ std::vector<ExecSpace> partition_space(ExecSpace const& space,
 // Yet another workaround to deal with circular dependency issues because the
 // implementation of the RAII wrapper is using Kokkos::single.
 #include <Kokkos_AcquireUniqueTokenImpl.hpp>
+// The dispatch hooks of graph capture are defined with the graph facility
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+#include <Kokkos_Graph.hpp>
+#endif
 
 //----------------------------------------------------------------------------
 // Redefinition of the macros min and max if we pushed them at entry of
@@ -126,6 +126,12 @@ template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
 void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
                    Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in);
 
+template <class DataType, class Arg1Type, class Arg2Type, class SizeType,
+          class RowIndices, class ColumnIndices>
+void create_crs_from_coo(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
+                         SizeType nrows, RowIndices const& rows,
+                         ColumnIndices const& cols);
+
 }  // namespace Kokkos
 
 /*--------------------------------------------------------------------------*/
@@ -207,42 +213,237 @@ class CrsRowMapFromCounts {
   }
 };
 
-template <class InCrs, class OutCrs>
-class FillCrsTransposeEntries {
+/// \brief Stable parallel bucketing of COO pairs into a CRS.
+///
+/// Entry k, the pair (keys(k), values(k)), goes into row keys(k) of the
+/// output.  The entries of a row keep their order in the input, so the result
+/// is deterministic.  No atomics are used:
+///  1. The input is cut into chunks and the rows into buckets of consecutive
+///     rows.  Each chunk counts its entries per bucket.
+///  2. A scan over the (bucket, chunk) counts gives every chunk a private
+///     range in each bucket, and each chunk scatters its entries there.
+///  3. Each bucket counts its entries per row, a scan over those counts gives
+///     the row map, and each bucket places its entries into their rows.
+/// Buckets are small enough that their part of the row map stays in cache.
+template <class Keys, class Values, class OutRowMap, class OutEntries>
+class CrsFromCoo {
+ public:
+  using execution_space = typename OutEntries::execution_space;
+  using memory_space    = typename OutEntries::memory_space;
+  using size_type       = typename OutRowMap::non_const_value_type;
+  using key_type        = typename Keys::non_const_value_type;
+  using entry_type      = typename OutEntries::non_const_value_type;
+  using self_type       = CrsFromCoo<Keys, Values, OutRowMap, OutEntries>;
+
+  struct CountChunks {};
+  struct ScatterChunks {};
+  struct CountRows {};
+  struct FillRows {};
+
+ private:
+  using index_view = View<size_t*, memory_space>;
+
+  Keys m_keys;
+  Values m_values;
+  OutRowMap m_row_map;
+  OutEntries m_entries;
+  size_t m_nnz;
+  size_t m_nrows;
+  size_t m_num_chunks;
+  size_t m_chunk_size;
+  size_t m_num_buckets;
+  size_t m_bucket_rows;
+  // (chunk, bucket) counts, then cursors, stored chunk-major
+  index_view m_counts;
+  index_view m_offsets;
+  index_view m_bucket_begin;
+  View<key_type*, memory_space> m_bucket_keys;
+  View<entry_type*, memory_space> m_bucket_values;
+  View<size_type*, memory_space> m_row_cursor;
+
+  KOKKOS_INLINE_FUNCTION
+  size_t chunk_end(size_t t) const {
+    const size_t end = (t + 1) * m_chunk_size;
+    return end < m_nnz ? end : m_nnz;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t bucket_row_end(size_t b) const {
+    const size_t end = (b + 1) * m_bucket_rows;
+    return end < m_nrows ? end : m_nrows;
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(CountChunks, size_t t) const {
+    size_t* const counts = &m_counts(t * m_num_buckets);
+    for (size_t k = t * m_chunk_size; k < chunk_end(t); ++k)
+      ++counts[size_t(m_keys(k)) / m_bucket_rows];
+  }
+
+  // exclusive scan in (bucket, chunk) order
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_t i, size_t& update, bool final_pass) const {
+    if (i == m_num_chunks * m_num_buckets) {
+      if (final_pass) m_bucket_begin(m_num_buckets) = update;
+      return;
+    }
+    const size_t b = i / m_num_chunks;
+    const size_t t = i % m_num_chunks;
+    const size_t c = t * m_num_buckets + b;
+    if (final_pass) {
+      m_offsets(c) = update;
+      if (t == 0) m_bucket_begin(b) = update;
+    }
+    update += m_counts(c);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(ScatterChunks, size_t t) const {
+    size_t* const cursor = &m_offsets(t * m_num_buckets);
+    for (size_t k = t * m_chunk_size; k < chunk_end(t); ++k) {
+      const key_type key   = m_keys(k);
+      const size_t pos     = cursor[size_t(key) / m_bucket_rows]++;
+      m_bucket_keys(pos)   = key;
+      m_bucket_values(pos) = m_values(k);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(CountRows, size_t b) const {
+    for (size_t r = b * m_bucket_rows; r < bucket_row_end(b); ++r)
+      m_row_cursor(r) = 0;
+    for (size_t k = m_bucket_begin(b); k < m_bucket_begin(b + 1); ++k)
+      ++m_row_cursor(m_bucket_keys(k));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(FillRows, size_t b) const {
+    for (size_t r = b * m_bucket_rows; r < bucket_row_end(b); ++r)
+      m_row_cursor(r) = m_row_map(r);
+    for (size_t k = m_bucket_begin(b); k < m_bucket_begin(b + 1); ++k)
+      m_entries(m_row_cursor(m_bucket_keys(k))++) = m_bucket_values(k);
+  }
+
+  CrsFromCoo(Keys const& keys, Values const& values, size_t nrows)
+      : m_keys(keys),
+        m_values(values),
+        m_nnz(keys.extent(0)),
+        m_nrows(nrows) {
+    // Enough chunks and buckets to keep every thread busy, but few enough
+    // that the (chunk, bucket) table stays small.
+    constexpr size_t max_parts      = 1024;
+    constexpr size_t min_chunk_size = 4096;
+    const size_t concurrency        = execution_space().concurrency();
+    const size_t parts =
+        concurrency < max_parts / 4 ? 4 * concurrency : max_parts;
+    m_num_chunks = (m_nnz + min_chunk_size - 1) / min_chunk_size;
+    if (m_num_chunks > parts) m_num_chunks = parts;
+    if (m_num_chunks == 0) m_num_chunks = 1;
+    m_chunk_size  = (m_nnz + m_num_chunks - 1) / m_num_chunks;
+    m_num_buckets = m_nrows < parts ? m_nrows : parts;
+    if (m_num_buckets == 0) m_num_buckets = 1;
+    m_bucket_rows = (m_nrows + m_num_buckets - 1) / m_num_buckets;
+    if (m_bucket_rows == 0) m_bucket_rows = 1;
+    m_num_buckets = (m_nrows + m_bucket_rows - 1) / m_bucket_rows;
+    if (m_num_buckets == 0) m_num_buckets = 1;
+  }
+
+  void execute(OutRowMap& row_map, OutEntries& entries,
+               std::string const& row_map_label,
+               std::string const& entries_label) {
+    using chunk_policy = RangePolicy<size_t, execution_space, CountChunks>;
+    using scan_policy  = RangePolicy<size_t, execution_space>;
+    using scatter_policy =
+        RangePolicy<size_t, execution_space, ScatterChunks>;
+    using count_policy = RangePolicy<size_t, execution_space, CountRows>;
+    using fill_policy  = RangePolicy<size_t, execution_space, FillRows>;
+
+    const size_t table_size = m_num_chunks * m_num_buckets;
+    m_counts = index_view("Kokkos::CrsFromCoo::counts", table_size);
+    m_offsets = index_view(
+        view_alloc(WithoutInitializing, "Kokkos::CrsFromCoo::offsets"),
+        table_size);
+    m_bucket_begin = index_view(
+        view_alloc(WithoutInitializing, "Kokkos::CrsFromCoo::bucket_begin"),
+        m_num_buckets + 1);
+    m_bucket_keys = View<key_type*, memory_space>(
+        view_alloc(WithoutInitializing, "Kokkos::CrsFromCoo::bucket_keys"),
+        m_nnz);
+    m_bucket_values = View<entry_type*, memory_space>(
+        view_alloc(WithoutInitializing, "Kokkos::CrsFromCoo::bucket_values"),
+        m_nnz);
+    m_row_cursor = View<size_type*, memory_space>(
+        view_alloc(WithoutInitializing, "Kokkos::CrsFromCoo::row_counts"),
+        m_nrows);
+
+    {
+      const Kokkos::Impl::ParallelFor<self_type, chunk_policy> closure(
+          *this, chunk_policy(0, m_num_chunks));
+      closure.execute();
+    }
+    {
+      const Kokkos::Impl::ParallelScan<self_type, scan_policy> closure(
+          *this, scan_policy(0, table_size + 1));
+      closure.execute();
+    }
+    {
+      const Kokkos::Impl::ParallelFor<self_type, scatter_policy> closure(
+          *this, scatter_policy(0, m_num_chunks));
+      closure.execute();
+    }
+    {
+      const Kokkos::Impl::ParallelFor<self_type, count_policy> closure(
+          *this, count_policy(0, m_num_buckets));
+      closure.execute();
+    }
+    Kokkos::get_crs_row_map_from_counts(row_map, m_row_cursor, row_map_label);
+    m_row_map = row_map;
+    entries =
+        OutEntries(view_alloc(WithoutInitializing, entries_label), m_nnz);
+    m_entries = entries;
+    {
+      const Kokkos::Impl::ParallelFor<self_type, fill_policy> closure(
+          *this, fill_policy(0, m_num_buckets));
+      closure.execute();
+    }
+    execution_space().fence(
+        "Kokkos::Impl::CrsFromCoo::execute: fence after functor execution");
+  }
+};
+
+template <class RowMap, class Entries, class Keys, class Values>
+void crs_from_coo(RowMap& row_map, Entries& entries, size_t nrows,
+                  Keys const& keys, Values const& values,
+                  std::string const& row_map_label = "row_map",
+                  std::string const& entries_label = "entries") {
+  CrsFromCoo<Keys, Values, RowMap, Entries> builder(keys, values, nrows);
+  builder.execute(row_map, entries, row_map_label, entries_label);
+}
+
+// The row of every entry of a CRS, to feed a transpose through CrsFromCoo.
+template <class InCrs, class OutRows>
+class CrsEntryRows {
  public:
   using execution_space = typename InCrs::execution_space;
-  using memory_space    = typename InCrs::memory_space;
-  using value_type      = typename OutCrs::entries_type::value_type;
   using index_type      = typename InCrs::size_type;
+  using self_type       = CrsEntryRows<InCrs, OutRows>;
 
  private:
-  using counters_type = View<index_type*, memory_space>;
   InCrs in;
-  OutCrs out;
-  counters_type counters;
+  OutRows out;
 
  public:
   KOKKOS_INLINE_FUNCTION
   void operator()(index_type i) const {
-    auto begin = in.row_map(i);
-    auto end   = in.row_map(i + 1);
-    for (auto j = begin; j < end; ++j) {
-      auto ti                  = in.entries(j);
-      auto tbegin              = out.row_map(ti);
-      auto tj                  = atomic_fetch_add(&counters(ti), 1);
-      out.entries(tbegin + tj) = i;
-    }
+    for (auto j = in.row_map(i); j < in.row_map(i + 1); ++j) out(j) = i;
   }
-  using self_type = FillCrsTransposeEntries<InCrs, OutCrs>;
-  FillCrsTransposeEntries(InCrs const& arg_in, OutCrs const& arg_out)
-      : in(arg_in), out(arg_out), counters("counters", arg_out.numRows()) {
+  CrsEntryRows(InCrs const& arg_in, OutRows const& arg_out)
+      : in(arg_in), out(arg_out) {
     using policy_type  = RangePolicy<index_type, execution_space>;
     using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
     const closure_type closure(*this, policy_type(0, index_type(in.numRows())));
     closure.execute();
-    execution_space().fence(
-        "Kokkos::Impl::FillCrsTransposeEntries::FillCrsTransposeEntries: fence "
-        "after functor execution");
   }
 };
 
@@ -273,21 +474,36 @@ typename OutRowMap::value_type get_crs_row_map_from_counts(
   return functor.execute();
 }
 
+/// \brief Transpose \c in into \c out.
+///
+/// The entries of every row of \c out are sorted, and the result does not
+/// depend on the number of threads.
 template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
 void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
                    Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in) {
   using crs_type     = Crs<DataType, Arg1Type, Arg2Type, SizeType>;
   using memory_space = typename crs_type::memory_space;
-  using counts_type  = View<SizeType*, memory_space>;
-  {
-    counts_type counts;
-    Kokkos::get_crs_transpose_counts(counts, in);
-    Kokkos::get_crs_row_map_from_counts(out.row_map, counts,
-                                        "tranpose_row_map");
-  }
-  out.entries = decltype(out.entries)("transpose_entries", in.entries.size());
-  Kokkos::Impl::FillCrsTransposeEntries<crs_type, crs_type> entries_functor(
-      in, out);
+  using rows_type    = View<DataType*, memory_space>;
+
+  rows_type rows(view_alloc(WithoutInitializing, "transpose_rows"),
+                 in.entries.size());
+  Kokkos::Impl::CrsEntryRows<crs_type, rows_type> rows_functor(in, rows);
+  Kokkos::Impl::crs_from_coo(out.row_map, out.entries, in.numRows(),
+                             in.entries, rows, "tranpose_row_map",
+                             "transpose_entries");
+}
+
+/// \brief Build \c out with \c nrows rows from the COO pairs
+///   (rows(k), cols(k)).
+///
+/// Row rows(k) of \c out gets the entry cols(k).  The entries of each row
+/// keep their order in the input.
+template <class DataType, class Arg1Type, class Arg2Type, class SizeType,
+          class RowIndices, class ColumnIndices>
+void create_crs_from_coo(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
+                         SizeType nrows, RowIndices const& rows,
+                         ColumnIndices const& cols) {
+  Kokkos::Impl::crs_from_coo(out.row_map, out.entries, nrows, rows, cols);
 }
 
 template <class CrsType, class Functor,
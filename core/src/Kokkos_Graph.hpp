@@ -22,6 +22,7 @@
 #endif
 
 #include <Kokkos_Macros.hpp>
+#include <Kokkos_DetectionIdiom.hpp>
 #include <impl/Kokkos_Error.hpp>  // KOKKOS_EXPECTS
 
 #include <Kokkos_Graph_fwd.hpp>
@@ -32,6 +33,7 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 
 namespace Kokkos {
 namespace Experimental {
@@ -66,6 +68,10 @@ struct [[nodiscard]] Graph {
   using impl_t                       = Kokkos::Impl::GraphImpl<ExecutionSpace>;
   std::shared_ptr<impl_t> m_impl_ptr = nullptr;
 
+  template <class Impl>
+  using impl_kernel_fusion_t =
+      decltype(std::declval<Impl&>().set_kernel_fusion(true));
+
   // </editor-fold> end private data members }}}2
   //----------------------------------------------------------------------------
 
@@ -86,6 +92,16 @@ struct [[nodiscard]] Graph {
     return m_impl_ptr->get_execution_space();
   }
 
+  // Fuse each chain of parallel_for kernels over the same RangePolicy range
+  // into a single loop when instantiating the graph.  Only valid if every
+  // iteration of these kernels only depends on the same iteration of the
+  // previous kernels.  Ignored by backends with native graphs.
+  void enable_kernel_fusion() {
+    KOKKOS_EXPECTS(bool(m_impl_ptr))
+    if constexpr (Kokkos::is_detected_v<impl_kernel_fusion_t, impl_t>)
+      (*m_impl_ptr).set_kernel_fusion(true);
+  }
+
   void instantiate() {
     KOKKOS_EXPECTS(bool(m_impl_ptr))
     (*m_impl_ptr).instantiate();
@@ -227,6 +243,9 @@ decltype(auto) Graph<ExecutionSpace>::native_graph_exec() {
 #ifdef SYCL_EXT_ONEAPI_GRAPH
 #include <SYCL/Kokkos_SYCL_Graph_Impl.hpp>
 #endif
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+#include <impl/Kokkos_GraphCapture.hpp>
+#endif
 #ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_GRAPH
 #undef KOKKOS_IMPL_PUBLIC_INCLUDE
 #undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_GRAPH
@@ -26,6 +26,8 @@ static_assert(false,
 #define KOKKOS_LAYOUT_HPP
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 #include <impl/Kokkos_Traits.hpp>
 
 namespace Kokkos {
@@ -217,6 +219,259 @@ struct LayoutStride {
   }
 };
 
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+KOKKOS_INLINE_FUNCTION
+constexpr unsigned blocked_layout_log2(size_t n) {
+  unsigned s = 0;
+  while ((size_t(1) << s) < n) ++s;
+  return s;
+}
+
+KOKKOS_INLINE_FUNCTION
+constexpr bool blocked_layout_is_pow2(size_t n) {
+  return n > 0 && (n & (n - 1)) == 0;
+}
+
+/// \brief Index math of Experimental::LayoutTiled, shared by the View
+///   mapping and the mdspan layout policy.
+///
+/// Tiles are laid out right-most index fastest and so are the elements
+/// within a tile.  Only the tile grid strides are known at run time, the
+/// rest are shifts and masks.
+template <size_t... TileDims>
+struct TiledIndex {
+  static constexpr unsigned rank = sizeof...(TileDims);
+
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_t tile_extent(unsigned r) {
+    constexpr size_t tile[] = {TileDims...};
+    return tile[r];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static constexpr unsigned tile_shift(unsigned r) {
+    return blocked_layout_log2(tile_extent(r));
+  }
+
+  // Shift of index r inside a tile: sum of the tile shifts right of r
+  KOKKOS_INLINE_FUNCTION
+  static constexpr unsigned inner_shift(unsigned r) {
+    unsigned s = 0;
+    for (unsigned j = r + 1; j < rank; ++j) s += tile_shift(j);
+    return s;
+  }
+
+  static constexpr size_t tile_size = (size_t(1) << inner_shift(0))
+                                      << tile_shift(0);
+
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_t num_tiles(unsigned r, size_t n) {
+    return (n + tile_extent(r) - 1) >> tile_shift(r);
+  }
+
+  // Fill the tile grid strides for extents n, return the number of tiles
+  template <class Extent>
+  KOKKOS_INLINE_FUNCTION static constexpr size_t tile_strides(
+      size_t* tile_stride, const Extent& n) {
+    size_t count = 1;
+    for (unsigned r = rank; r-- > 0;) {
+      tile_stride[r] = count;
+      count *= num_tiles(r, n(r));
+    }
+    return count;
+  }
+
+  // Tile coordinate and position inside the tile of index r
+  template <size_t R>
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr size_t tile_of(size_t i) {
+    constexpr unsigned shift = tile_shift(R);
+    return i >> shift;
+  }
+
+  template <size_t R>
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr size_t in_tile(size_t i) {
+    constexpr unsigned shift = inner_shift(R);
+    return (i & (tile_extent(R) - 1)) << shift;
+  }
+
+  template <size_t... R, class... I>
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr size_t offset(
+      std::index_sequence<R...>, const size_t* tile_stride, const I&... i) {
+    return (... + (tile_of<R>(i) * tile_stride[R])) * tile_size |
+           (... | in_tile<R>(i));
+  }
+};
+
+/// \brief Index math of Experimental::LayoutAoSoA.
+///
+/// Index 0 is split into a block of VectorLength lanes and a lane.  Each
+/// block holds all remaining indices, left-most fastest, with the lanes
+/// contiguous, so one block is a LayoutLeft array of extents
+/// (VectorLength, N1, N2, ...).
+template <size_t VectorLength>
+struct AoSoAIndex {
+  static constexpr unsigned lane_shift = blocked_layout_log2(VectorLength);
+
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_t num_blocks(size_t n) {
+    return (n + VectorLength - 1) >> lane_shift;
+  }
+
+  // Fill stride[r], r > 0, with the in-block strides of index r divided by
+  // VectorLength and stride[0] with the number of members per struct
+  template <class Extent>
+  KOKKOS_INLINE_FUNCTION static constexpr void strides(size_t* stride,
+                                                       unsigned rank,
+                                                       const Extent& n) {
+    size_t fields = 1;
+    for (unsigned r = 1; r < rank; ++r) {
+      stride[r] = fields;
+      fields *= n(r);
+    }
+    stride[0] = fields;
+  }
+
+  template <size_t... R, class I0, class... I>
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr size_t offset(
+      std::index_sequence<0, R...>, const size_t* stride, const I0& i0,
+      const I&... i) {
+    return (((size_t(i0) >> lane_shift) * stride[0] +
+             (size_t(0) + ... + (size_t(i) * stride[R])))
+            << lane_shift) |
+           (size_t(i0) & (VectorLength - 1));
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+//----------------------------------------------------------------------------
+/// \struct LayoutTiled
+/// \brief Memory layout tag for a View stored as a grid of fixed size
+///   tiles.
+///
+/// The View rank must match the number of tile extents, which must be
+/// powers of two.  Tiles and the elements within a tile are both stored
+/// right-most index fastest, so a tile of LayoutTiled<4, 8> is a
+/// contiguous 4x8 LayoutRight block.  Extents that are not a multiple of
+/// the tile are padded up to the next whole tile.
+template <size_t... TileDims>
+struct LayoutTiled {
+  static_assert(0 < sizeof...(TileDims) &&
+                    sizeof...(TileDims) <= ARRAY_LAYOUT_MAX_RANK,
+                "LayoutTiled requires between 1 and 8 tile extents");
+  static_assert((Kokkos::Impl::blocked_layout_is_pow2(TileDims) && ...),
+                "LayoutTiled tile extents must be powers of two");
+
+  //! Tag this class as a kokkos array layout
+  using array_layout = LayoutTiled;
+
+  static constexpr unsigned tile_rank = sizeof...(TileDims);
+
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_t tile_extent(unsigned r) {
+    return Kokkos::Impl::TiledIndex<TileDims...>::tile_extent(r);
+  }
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  LayoutTiled(LayoutTiled const&)            = default;
+  LayoutTiled(LayoutTiled&&)                 = default;
+  LayoutTiled& operator=(LayoutTiled const&) = default;
+  LayoutTiled& operator=(LayoutTiled&&)      = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr LayoutTiled(size_t N0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : dimension{N0, N1, N2, N3, N4, N5, N6, N7} {}
+
+  friend bool operator==(const LayoutTiled& left, const LayoutTiled& right) {
+    for (unsigned int rank = 0; rank < ARRAY_LAYOUT_MAX_RANK; ++rank)
+      if (left.dimension[rank] != right.dimension[rank]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const LayoutTiled& left, const LayoutTiled& right) {
+    return !(left == right);
+  }
+};
+
+//----------------------------------------------------------------------------
+/// \struct LayoutAoSoA
+/// \brief Memory layout tag for an array of structs of arrays.
+///
+/// Index 0 enumerates the structs, the remaining indices their members.
+/// Structs are grouped in blocks of VectorLength, which must be a power of
+/// two, and each member of a block is stored as VectorLength contiguous
+/// values.  The extent of index 0 is padded to a whole block.
+template <size_t VectorLength>
+struct LayoutAoSoA {
+  static_assert(Kokkos::Impl::blocked_layout_is_pow2(VectorLength),
+                "LayoutAoSoA vector length must be a power of two");
+
+  //! Tag this class as a kokkos array layout
+  using array_layout = LayoutAoSoA;
+
+  static constexpr size_t vector_length = VectorLength;
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  LayoutAoSoA(LayoutAoSoA const&)            = default;
+  LayoutAoSoA(LayoutAoSoA&&)                 = default;
+  LayoutAoSoA& operator=(LayoutAoSoA const&) = default;
+  LayoutAoSoA& operator=(LayoutAoSoA&&)      = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr LayoutAoSoA(size_t N0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t N7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : dimension{N0, N1, N2, N3, N4, N5, N6, N7} {}
+
+  friend bool operator==(const LayoutAoSoA& left, const LayoutAoSoA& right) {
+    for (unsigned int rank = 0; rank < ARRAY_LAYOUT_MAX_RANK; ++rank)
+      if (left.dimension[rank] != right.dimension[rank]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const LayoutAoSoA& left, const LayoutAoSoA& right) {
+    return !(left == right);
+  }
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+template <class Layout>
+struct is_blocked_layout : std::false_type {};
+
+template <size_t... TileDims>
+struct is_blocked_layout<Experimental::LayoutTiled<TileDims...>>
+    : std::true_type {};
+
+template <size_t VectorLength>
+struct is_blocked_layout<Experimental::LayoutAoSoA<VectorLength>>
+    : std::true_type {};
+}  // namespace Impl
+
 // ===================================================================================
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -261,6 +516,23 @@ struct layout_iterate_type_selector<Kokkos::LayoutStride> {
   static const Kokkos::Iterate inner_iteration_pattern =
       Kokkos::Iterate::Default;
 };
+
+// Walking tiles and their elements right-most index fastest visits the
+// memory of a LayoutTiled View in order
+template <size_t... TileDims>
+struct layout_iterate_type_selector<
+    Kokkos::Experimental::LayoutTiled<TileDims...>> {
+  static const Kokkos::Iterate outer_iteration_pattern = Kokkos::Iterate::Right;
+  static const Kokkos::Iterate inner_iteration_pattern = Kokkos::Iterate::Right;
+};
+
+// The lanes of index 0 are contiguous
+template <size_t VectorLength>
+struct layout_iterate_type_selector<
+    Kokkos::Experimental::LayoutAoSoA<VectorLength>> {
+  static const Kokkos::Iterate outer_iteration_pattern = Kokkos::Iterate::Left;
+  static const Kokkos::Iterate inner_iteration_pattern = Kokkos::Iterate::Left;
+};
 }  // namespace Impl
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
@@ -46,6 +46,26 @@ void memory_pool_bounds_verification(size_t min_block_alloc_size,
                                      size_t max_superblock_size,
                                      size_t max_block_per_superblock,
                                      size_t min_total_alloc_size);
+
+/* Report violation of size class constraints:
+ *   size_classes_per_doubling is 1, 2, 4 or 8
+ *   8 <= min_block_size / size_classes_per_doubling
+ *   at most 31 size classes if size_classes_per_doubling > 1
+ */
+void memory_pool_size_class_verification(size_t size_classes_per_doubling,
+                                         size_t min_block_size,
+                                         size_t max_block_size);
+
+/* Block size of size class 'c' with 2^size_class_lg2 classes per doubling:
+ *   c = 0, 1, 2, ... -> min_block_size * (1, 1 + 1/n, 1 + 2/n, ...)
+ */
+KOKKOS_FORCEINLINE_FUNCTION
+constexpr uint32_t memory_pool_block_size(uint32_t c,
+                                          uint32_t min_block_size_lg2,
+                                          uint32_t size_class_lg2) noexcept {
+  return ((1u << size_class_lg2) + (c & ((1u << size_class_lg2) - 1)))
+         << (min_block_size_lg2 + (c >> size_class_lg2) - size_class_lg2);
+}
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -56,7 +76,9 @@ namespace Impl {
 void _print_memory_pool_state(std::ostream &s, uint32_t const *sb_state_ptr,
                               int32_t sb_count, uint32_t sb_size_lg2,
                               uint32_t sb_state_size, uint32_t state_shift,
-                              uint32_t state_used_mask);
+                              uint32_t state_used_mask, uint32_t state_base,
+                              uint32_t min_block_size_lg2,
+                              uint32_t size_class_lg2);
 
 }  // end namespace Impl
 
@@ -74,6 +96,11 @@ class MemoryPool {
 
   enum : uint32_t { HINT_PER_BLOCK_SIZE = 2 };
 
+  // Blocks per cache, and uint32_t words per cache:
+  //   [ used count , padding , uint64_t block offset[ CACHE_SIZE ] ]
+  enum : uint32_t { CACHE_SIZE = 16 };
+  enum : uint32_t { CACHE_WORDS = 2 + 2 * CACHE_SIZE };
+
   /*  Each superblock has a concurrent bitset state
    *  which is an array of uint32_t integers.
    *    [ { block_count_lg2  : state_shift bits
@@ -86,14 +113,28 @@ class MemoryPool {
    *  is concurrently updated.
    */
 
-  /*  Mapping between block_size <-> block_state
+  /*  Block sizes are size classes 0, 1, 2, ... of increasing size,
+   *  see Impl::memory_pool_block_size.  With one class per doubling
+   *  (the default) the block sizes are the powers of two from the
+   *  minimum to the maximum block size.
+   *
+   *  Mapping between size_class <-> block_state
    *
-   *  block_state = ( m_sb_size_lg2 - block_size_lg2 ) << state_shift
-   *  block_size  = m_sb_size_lg2 - ( block_state >> state_shift )
+   *  block_state = ( m_state_base - size_class ) << state_shift
+   *  size_class  = m_state_base - ( block_state >> state_shift )
+   *
+   *  With one class per doubling m_state_base is the number of blocks
+   *  of minimum size per superblock, so that the state is the block count
+   *  lg2.  Otherwise it is the number of size classes.
    *
    *  Thus A_block_size < B_block_size  <=>  A_block_state > B_block_state
    */
 
+  /*  Optional caches: for every slot (e.g. UniqueToken id) and size class
+   *  a small stack of free blocks that stay claimed in their superblocks,
+   *  so that the slot can allocate and deallocate without atomics.
+   */
+
   using base_memory_space = typename DeviceType::memory_space;
 
   enum {
@@ -110,10 +151,14 @@ class MemoryPool {
   uint32_t m_sb_size_lg2;
   uint32_t m_max_block_size_lg2;
   uint32_t m_min_block_size_lg2;
+  uint32_t m_size_class_lg2;  // lg2 of size classes per doubling
+  uint32_t m_state_base;      // block state of size class 0
   int32_t m_sb_count;
-  int32_t m_hint_offset;  // Offset to K * #block_size array of hints
-  int32_t m_data_offset;  // Offset to 0th superblock data
-  int32_t m_unused_padding;
+  int32_t m_class_count;
+  int32_t m_hint_offset;   // Offset to K * #block_size array of hints
+  int32_t m_cache_offset;  // Offset to #slot * #block_size array of caches
+  int32_t m_data_offset;   // Offset to 0th superblock data
+  int32_t m_cache_count;   // Number of cache slots
 
  public:
   using memory_space = typename DeviceType::memory_space;
@@ -155,6 +200,8 @@ class MemoryPool {
     size_t consumed_bytes;        ///<  Bytes allocated
     size_t reserved_blocks;  ///<  Unallocated blocks in assigned superblocks
     size_t reserved_bytes;   ///<  Unallocated bytes in assigned superblocks
+    size_t cached_blocks;    ///<  Free blocks held in caches, also consumed
+    size_t cached_bytes;     ///<  Bytes of the cached blocks
   };
 
   // This function is templated to avoid needing a full definition of
@@ -165,7 +212,7 @@ class MemoryPool {
     static_assert(
         std::is_same_v<ExecutionSpace, Kokkos::DefaultHostExecutionSpace>);
 
-    const size_t alloc_size = m_hint_offset * sizeof(uint32_t);
+    const size_t alloc_size = m_data_offset * sizeof(uint32_t);
 
     uint32_t *const sb_state_array =
         accessible ? m_sb_state_array : (uint32_t *)host.allocate(alloc_size);
@@ -188,17 +235,19 @@ class MemoryPool {
     stats.consumed_bytes       = 0;
     stats.reserved_blocks      = 0;
     stats.reserved_bytes       = 0;
+    stats.cached_blocks        = 0;
+    stats.cached_bytes         = 0;
 
     const uint32_t *sb_state_ptr = sb_state_array;
 
     for (int32_t i = 0; i < m_sb_count; ++i, sb_state_ptr += m_sb_state_size) {
-      const uint32_t block_count_lg2 = (*sb_state_ptr) >> state_shift;
+      const uint32_t block_state = (*sb_state_ptr) & state_header_mask;
 
-      if (block_count_lg2) {
-        const uint32_t block_count    = 1u << block_count_lg2;
-        const uint32_t block_size_lg2 = m_sb_size_lg2 - block_count_lg2;
-        const uint32_t block_size     = 1u << block_size_lg2;
-        const uint32_t block_used     = (*sb_state_ptr) & state_used_mask;
+      if (block_state) {
+        const uint32_t size_class  = get_state_size_class(block_state);
+        const uint32_t block_count = get_block_count(size_class);
+        const uint32_t block_size  = get_block_size(size_class);
+        const uint32_t block_used  = (*sb_state_ptr) & state_used_mask;
 
         stats.consumed_superblocks++;
         stats.consumed_blocks += block_used;
@@ -209,6 +258,22 @@ class MemoryPool {
       }
     }
 
+    for (int32_t i = 0; i < m_cache_count * m_class_count; ++i) {
+      const uint32_t *const cache =
+          sb_state_array + m_cache_offset + i * CACHE_WORDS;
+      const uint64_t *const blocks =
+          reinterpret_cast<const uint64_t *>(cache + 2);
+
+      for (uint32_t k = 0; k < cache[0]; ++k) {
+        const uint32_t block_state =
+            sb_state_array[(blocks[k] >> m_sb_size_lg2) * m_sb_state_size] &
+            state_header_mask;
+
+        stats.cached_blocks++;
+        stats.cached_bytes += get_block_size(get_state_size_class(block_state));
+      }
+    }
+
     if (!accessible) {
       host.deallocate(sb_state_array, alloc_size);
     }
@@ -237,7 +302,8 @@ class MemoryPool {
 
     Impl::_print_memory_pool_state(s, sb_state_array, m_sb_count, m_sb_size_lg2,
                                    m_sb_state_size, state_shift,
-                                   state_used_mask);
+                                   state_used_mask, m_state_base,
+                                   m_min_block_size_lg2, m_size_class_lg2);
 
     if (!accessible) {
       host.deallocate(sb_state_array, alloc_size);
@@ -258,10 +324,14 @@ class MemoryPool {
         m_sb_size_lg2(0),
         m_max_block_size_lg2(0),
         m_min_block_size_lg2(0),
+        m_size_class_lg2(0),
+        m_state_base(0),
         m_sb_count(0),
+        m_class_count(0),
         m_hint_offset(0),
+        m_cache_offset(0),
         m_data_offset(0),
-        m_unused_padding(0) {}
+        m_cache_count(0) {}
 
   /**\brief  Allocate a memory pool from 'memspace'.
    *
@@ -276,20 +346,35 @@ class MemoryPool {
    *  Individual allocations will always consume a block of memory that
    *  is also a power-of-two.  These roundings are made to enable
    *  significant runtime performance improvements.
+   *
+   *  With 'size_classes_per_doubling' of 2, 4 or 8 each doubling of the
+   *  block size is split into that many evenly spaced size classes instead:
+   *  with 4 a 65 to 80 byte request consumes an 80 byte block rather than
+   *  128 bytes.  Blocks are then only aligned to the minimum block size
+   *  divided by 'size_classes_per_doubling', and there can be at most 31
+   *  size classes between the minimum and maximum block size.
+   *
+   *  'cache_slots' reserves per-slot caches of free blocks for
+   *  allocate_cached and deallocate_cached.
    */
   MemoryPool(const base_memory_space &memspace,
              const size_t min_total_alloc_size, size_t min_block_alloc_size = 0,
-             size_t max_block_alloc_size = 0, size_t min_superblock_size = 0)
+             size_t max_block_alloc_size = 0, size_t min_superblock_size = 0,
+             uint32_t size_classes_per_doubling = 1, int32_t cache_slots = 0)
       : m_tracker(),
         m_sb_state_array(nullptr),
         m_sb_state_size(0),
         m_sb_size_lg2(0),
         m_max_block_size_lg2(0),
         m_min_block_size_lg2(0),
+        m_size_class_lg2(0),
+        m_state_base(0),
         m_sb_count(0),
+        m_class_count(0),
         m_hint_offset(0),
+        m_cache_offset(0),
         m_data_offset(0),
-        m_unused_padding(0) {
+        m_cache_count(0) {
     const uint32_t int_align_lg2               = 3; /* align as int[8] */
     const uint32_t int_align_mask              = (1u << int_align_lg2) - 1;
     const uint32_t default_min_block_size      = 1u << 6;  /* 64 bytes */
@@ -356,6 +441,20 @@ class MemoryPool {
     m_sb_size_lg2 =
         Kokkos::Impl::integral_power_of_two_that_contains(min_superblock_size);
 
+    //--------------------------------------------------
+    // Size classes:
+
+    Kokkos::Impl::memory_pool_size_class_verification(
+        size_classes_per_doubling, size_t(1) << m_min_block_size_lg2,
+        size_t(1) << m_max_block_size_lg2);
+
+    m_size_class_lg2 = Kokkos::Impl::int_log2(size_classes_per_doubling);
+    m_class_count    = 1 + ((m_max_block_size_lg2 - m_min_block_size_lg2)
+                         << m_size_class_lg2);
+    m_state_base     = m_size_class_lg2 ? m_class_count
+                                        : m_sb_size_lg2 - m_min_block_size_lg2;
+    m_cache_count    = cache_slots < 0 ? 0 : cache_slots;
+
     {
       // number of superblocks is multiple of superblock size that
       // can hold min_total_alloc_size.
@@ -383,8 +482,7 @@ class MemoryPool {
 
     // Number of block sizes
 
-    const int32_t number_block_sizes =
-        1 + m_max_block_size_lg2 - m_min_block_size_lg2;
+    const int32_t number_block_sizes = m_class_count;
 
     // Array length for possible block sizes
     // Hint array is one uint32_t per block size
@@ -392,8 +490,16 @@ class MemoryPool {
     const int32_t block_size_array_size =
         (number_block_sizes + int_align_mask) & ~int_align_mask;
 
+    // Cache array is CACHE_WORDS uint32_t per slot and block size
+
+    const int32_t cache_array_size =
+        (m_cache_count * number_block_sizes * CACHE_WORDS + int_align_mask) &
+        ~int_align_mask;
+
     m_hint_offset = all_sb_state_size;
-    m_data_offset = m_hint_offset + block_size_array_size * HINT_PER_BLOCK_SIZE;
+    m_cache_offset =
+        m_hint_offset + block_size_array_size * HINT_PER_BLOCK_SIZE;
+    m_data_offset = m_cache_offset + cache_array_size;
 
     // Allocation:
 
@@ -417,10 +523,8 @@ class MemoryPool {
     // Initial assignment of empty superblocks to block sizes:
 
     for (int32_t i = 0; i < number_block_sizes; ++i) {
-      const uint32_t block_size_lg2  = i + m_min_block_size_lg2;
-      const uint32_t block_count_lg2 = m_sb_size_lg2 - block_size_lg2;
-      const uint32_t block_state     = block_count_lg2 << state_shift;
-      const uint32_t hint_begin      = m_hint_offset + i * HINT_PER_BLOCK_SIZE;
+      const uint32_t block_state = get_size_class_state(i);
+      const uint32_t hint_begin  = m_hint_offset + i * HINT_PER_BLOCK_SIZE;
 
       // for block size index 'i':
       //   sb_id_hint  = sb_state_array[ hint_begin ];
@@ -456,14 +560,85 @@ class MemoryPool {
   //--------------------------------------------------------------------------
 
  private:
-  /* Given a size 'n' get the block size in which it can be allocated.
-   * Restrict lower bound to minimum block size.
+  /* Given a size 'n' get the smallest size class in which it can be
+   * allocated.  Restrict lower bound to minimum block size.
+   */
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t get_size_class(uint32_t n) const noexcept {
+    if (n <= (1u << m_min_block_size_lg2)) return 0;
+
+    // n is in ( 2^(lg2-1) , 2^lg2 ], cut into steps of 2^step_lg2
+    const uint32_t lg2 = Kokkos::Impl::integral_power_of_two_that_contains(n);
+    const uint32_t step_lg2 = lg2 - 1 - m_size_class_lg2;
+    const uint32_t above    = n - (1u << (lg2 - 1));
+
+    return ((lg2 - 1 - m_min_block_size_lg2) << m_size_class_lg2) +
+           ((above + (1u << step_lg2) - 1) >> step_lg2);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t get_block_size(uint32_t size_class) const noexcept {
+    return Kokkos::Impl::memory_pool_block_size(
+        size_class, m_min_block_size_lg2, m_size_class_lg2);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t get_block_count(uint32_t size_class) const noexcept {
+    return m_size_class_lg2 ? (1u << m_sb_size_lg2) / get_block_size(size_class)
+                            : 1u << (m_state_base - size_class);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t get_size_class_state(uint32_t size_class) const noexcept {
+    return (m_state_base - size_class) << state_shift;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t get_state_size_class(uint32_t block_state) const noexcept {
+    return m_state_base - (block_state >> state_shift);
+  }
+
+  /* Index of the block at byte 'offset' into a superblock of 'size_class',
+   * -1 if 'offset' is not the beginning of a block.
    */
   KOKKOS_FORCEINLINE_FUNCTION
-  uint32_t get_block_size_lg2(uint32_t n) const noexcept {
-    const unsigned i = Kokkos::Impl::integral_power_of_two_that_contains(n);
+  int get_block_index(uint32_t offset, uint32_t size_class) const noexcept {
+    const uint32_t block_size = get_block_size(size_class);
 
-    return i < m_min_block_size_lg2 ? m_min_block_size_lg2 : i;
+    if (0 == m_size_class_lg2) {
+      return offset & (block_size - 1)
+                 ? -1
+                 : int(offset >> (m_min_block_size_lg2 + size_class));
+    }
+    return (offset % block_size) ||
+                   (get_block_count(size_class) <= offset / block_size)
+               ? -1
+               : int(offset / block_size);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t get_block_id_hint(size_t alloc_size) const noexcept {
+    // Fast query clock register 'tic' to pseudo-randomize
+    // the guess for which block within a superblock should
+    // be claimed.  If not available then a search occurs.
+#if defined(KOKKOS_ENABLE_SYCL) && !defined(KOKKOS_ARCH_INTEL_GPU)
+    return alloc_size;
+#else
+    (void)alloc_size;
+    return (uint32_t)(Kokkos::Impl::clock_tic()
+#ifdef __CUDA_ARCH__  // FIXME_CUDA
+                      // Spread out potentially concurrent access
+                      // by threads within a warp or thread block.
+                      + (threadIdx.x + blockDim.x * threadIdx.y)
+#endif
+    );
+#endif
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t *get_cache(int slot, uint32_t size_class) const noexcept {
+    return m_sb_state_array + m_cache_offset +
+           (slot * m_class_count + size_class) * CACHE_WORDS;
   }
 
  public:
@@ -471,15 +646,20 @@ class MemoryPool {
   KOKKOS_INLINE_FUNCTION
   uint32_t allocate_block_size(uint64_t alloc_size) const noexcept {
     return alloc_size <= (1UL << m_max_block_size_lg2)
-               ? (1UL << get_block_size_lg2(uint32_t(alloc_size)))
+               ? get_block_size(get_size_class(uint32_t(alloc_size)))
                : 0;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  int number_of_cache_slots() const noexcept { return m_cache_count; }
+
   //--------------------------------------------------------------------------
   /**\brief  Allocate a block of memory that is at least 'alloc_size'
    *
    *  The block of memory is aligned to the minimum block size,
    *  currently is 64 bytes, will never be less than 32 bytes.
+   *  With several size classes per doubling the alignment is the minimum
+   *  block size divided by the number of classes per doubling.
    *
    *  If concurrent allocations and deallocations are taking place
    *  then a single allocation attempt may fail due to lack of available space.
@@ -495,16 +675,223 @@ class MemoryPool {
 
     if (0 == alloc_size) return nullptr;
 
-    void *p = nullptr;
+    return allocate_block(get_size_class(alloc_size),
+                          get_block_id_hint(alloc_size), attempt_limit);
+  }
+  // end allocate
+  //--------------------------------------------------------------------------
+
+  /**\brief  Allocate through the cache of 'slot'.
+   *
+   *  The cache holds up to 16 free blocks per size class that stay claimed
+   *  in their superblocks, so most calls neither search superblocks nor use
+   *  atomic operations.  An empty cache is refilled with several blocks at
+   *  once.  'slot' must be in [0, number_of_cache_slots()) and used by only
+   *  one thread at a time, e.g. the id acquired from a UniqueToken.  Without
+   *  cache slots this is allocate( alloc_size , attempt_limit ).
+   *
+   *  Blocks can be returned with either deallocate or deallocate_cached.
+   */
+  KOKKOS_FUNCTION
+  void *allocate_cached(int slot, size_t alloc_size,
+                        int32_t attempt_limit = 1) const noexcept {
+    if (size_t(1LU << m_max_block_size_lg2) < alloc_size) {
+      Kokkos::abort(
+          "Kokkos MemoryPool allocation request exceeded specified maximum "
+          "allocation size");
+    }
+
+    if (0 == alloc_size) return nullptr;
+
+    const uint32_t size_class    = get_size_class(alloc_size);
+    const uint32_t block_id_hint = get_block_id_hint(alloc_size);
+
+    if (slot < 0 || m_cache_count <= slot) {
+      return allocate_block(size_class, block_id_hint, attempt_limit);
+    }
+
+    uint32_t *const cache  = get_cache(slot, size_class);
+    uint64_t *const blocks = reinterpret_cast<uint64_t *>(cache + 2);
+    char *const data       = (char *)(m_sb_state_array + m_data_offset);
+
+    uint32_t count = cache[0];
+
+    if (0 == count) {
+      // Refill half of the cache, the first block is returned
+
+      void *const p = allocate_block(size_class, block_id_hint, attempt_limit);
+
+      if (nullptr == p) return nullptr;
+
+      for (; count < CACHE_SIZE / 2; ++count) {
+        void *const q =
+            allocate_block(size_class, block_id_hint + count + 1, 1);
+
+        if (nullptr == q) break;
+
+        blocks[count] = static_cast<char *>(q) - data;
+      }
+
+      cache[0] = count;
+
+      return p;
+    }
+
+    cache[0] = --count;
+
+    return data + blocks[count];
+  }
+
+  /**\brief  Return an allocated block of memory to the cache of 'slot'.
+   *
+   *  A full cache first returns half of its blocks to the pool.  Unlike
+   *  deallocate, returning the same block twice is not detected until the
+   *  block leaves the cache.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void deallocate_cached(int slot, void *p, size_t alloc_size) const noexcept {
+    if (nullptr == p) return;
+
+    if (slot < 0 || m_cache_count <= slot) {
+      deallocate(p, alloc_size);
+      return;
+    }
+
+    char *const data = (char *)(m_sb_state_array + m_data_offset);
+    const ptrdiff_t d = static_cast<char *>(p) - data;
+
+    // Verify contained within the memory pool's superblocks and the
+    // beginning of a block:
+    int size_class = -1;
+
+    if ((0 <= d) && (size_t(d) < (size_t(m_sb_count) << m_sb_size_lg2))) {
+      const uint32_t block_state =
+          ((volatile uint32_t *)m_sb_state_array)[(d >> m_sb_size_lg2) *
+                                                  m_sb_state_size] &
+          state_header_mask;
+
+      size_class = get_state_size_class(block_state);
+
+      if (get_block_index(d & ((ptrdiff_t(1) << m_sb_size_lg2) - 1),
+                          size_class) < 0) {
+        size_class = -1;
+      }
+    }
+
+    if (size_class < 0) {
+      Kokkos::abort(
+          "Kokkos MemoryPool::deallocate_cached given erroneous pointer");
+    }
+
+    uint32_t *const cache  = get_cache(slot, size_class);
+    uint64_t *const blocks = reinterpret_cast<uint64_t *>(cache + 2);
+
+    uint32_t count = cache[0];
+
+    if (CACHE_SIZE == count) {
+      for (count = CACHE_SIZE / 2; count < CACHE_SIZE; ++count) {
+        deallocate(data + blocks[count], 0);
+      }
+      count = CACHE_SIZE / 2;
+    }
+
+    blocks[count] = d;
+    cache[0]      = count + 1;
+  }
+
+  /**\brief  Return the blocks held in all caches to the pool.
+   *
+   *  Must not run concurrently with allocate_cached or deallocate_cached.
+   */
+  template <typename ExecutionSpace = typename DeviceType::execution_space>
+  void flush_cached() const {
+    if (0 == m_cache_count) return;
+
+    const MemoryPool self = *this;
+
+    Kokkos::parallel_for(
+        "Kokkos::MemoryPool::flush_cached",
+        Kokkos::RangePolicy<ExecutionSpace>(0, m_cache_count * m_class_count),
+        KOKKOS_LAMBDA(int i) {
+          uint32_t *const cache =
+              self.m_sb_state_array + self.m_cache_offset + i * CACHE_WORDS;
+          uint64_t *const blocks = reinterpret_cast<uint64_t *>(cache + 2);
+          char *const data =
+              (char *)(self.m_sb_state_array + self.m_data_offset);
+
+          for (uint32_t k = 0; k < cache[0]; ++k) {
+            self.deallocate(data + blocks[k], 0);
+          }
+          cache[0] = 0;
+        });
+    ExecutionSpace().fence(
+        "MemoryPool::flush_cached(): fence after returning cached blocks");
+  }
+
+  /**\brief  Return an allocated block of memory to the pool.
+   *
+   *  Requires: p is return value from allocate( alloc_size );
+   *
+   *  For now the alloc_size is ignored.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void deallocate(void *p, size_t /* alloc_size */) const noexcept {
+    if (nullptr == p) return;
+
+    // Determine which superblock and block
+    const ptrdiff_t d =
+        static_cast<char *>(p) -
+        reinterpret_cast<char *>(m_sb_state_array + m_data_offset);
+
+    // Verify contained within the memory pool's superblocks:
+    const int ok_contains =
+        (0 <= d) && (size_t(d) < (size_t(m_sb_count) << m_sb_size_lg2));
+
+    int ok_block_aligned = 0;
+    int ok_dealloc_once  = 0;
+
+    if (ok_contains) {
+      const int sb_id = d >> m_sb_size_lg2;
+
+      // State array for the superblock.
+      volatile uint32_t *const sb_state_array =
+          m_sb_state_array + (sb_id * m_sb_state_size);
+
+      const uint32_t block_state = (*sb_state_array) & state_header_mask;
 
-    const uint32_t block_size_lg2 = get_block_size_lg2(alloc_size);
+      // Map address to block's bit
+      // mask into superblock and then divide down for block index
+
+      const int bit =
+          get_block_index(d & (ptrdiff_t(1LU << m_sb_size_lg2) - 1),
+                          get_state_size_class(block_state));
+
+      ok_block_aligned = 0 <= bit;
+
+      if (ok_block_aligned) {
+        const int result = CB::release(sb_state_array, bit, block_state);
+
+        ok_dealloc_once = 0 <= result;
+      }
+    }
+
+    if (!ok_contains || !ok_block_aligned || !ok_dealloc_once) {
+      Kokkos::abort("Kokkos MemoryPool::deallocate given erroneous pointer");
+    }
+  }
+  // end deallocate
+
+ private:
+  KOKKOS_FUNCTION
+  void *allocate_block(uint32_t size_class, uint32_t block_id_hint,
+                       int32_t attempt_limit) const noexcept {
+    void *p = nullptr;
 
     // Allocation will fit within a superblock
-    // that has block sizes ( 1 << block_size_lg2 )
+    // that has blocks of this size class
 
-    const uint32_t block_count_lg2 = m_sb_size_lg2 - block_size_lg2;
-    const uint32_t block_state     = block_count_lg2 << state_shift;
-    const uint32_t block_count     = 1u << block_count_lg2;
+    const uint32_t block_state = get_size_class_state(size_class);
+    const uint32_t block_count = get_block_count(size_class);
 
     // Superblock hints for this block size:
     //   hint_sb_id_ptr[0] is the dynamically changing hint
@@ -514,26 +901,10 @@ class MemoryPool {
         m_sb_state_array      /* memory pool state array */
         + m_hint_offset       /* offset to hint portion of array */
         + HINT_PER_BLOCK_SIZE /* number of hints per block size */
-              * (block_size_lg2 - m_min_block_size_lg2); /* block size id */
+              * size_class; /* block size id */
 
     const int32_t sb_id_begin = int32_t(hint_sb_id_ptr[1]);
 
-    // Fast query clock register 'tic' to pseudo-randomize
-    // the guess for which block within a superblock should
-    // be claimed.  If not available then a search occurs.
-#if defined(KOKKOS_ENABLE_SYCL) && !defined(KOKKOS_ARCH_INTEL_GPU)
-    const uint32_t block_id_hint = alloc_size;
-#else
-    const uint32_t block_id_hint =
-        (uint32_t)(Kokkos::Impl::clock_tic()
-#ifdef __CUDA_ARCH__  // FIXME_CUDA
-                   // Spread out potentially concurrent access
-                   // by threads within a warp or thread block.
-                   + (threadIdx.x + blockDim.x * threadIdx.y)
-#endif
-        );
-#endif
-
     // expected state of superblock for allocation
     uint32_t sb_state = block_state;
 
@@ -561,11 +932,12 @@ class MemoryPool {
         // Attempt to claim a bit.  The attempt updates the state
         // so have already made sure the state header is as expected.
 
-        const uint32_t count_lg2 = sb_state >> state_shift;
-        const uint32_t mask      = (1u << count_lg2) - 1;
+        const uint32_t sb_class = get_state_size_class(sb_state);
+        const uint32_t count    = get_block_count(sb_class);
+        const uint32_t mask     = (1u << Kokkos::Impl::int_log2(count)) - 1;
 
-        const Kokkos::pair<int, int> result = CB::acquire_bounded_lg2(
-            sb_state_array, count_lg2, block_id_hint & mask, sb_state);
+        const Kokkos::pair<int, int> result = CB::acquire_bounded(
+            sb_state_array, count, block_id_hint & mask, sb_state);
 
         // If result.first < 0 then failed to acquire
         // due to either full or buffer was wrong state.
@@ -574,13 +946,11 @@ class MemoryPool {
 
         if (0 <= result.first) {  // acquired a bit
 
-          const uint32_t size_lg2 = m_sb_size_lg2 - count_lg2;
-
           // Set the allocated block pointer
 
           p = ((char *)(m_sb_state_array + m_data_offset)) +
-              (uint64_t(sb_id) << m_sb_size_lg2)       // superblock memory
-              + (uint64_t(result.first) << size_lg2);  // block memory
+              (uint64_t(sb_id) << m_sb_size_lg2)  // superblock memory
+              + uint64_t(result.first) * get_block_size(sb_class);  // block
 
           break;  // Success
         }
@@ -642,7 +1012,7 @@ class MemoryPool {
                    (-1 == sb_id_large /* have not found a larger */) &&
                    (state < block_state /* a larger block */) &&
                    // is not full:
-                   (used < (1u << (state >> state_shift)))) {
+                   (used < get_block_count(get_state_size_class(state)))) {
           //  First superblock encountered that is
           //  larger than this block size and
           //  has room for an allocation.
@@ -709,62 +1079,8 @@ class MemoryPool {
 
     return p;
   }
-  // end allocate
-  //--------------------------------------------------------------------------
-
-  /**\brief  Return an allocated block of memory to the pool.
-   *
-   *  Requires: p is return value from allocate( alloc_size );
-   *
-   *  For now the alloc_size is ignored.
-   */
-  KOKKOS_INLINE_FUNCTION
-  void deallocate(void *p, size_t /* alloc_size */) const noexcept {
-    if (nullptr == p) return;
-
-    // Determine which superblock and block
-    const ptrdiff_t d =
-        static_cast<char *>(p) -
-        reinterpret_cast<char *>(m_sb_state_array + m_data_offset);
-
-    // Verify contained within the memory pool's superblocks:
-    const int ok_contains =
-        (0 <= d) && (size_t(d) < (size_t(m_sb_count) << m_sb_size_lg2));
 
-    int ok_block_aligned = 0;
-    int ok_dealloc_once  = 0;
-
-    if (ok_contains) {
-      const int sb_id = d >> m_sb_size_lg2;
-
-      // State array for the superblock.
-      volatile uint32_t *const sb_state_array =
-          m_sb_state_array + (sb_id * m_sb_state_size);
-
-      const uint32_t block_state = (*sb_state_array) & state_header_mask;
-      const uint32_t block_size_lg2 =
-          m_sb_size_lg2 - (block_state >> state_shift);
-
-      ok_block_aligned = 0 == (d & ((1UL << block_size_lg2) - 1));
-
-      if (ok_block_aligned) {
-        // Map address to block's bit
-        // mask into superblock and then shift down for block index
-
-        const uint32_t bit =
-            (d & (ptrdiff_t(1LU << m_sb_size_lg2) - 1)) >> block_size_lg2;
-
-        const int result = CB::release(sb_state_array, bit, block_state);
-
-        ok_dealloc_once = 0 <= result;
-      }
-    }
-
-    if (!ok_contains || !ok_block_aligned || !ok_dealloc_once) {
-      Kokkos::abort("Kokkos MemoryPool::deallocate given erroneous pointer");
-    }
-  }
-  // end deallocate
+ public:
   //--------------------------------------------------------------------------
 
   KOKKOS_INLINE_FUNCTION
@@ -792,11 +1108,12 @@ class MemoryPool {
       const uint32_t state =
           ((uint32_t volatile *)m_sb_state_array)[sb_id * m_sb_state_size];
 
-      const uint32_t block_count_lg2 = state >> state_shift;
-      const uint32_t block_used      = state & state_used_mask;
+      const uint32_t size_class =
+          get_state_size_class(state & state_header_mask);
+      const uint32_t block_used = state & state_used_mask;
 
-      block_size           = 1LU << (m_sb_size_lg2 - block_count_lg2);
-      block_count_capacity = 1LU << block_count_lg2;
+      block_size           = get_block_size(size_class);
+      block_count_capacity = get_block_count(size_class);
       block_count_used     = block_used;
     }
   }
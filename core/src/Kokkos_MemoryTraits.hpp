@@ -37,11 +37,12 @@ namespace Kokkos {
  *  these traits are present.
  */
 enum MemoryTraitsFlags {
-  Unmanaged    = 0x01,
-  RandomAccess = 0x02,
-  Atomic       = 0x04,
-  Restrict     = 0x08,
-  Aligned      = 0x10
+  Unmanaged       = 0x01,
+  RandomAccess    = 0x02,
+  Atomic          = 0x04,
+  Restrict        = 0x08,
+  Aligned         = 0x10,
+  AtomicCombining = 0x20
 };
 
 template <unsigned T>
@@ -55,8 +56,13 @@ struct MemoryTraits {
       (unsigned(0) != (T & unsigned(Kokkos::Unmanaged)));
   static constexpr bool is_random_access =
       (unsigned(0) != (T & unsigned(Kokkos::RandomAccess)));
+  // Combining views are atomic views whose additive updates from host
+  // threads are buffered per thread and flushed at the end of the kernel.
   static constexpr bool is_atomic =
-      (unsigned(0) != (T & unsigned(Kokkos::Atomic)));
+      (unsigned(0) !=
+       (T & (unsigned(Kokkos::Atomic) | unsigned(Kokkos::AtomicCombining))));
+  static constexpr bool is_atomic_combining =
+      (unsigned(0) != (T & unsigned(Kokkos::AtomicCombining)));
   static constexpr bool is_restrict =
       (unsigned(0) != (T & unsigned(Kokkos::Restrict)));
   static constexpr bool is_aligned =
@@ -35,6 +35,8 @@ static_assert(false,
 
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
+#include <impl/Kokkos_GraphImpl_fwd.hpp>
+#include <impl/Kokkos_HostAtomicCombining.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -132,6 +134,11 @@ template <
     class Enable = std::enable_if_t<is_execution_policy<ExecPolicy>::value>>
 inline void parallel_for(const std::string& str, const ExecPolicy& policy,
                          const FunctorType& functor) {
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+  if (Impl::graph_capture_active() &&
+      Impl::graph_capture_parallel_for(str, policy, functor))
+    return;
+#endif
   uint64_t kpID = 0;
 
   /** Request a tuned policy from the tools subsystem */
@@ -144,6 +151,7 @@ inline void parallel_for(const std::string& str, const ExecPolicy& policy,
           Impl::ParallelFor<FunctorType, ExecPolicy>>(functor, inner_policy);
 
   closure.execute();
+  Kokkos::Impl::host_atomic_combining_flush();
 
   Kokkos::Tools::Impl::end_parallel_for(inner_policy, functor, str, kpID);
 }
@@ -350,6 +358,10 @@ template <class ExecutionPolicy, class FunctorType,
               std::enable_if_t<is_execution_policy<ExecutionPolicy>::value>>
 inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                           const FunctorType& functor) {
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+  if (Impl::graph_capture_active())
+    Impl::graph_capture_reject(policy.space(), "Kokkos::parallel_scan");
+#endif
   uint64_t kpID = 0;
   /** Request a tuned policy from the tools subsystem */
   const auto& response =
@@ -362,6 +374,7 @@ inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                                                             inner_policy);
 
   closure.execute();
+  Kokkos::Impl::host_atomic_combining_flush();
 
   Kokkos::Tools::Impl::end_parallel_scan(inner_policy, functor, str, kpID);
 }
@@ -397,6 +410,10 @@ template <class ExecutionPolicy, class FunctorType, class ReturnType,
 inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                           const FunctorType& functor,
                           ReturnType& return_value) {
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+  if (Impl::graph_capture_active())
+    Impl::graph_capture_reject(policy.space(), "Kokkos::parallel_scan");
+#endif
   uint64_t kpID                = 0;
   ExecutionPolicy inner_policy = policy;
   Kokkos::Tools::Impl::begin_parallel_scan(inner_policy, functor, str, kpID);
@@ -417,6 +434,7 @@ inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                                                      view);
     closure.execute();
   }
+  Kokkos::Impl::host_atomic_combining_flush();
 
   Kokkos::Tools::Impl::end_parallel_scan(inner_policy, functor, str, kpID);
 
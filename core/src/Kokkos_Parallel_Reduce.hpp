@@ -25,6 +25,7 @@ static_assert(false,
 #include <Kokkos_ReductionIdentity.hpp>
 #include <Kokkos_View.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
+#include <impl/Kokkos_GraphImpl_fwd.hpp>
 #include <impl/Kokkos_Tools_Generic.hpp>
 #include <type_traits>
 
@@ -1510,6 +1511,12 @@ struct ParallelReduceAdaptor {
                                   const PolicyType& policy,
                                   const FunctorType& functor,
                                   ReturnType& return_value) {
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+    if (Impl::graph_capture_active() &&
+        Impl::graph_capture_parallel_reduce(label, policy, functor,
+                                            return_value))
+      return;
+#endif
     using PassedReducerType = typename return_value_adapter::reducer_type;
     uint64_t kpID           = 0;
 
@@ -1537,6 +1544,7 @@ struct ParallelReduceAdaptor {
         functor_reducer, inner_policy,
         return_value_adapter::return_value(return_value, functor));
     closure.execute();
+    Kokkos::Impl::host_atomic_combining_flush();
 
     Kokkos::Tools::Impl::end_parallel_reduce<PassedReducerType>(
         inner_policy, functor, label, kpID);
@@ -27,5 +27,6 @@ static_assert(false,
 #endif
 
 #include <View/Kokkos_ViewLegacy.hpp>
+#include <View/Kokkos_ViewBorrow.hpp>
 
 #endif /* KOKKOS_VIEW_HPP */
@@ -24,6 +24,7 @@
 #include <OpenMP/Kokkos_OpenMP_Instance.hpp>
 
 #include <impl/Kokkos_ExecSpaceManager.hpp>
+#include <impl/Kokkos_HostAtomicCombining.hpp>
 
 namespace Kokkos {
 
@@ -84,6 +85,7 @@ void OpenMP::impl_static_fence(std::string const &name) {
           std::lock_guard<std::mutex> lock_instance(
               instance_ptr->m_instance_mutex);
         }
+        Impl::host_atomic_combining_flush();
       });
 }
 
@@ -93,6 +95,7 @@ void OpenMP::fence(const std::string &name) const {
       [this]() {
         auto *internal_instance = this->impl_internal_space_instance();
         std::lock_guard<std::mutex> lock(internal_instance->m_instance_mutex);
+        Impl::host_atomic_combining_flush();
       });
 }
 
@@ -25,15 +25,19 @@
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 namespace {
 int g_openmp_hardware_max_threads = 1;
-}
+}  // namespace
 
 namespace Kokkos {
 namespace Impl {
@@ -45,14 +49,48 @@ int OpenMPInternal::max_hardware_threads() noexcept {
   return g_openmp_hardware_max_threads;
 }
 
-void OpenMPInternal::clear_thread_data() {
-  const size_t member_bytes =
-      sizeof(int64_t) *
-      HostThreadTeamData::align_to_int64(sizeof(HostThreadTeamData));
+int OpenMPInternal::next_instance_id() noexcept {
+  static std::atomic<int> count{0};
+  return count++;
+}
+
+void OpenMPInternal::set_thread_coordinates(
+    std::vector<std::pair<unsigned, unsigned>> thread_coord) {
+  if (int(thread_coord.size()) < m_pool_size) {
+    Kokkos::abort(
+        "Kokkos::OpenMP ERROR: fewer core coordinates than pool threads");
+  }
+  m_thread_coord = std::move(thread_coord);
+}
+
+void OpenMPInternal::bind_threads_impl() {
+  // The OpenMP runtimes reuse the threads of a team for the following
+  // parallel regions started by the same thread, so the binding only has
+  // to be redone when this thread switches instances.
+  if (t_bound_instance == m_instance_id) return;
+
+  if (m_thread_coord.empty()) {
+    // An unbound instance gets the process binding back
+    unbind_threads();
+    return;
+  }
+
+#pragma omp parallel num_threads(m_pool_size)
+  { Kokkos::hwloc::bind_this_thread(m_thread_coord[omp_get_thread_num()]); }
 
-  const int old_alloc_bytes =
-      m_pool[0] ? (member_bytes + m_pool[0]->scratch_bytes()) : 0;
+  t_bound_instance  = m_instance_id;
+  t_bound_team_size = m_pool_size;
+}
+
+void OpenMPInternal::unbind_threads() {
+#pragma omp parallel num_threads(t_bound_team_size)
+  { Kokkos::hwloc::unbind_this_thread(); }
+
+  t_bound_instance  = -1;
+  t_bound_team_size = 0;
+}
 
+void OpenMPInternal::clear_thread_data() {
   OpenMP::memory_space space;
 
   for (int rank = 0; rank < m_pool_size; ++rank) {
@@ -61,11 +99,12 @@ void OpenMPInternal::clear_thread_data() {
 
       m_pool[rank]->~HostThreadTeamData();
 
-      space.deallocate(m_pool[rank], old_alloc_bytes);
+      space.deallocate(m_pool[rank], m_thread_data_bytes);
 
       m_pool[rank] = nullptr;
     }
   }
+  m_thread_data_bytes = 0;
 }
 
 void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
@@ -82,8 +121,7 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
   const size_t old_team_reduce  = root ? root->team_reduce_bytes() : 0;
   const size_t old_team_shared  = root ? root->team_shared_bytes() : 0;
   const size_t old_thread_local = root ? root->thread_local_bytes() : 0;
-  const size_t old_alloc_bytes =
-      root ? (member_bytes + root->scratch_bytes()) : 0;
+  const size_t old_alloc_bytes  = root ? m_thread_data_bytes : 0;
 
   // Allocate if any of the old allocation is tool small:
 
@@ -102,35 +140,86 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
     if (team_shared_bytes < old_team_shared) {
       team_shared_bytes = old_team_shared;
     }
-    if (thread_local_bytes < old_thread_local) {
-      thread_local_bytes = old_thread_local;
-    }
+    // thread local memory is the tail of the block and takes up any slack,
+    // so it does not carry over.
 
-    const size_t alloc_bytes =
+    const size_t required_bytes =
         member_bytes +
         HostThreadTeamData::scratch_size(pool_reduce_bytes, team_reduce_bytes,
                                          team_shared_bytes, thread_local_bytes);
 
-    OpenMP::memory_space space;
-
     memory_fence();
 
     for (int rank = 0; rank < m_pool_size; ++rank) {
-      if (nullptr != m_pool[rank]) {
-        m_pool[rank]->disband_pool();
+      if (nullptr != m_pool[rank]) m_pool[rank]->disband_pool();
+    }
 
-        // impl_deallocate to not fence here
-        space.impl_deallocate("[unlabeled]", m_pool[rank], old_alloc_bytes);
+    if (required_bytes <= old_alloc_bytes) {
+      // The slack left by an earlier regrowth is enough: only move the
+      // boundaries between the parts of each block.
+      for (int rank = 0; rank < m_pool_size; ++rank) {
+        m_pool[rank]->scratch_assign(
+            reinterpret_cast<char *>(m_pool[rank]) + member_bytes,
+            old_alloc_bytes - member_bytes, pool_reduce_bytes,
+            team_reduce_bytes, team_shared_bytes, thread_local_bytes);
+      }
+    } else {
+      // Grow geometrically so that a sequence of slightly larger requests
+      // does not reallocate every time.
+      const size_t alloc_bytes =
+          std::max(required_bytes, old_alloc_bytes + old_alloc_bytes / 2);
+
+      // Allocate serially so that the memory space and its Tools callbacks
+      // are only entered from the calling thread.
+      OpenMP::memory_space space;
+      for (int rank = 0; rank < m_pool_size; ++rank) {
+        if (nullptr != m_pool[rank]) {
+          m_pool[rank]->~HostThreadTeamData();
+          // impl_deallocate to not fence here
+          space.impl_deallocate("[unlabeled]", m_pool[rank], old_alloc_bytes);
+          m_pool[rank] = nullptr;
+        }
+      }
+      m_thread_data_bytes = 0;
+
+      std::vector<void *> blocks(m_pool_size, nullptr);
+      try {
+        for (int rank = 0; rank < m_pool_size; ++rank) {
+          blocks[rank] =
+              space.allocate("Kokkos::OpenMP::scratch_mem", alloc_bytes);
+        }
+      } catch (...) {
+        for (void *ptr : blocks) {
+          if (nullptr != ptr) {
+            space.impl_deallocate("Kokkos::OpenMP::scratch_mem", ptr,
+                                  alloc_bytes);
+          }
+        }
+        throw;
+      }
+      m_thread_data_bytes = alloc_bytes;
+
+      // Each thread first touches its own block so that the pages land on
+      // the thread's NUMA node.  Threads missing from the region, e.g. when
+      // nested parallelism is disabled, are covered by the others.  Only the
+      // reduction buffers are touched here: team shared and thread local
+      // memory can be huge and get touched by their first use on the same
+      // thread.
+      const size_t touch_bytes = HostThreadTeamData::scratch_size(
+          pool_reduce_bytes, team_reduce_bytes, 0, 0);
+#pragma omp parallel num_threads(m_pool_size)
+      {
+        for (int rank = omp_get_thread_num(); rank < m_pool_size;
+             rank += omp_get_num_threads()) {
+          char *scratch = static_cast<char *>(blocks[rank]) + member_bytes;
+          std::memset(scratch, 0, touch_bytes);
+
+          m_pool[rank] = new (blocks[rank]) HostThreadTeamData();
+          m_pool[rank]->scratch_assign(
+              scratch, alloc_bytes - member_bytes, pool_reduce_bytes,
+              team_reduce_bytes, team_shared_bytes, thread_local_bytes);
+        }
       }
-
-      void *ptr = space.allocate("Kokkos::OpenMP::scratch_mem", alloc_bytes);
-
-      m_pool[rank] = new (ptr) HostThreadTeamData();
-
-      m_pool[rank]->scratch_assign(static_cast<char *>(ptr) + member_bytes,
-                                   alloc_bytes, pool_reduce_bytes,
-                                   team_reduce_bytes, team_shared_bytes,
-                                   thread_local_bytes);
     }
 
     HostThreadTeamData::organize_pool(m_pool, m_pool_size);
@@ -291,6 +380,9 @@ void OpenMPInternal::finalize() {
 
   m_initialized = false;
 
+  // Give the threads back to the process binding
+  if (t_bound_instance == m_instance_id) unbind_threads();
+
   // guard erasing from all_instances
   {
     std::scoped_lock lock(all_instances_mutex);
@@ -329,4 +421,41 @@ bool OpenMPInternal::verify_is_initialized(const char *const label) const {
   return m_initialized;
 }
 }  // namespace Impl
+
+std::vector<OpenMP> Experimental::partition_space_by_numa(
+    OpenMP const &main_instance) {
+  int const main_pool_size =
+      main_instance.impl_internal_space_instance()->thread_pool_size();
+
+  if (!Kokkos::hwloc::available()) return {OpenMP(main_pool_size)};
+
+  unsigned const numa_count = Kokkos::hwloc::get_available_numa_count();
+  unsigned const cores_per_numa =
+      Kokkos::hwloc::get_available_cores_per_numa();
+  bool const bind = Kokkos::hwloc::can_bind_threads();
+
+  int const partition_count = std::min<int>(numa_count, main_pool_size);
+
+  std::vector<OpenMP> instances;
+  instances.reserve(partition_count);
+  for (int p = 0; p < partition_count; ++p) {
+    // Spread the remainder over the first partitions
+    int const pool_size = main_pool_size / partition_count +
+                          (p < main_pool_size % partition_count ? 1 : 0);
+    instances.emplace_back(pool_size);
+
+    if (bind) {
+      // One thread per core before placing a second one on any core, so
+      // that SMT siblings only share a core within the same instance.
+      std::vector<std::pair<unsigned, unsigned>> coord(pool_size);
+      for (int t = 0; t < pool_size; ++t) {
+        coord[t] = std::pair<unsigned, unsigned>(p, t % cores_per_numa);
+      }
+      instances.back().impl_internal_space_instance()->set_thread_coordinates(
+          std::move(coord));
+    }
+  }
+  return instances;
+}
+
 }  // namespace Kokkos
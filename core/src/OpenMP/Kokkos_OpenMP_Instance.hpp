@@ -38,6 +38,7 @@
 #include <mutex>
 #include <numeric>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 /*--------------------------------------------------------------------------*/
@@ -54,7 +55,10 @@ struct OpenMPTraits {
 class OpenMPInternal {
  private:
   OpenMPInternal(int arg_pool_size)
-      : m_pool_size{arg_pool_size}, m_level{omp_get_level()}, m_pool() {
+      : m_pool_size{arg_pool_size},
+        m_level{omp_get_level()},
+        m_pool(),
+        m_instance_id{next_instance_id()} {
     // guard pushing to all_instances
     {
       std::scoped_lock lock(all_instances_mutex);
@@ -68,6 +72,17 @@ class OpenMPInternal {
 
   static int get_current_max_threads() noexcept;
 
+  static int next_instance_id() noexcept;
+
+  void bind_threads_impl();
+
+  static void unbind_threads();
+
+  // Instance whose coordinates the team of the calling thread is bound to
+  // and the size of that team, -1 and 0 for the process binding
+  static inline thread_local int t_bound_instance  = -1;
+  static inline thread_local int t_bound_team_size = 0;
+
   bool m_initialized = false;
 
   int m_pool_size;
@@ -75,6 +90,15 @@ class OpenMPInternal {
 
   HostThreadTeamData* m_pool[OpenMPTraits::MAX_THREAD_COUNT];
 
+  // Bytes allocated for each entry of m_pool, including slack for regrowth
+  size_t m_thread_data_bytes = 0;
+
+  // (NUMA region, core) coordinate each thread of a topology partition is
+  // bound to, see partition_space_by_numa. Empty if the threads are not bound.
+  std::vector<std::pair<unsigned, unsigned>> m_thread_coord;
+
+  int m_instance_id;
+
  public:
   friend class Kokkos::OpenMP;
 
@@ -103,6 +127,17 @@ class OpenMPInternal {
 
   int get_level() const { return m_level; }
 
+  void set_thread_coordinates(
+      std::vector<std::pair<unsigned, unsigned>> thread_coord);
+
+  // Bind the team of the calling thread to the cores of this instance, or
+  // back to the process binding if this instance is not bound.  Must be
+  // called before the thread data is allocated so that scratch memory is
+  // first touched on the right NUMA region.
+  void bind_threads() {
+    if (!m_thread_coord.empty() || t_bound_instance != -1) bind_threads_impl();
+  }
+
   bool is_initialized() const { return m_initialized; }
 
   bool verify_is_initialized(const char* const label) const;
@@ -182,6 +217,13 @@ std::vector<OpenMP> partition_space(OpenMP const& main_instance,
                                     std::vector<T> const& weights) {
   return Impl::create_OpenMP_instances(main_instance, weights);
 }
+
+// Partitioning an Execution Space along the hardware topology: one instance
+// per available NUMA region, with the threads of each instance bound to the
+// cores of that region.  Threads are spread over the cores first and only
+// share a core with an SMT sibling of the same instance.  Without hwloc a
+// single instance with the threads of main_instance is returned.
+std::vector<OpenMP> partition_space_by_numa(OpenMP const& main_instance);
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -39,6 +39,7 @@ static_assert(false,
 #include <Kokkos_ScratchSpace.hpp>
 #include <Kokkos_MemoryTraits.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_HostAtomicCombining.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_HostSharedPtr.hpp>
@@ -154,6 +155,7 @@ class Serial {
             std::lock_guard<std::mutex> lock_instance(
                 instance_ptr->m_instance_mutex);
           }
+          Impl::host_atomic_combining_flush();
         });  // TODO: correct device ID
     Kokkos::memory_fence();
   }
@@ -165,6 +167,7 @@ class Serial {
         [this]() {
           auto* internal_instance = this->impl_internal_space_instance();
           std::lock_guard<std::mutex> lock(internal_instance->m_instance_mutex);
+          Impl::host_atomic_combining_flush();
         });  // TODO: correct device ID
     Kokkos::memory_fence();
   }
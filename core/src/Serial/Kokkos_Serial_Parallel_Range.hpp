@@ -48,6 +48,9 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::Serial> {
   }
 
  public:
+  const FunctorType& get_functor() const { return m_functor; }
+  const Policy& get_policy() const { return m_policy; }
+
   inline void execute() const {
     // caused a possibly codegen-related slowdown, especially in GCC 9-11
     // with KOKKOS_ARCH_NATIVE
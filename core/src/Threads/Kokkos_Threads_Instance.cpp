@@ -32,6 +32,7 @@
 #include <impl/Kokkos_CPUDiscovery.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
+#include <impl/Kokkos_HostAtomicCombining.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -81,8 +82,14 @@ inline unsigned fan_size(const unsigned rank, const unsigned size) {
 }
 
 void wait_yield(std::atomic<ThreadState> &flag, const ThreadState value) {
-  while (value == flag) {
-    std::this_thread::yield();
+  // Yield for the spin phase, then block until the state is changed
+  const int spin = host_wait_spin_iterations();
+  for (int i = 0; value == flag;) {
+    if (spin < ++i) {
+      host_wait_while_equal(wait_address(flag), static_cast<int>(value));
+    } else {
+      std::this_thread::yield();
+    }
   }
 }
 
@@ -115,7 +122,7 @@ void ThreadsInternal::driver() {
     (*s_current_function)(this_thread, s_current_function_arg);
 
     // Deactivate thread and wait for reactivation
-    this_thread.m_pool_state = ThreadState::Inactive;
+    set_state_and_wake(this_thread.m_pool_state, ThreadState::Inactive);
 
     wait_yield(this_thread.m_pool_state, ThreadState::Inactive);
   }
@@ -156,10 +163,11 @@ ThreadsInternal::ThreadsInternal()
       s_threads_pid[m_pool_rank] = std::this_thread::get_id();
 
       // Inform spawning process that the threads_exec entry has been set.
-      s_threads_process.m_pool_state = ThreadState::Active;
+      set_state_and_wake(s_threads_process.m_pool_state, ThreadState::Active);
     } else {
       // Inform spawning process that the threads_exec entry could not be set.
-      s_threads_process.m_pool_state = ThreadState::Terminating;
+      set_state_and_wake(s_threads_process.m_pool_state,
+                         ThreadState::Terminating);
     }
   } else {
     // Enables 'parallel_for' to execute on unitialized Threads device
@@ -193,7 +201,8 @@ ThreadsInternal::~ThreadsInternal() {
 
     atomic_compare_exchange(s_threads_exec + entry, this, nil);
 
-    s_threads_process.m_pool_state = ThreadState::Terminating;
+    set_state_and_wake(s_threads_process.m_pool_state,
+                       ThreadState::Terminating);
   }
 }
 
@@ -268,6 +277,7 @@ void ThreadsInternal::internal_fence() {
     Impl::spinwait_while_equal(s_threads_exec[0]->m_pool_state,
                                ThreadState::Active);
   }
+  host_atomic_combining_flush();
 
   s_current_function     = nullptr;
   s_current_function_arg = nullptr;
@@ -297,13 +307,13 @@ void ThreadsInternal::start(void (*func)(ThreadsInternal &, const void *),
   // s_current_function. The root thread is only set to active, we still need to
   // call s_current_function.
   for (int i = s_thread_pool_size[0]; 0 < i--;) {
-    s_threads_exec[i]->m_pool_state = ThreadState::Active;
+    set_state_and_wake(s_threads_exec[i]->m_pool_state, ThreadState::Active);
   }
 
   if (s_threads_process.m_pool_size) {
     // Master process is the root thread, run it:
     (*func)(s_threads_process, arg);
-    s_threads_process.m_pool_state = ThreadState::Inactive;
+    set_state_and_wake(s_threads_process.m_pool_state, ThreadState::Inactive);
   }
 }
 
@@ -333,16 +343,16 @@ void ThreadsInternal::execute_resize_scratch_in_serial() {
   for (unsigned i = s_thread_pool_size[0]; begin < i;) {
     ThreadsInternal &th = *s_threads_exec[--i];
 
-    th.m_pool_state = ThreadState::Active;
+    set_state_and_wake(th.m_pool_state, ThreadState::Active);
 
     wait_yield(th.m_pool_state, ThreadState::Active);
   }
 
   if (s_threads_process.m_pool_base) {
     deallocate_scratch_memory(s_threads_process);
-    s_threads_process.m_pool_state = ThreadState::Active;
+    set_state_and_wake(s_threads_process.m_pool_state, ThreadState::Active);
     first_touch_allocate_thread_private_scratch(s_threads_process, nullptr);
-    s_threads_process.m_pool_state = ThreadState::Inactive;
+    set_state_and_wake(s_threads_process.m_pool_state, ThreadState::Inactive);
   }
 
   s_current_function_arg = nullptr;
@@ -518,7 +528,7 @@ void ThreadsInternal::initialize(int thread_count_arg) {
         &execute_function_noop;  // Initialization work function
 
     for (unsigned ith = 1; ith < thread_count; ++ith) {
-      s_threads_process.m_pool_state = ThreadState::Inactive;
+      set_state_and_wake(s_threads_process.m_pool_state, ThreadState::Inactive);
 
       // If hwloc available then spawned thread will
       // choose its own entry in 's_threads_coord'
@@ -632,11 +642,12 @@ void ThreadsInternal::finalize() {
 
   for (unsigned i = s_thread_pool_size[0]; begin < i--;) {
     if (s_threads_exec[i]) {
-      s_threads_exec[i]->m_pool_state = ThreadState::Terminating;
+      set_state_and_wake(s_threads_exec[i]->m_pool_state,
+                         ThreadState::Terminating);
 
       wait_yield(s_threads_process.m_pool_state, ThreadState::Inactive);
 
-      s_threads_process.m_pool_state = ThreadState::Inactive;
+      set_state_and_wake(s_threads_process.m_pool_state, ThreadState::Inactive);
     }
 
     s_threads_pid[i] = std::thread::id();
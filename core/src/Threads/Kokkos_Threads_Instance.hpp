@@ -63,16 +63,13 @@ class ThreadsInternal {
   std::atomic<ThreadState> m_pool_state;  ///< State for global synchronizations
 
   // Members for dynamic scheduling
-  // Which thread am I stealing from currently
-  int m_current_steal_target;
+  // State of the random choice of the threads to steal from
+  unsigned m_steal_seed;
   // This thread's owned work_range
   alignas(16) Kokkos::pair<long, long> m_work_range;
   // Team Offset if one thread determines work_range for others
   long m_team_work_index;
 
-  // Is this thread stealing (i.e. its owned work_range is exhausted
-  bool m_stealing;
-
   static void global_lock();
   static void global_unlock();
 
@@ -141,7 +138,7 @@ class ThreadsInternal {
     }
 
     if (rev_rank) {
-      m_pool_state = ThreadState::Rendezvous;
+      set_state_and_wake(m_pool_state, ThreadState::Rendezvous);
       // Wait: Rendezvous -> Active
       spinwait_while_equal(m_pool_state, ThreadState::Rendezvous);
     } else {
@@ -161,7 +158,7 @@ class ThreadsInternal {
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadState::Active;
+        set_state_and_wake(get_thread(rank)->m_pool_state, ThreadState::Active);
       }
     }
 
@@ -182,7 +179,7 @@ class ThreadsInternal {
     }
 
     if (rev_rank) {
-      m_pool_state = ThreadState::Rendezvous;
+      set_state_and_wake(m_pool_state, ThreadState::Rendezvous);
       // Wait: Rendezvous -> Active
       spinwait_while_equal(m_pool_state, ThreadState::Rendezvous);
     } else {
@@ -191,7 +188,7 @@ class ThreadsInternal {
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadState::Active;
+        set_state_and_wake(get_thread(rank)->m_pool_state, ThreadState::Active);
       }
     }
   }
@@ -273,7 +270,7 @@ class ThreadsInternal {
 
     if (rev_rank) {
       // Set: Active -> ReductionAvailable
-      m_pool_state = ThreadState::ReductionAvailable;
+      set_state_and_wake(m_pool_state, ThreadState::ReductionAvailable);
 
       // Wait for contributing threads' scan value to be available.
       if ((1 << m_pool_fan_size) < (m_pool_rank + 1)) {
@@ -289,7 +286,7 @@ class ThreadsInternal {
 
       // This thread has completed inclusive scan
       // Set: ReductionAvailable -> ScanAvailable
-      m_pool_state = ThreadState::ScanAvailable;
+      set_state_and_wake(m_pool_state, ThreadState::ScanAvailable);
 
       // Wait for all threads to complete inclusive scan
       // Wait: ScanAvailable -> Rendezvous
@@ -303,7 +300,7 @@ class ThreadsInternal {
       // Wait: ReductionAvailable -> ScanAvailable
       spinwait_while_equal(fan.m_pool_state, ThreadState::ReductionAvailable);
       // Set: ScanAvailable -> Rendezvous
-      fan.m_pool_state = ThreadState::Rendezvous;
+      set_state_and_wake(fan.m_pool_state, ThreadState::Rendezvous);
     }
 
     // All threads have completed the inclusive scan.
@@ -335,13 +332,14 @@ class ThreadsInternal {
     }
     if (rev_rank) {
       // Set: ScanAvailable -> ScanCompleted
-      m_pool_state = ThreadState::ScanCompleted;
+      set_state_and_wake(m_pool_state, ThreadState::ScanCompleted);
       // Wait: ScanCompleted -> Active
       spinwait_while_equal(m_pool_state, ThreadState::ScanCompleted);
     }
     // Set: ScanCompleted -> Active
     for (int i = 0; i < m_pool_fan_size; ++i) {
-      m_pool_base[rev_rank + (1 << i)]->m_pool_state = ThreadState::Active;
+      set_state_and_wake(m_pool_base[rev_rank + (1 << i)]->m_pool_state,
+                         ThreadState::Active);
     }
   }
 
@@ -367,7 +365,7 @@ class ThreadsInternal {
     }
 
     if (rev_rank) {
-      m_pool_state = ThreadState::Rendezvous;
+      set_state_and_wake(m_pool_state, ThreadState::Rendezvous);
       // Wait: Rendezvous -> Active
       spinwait_while_equal(m_pool_state, ThreadState::Rendezvous);
     } else {
@@ -391,7 +389,8 @@ class ThreadsInternal {
     }
 
     for (int i = 0; i < m_pool_fan_size; ++i) {
-      m_pool_base[rev_rank + (1 << i)]->m_pool_state = ThreadState::Active;
+      set_state_and_wake(m_pool_base[rev_rank + (1 << i)]->m_pool_state,
+                         ThreadState::Active);
     }
   }
 
@@ -464,72 +463,61 @@ class ThreadsInternal {
 
   // Reset the steal target
   inline void reset_steal_target() {
-    m_current_steal_target = (m_pool_rank + 1) % pool_size();
-    m_stealing             = false;
-  }
-
-  // Reset the steal target
-  inline void reset_steal_target(int team_size) {
-    m_current_steal_target = (m_pool_rank_rev + team_size);
-    if (m_current_steal_target >= pool_size())
-      m_current_steal_target = 0;  // pool_size()-1;
-    m_stealing = false;
-  }
-
-  // Get a steal target; start with my-rank + 1 and go round robin, until
-  // arriving at this threads rank Returns -1 fi no active steal target
-  // available
-  inline int get_steal_target() {
-    while ((m_pool_base[m_current_steal_target]->m_work_range.second <=
-            m_pool_base[m_current_steal_target]->m_work_range.first) &&
-           (m_current_steal_target != m_pool_rank)) {
-      m_current_steal_target = (m_current_steal_target + 1) % pool_size();
-    }
-    if (m_current_steal_target == m_pool_rank)
-      return -1;
-    else
-      return m_current_steal_target;
+    // Any nonzero seed works for the xorshift generator
+    m_steal_seed = 2654435761u * (m_pool_rank + 1u);
   }
 
-  inline int get_steal_target(int team_size) {
-    while ((m_pool_base[m_current_steal_target]->m_work_range.second <=
-            m_pool_base[m_current_steal_target]->m_work_range.first) &&
-           (m_current_steal_target != m_pool_rank_rev)) {
-      if (m_current_steal_target + team_size < pool_size())
-        m_current_steal_target = (m_current_steal_target + team_size);
-      else
-        m_current_steal_target = 0;
-    }
-
-    if (m_current_steal_target == m_pool_rank_rev)
-      return -1;
-    else
-      return m_current_steal_target;
-  }
-
-  inline long steal_work_index(int team_size = 0) {
-    long index = -1;
-    int steal_target =
-        team_size > 0 ? get_steal_target(team_size) : get_steal_target();
-    while ((steal_target != -1) && (index == -1)) {
-      index = m_pool_base[steal_target]->get_work_index_end();
-      if (index == -1)
-        steal_target =
-            team_size > 0 ? get_steal_target(team_size) : get_steal_target();
+  // Steal the upper half of the range of another thread, visiting the
+  // threads from a random one so that idle threads spread over the victims.
+  // The first stolen index is returned and the rest of the stolen indices
+  // become this thread's range, where other threads may steal them again.
+  // With team_alloc > 0 only the team leaders, every team_alloc threads in
+  // the pool, own a range.
+  inline long steal_work_index(int team_alloc = 0) {
+    const int step        = team_alloc > 0 ? team_alloc : 1;
+    const int num_victims = pool_size() / step;
+
+    m_steal_seed ^= m_steal_seed << 13;
+    m_steal_seed ^= m_steal_seed >> 17;
+    m_steal_seed ^= m_steal_seed << 5;
+    const int start = m_steal_seed % num_victims;
+
+    for (int i = 0; i < num_victims; ++i) {
+      ThreadsInternal *const victim =
+          m_pool_base[((start + i) % num_victims) * step];
+      if (victim == this) continue;
+
+      Kokkos::pair<long, long> work_range_old = victim->m_work_range;
+      while (work_range_old.first < work_range_old.second) {
+        const long half =
+            (work_range_old.second - work_range_old.first + 1) / 2;
+        const Kokkos::pair<long, long> work_range_new(
+            work_range_old.first, work_range_old.second - half);
+        const Kokkos::pair<long, long> work_range =
+            Kokkos::atomic_compare_exchange(&victim->m_work_range,
+                                            work_range_old, work_range_new);
+        if (work_range == work_range_old) {
+          // This thread's range is exhausted, nobody else updates it
+          Kokkos::atomic_store(
+              &m_work_range,
+              Kokkos::pair<long, long>(work_range_new.second + 1,
+                                       work_range_old.second));
+          return work_range_new.second;
+        }
+        work_range_old = work_range;
+      }
     }
-    return index;
+    return -1;
   }
 
   // Get a work index. Claim from owned range until its exhausted, then steal
-  // from other thread
-  inline long get_work_index(int team_size = 0) {
-    long work_index = -1;
-    if (!m_stealing) work_index = get_work_index_begin();
+  // from other threads
+  inline long get_work_index(int team_alloc = 0) {
+    long work_index = get_work_index_begin();
 
     if (work_index == -1) {
       memory_fence();
-      m_stealing = true;
-      work_index = steal_work_index(team_size);
+      work_index = steal_work_index(team_alloc);
     }
 
     m_team_work_index = work_index;
@@ -107,6 +107,9 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
   }
 
  public:
+  const FunctorType& get_functor() const { return m_functor; }
+  const Policy& get_policy() const { return m_policy; }
+
   inline void execute() const {
     ThreadsInternal::start(&ParallelFor::exec, this);
     ThreadsInternal::fence();
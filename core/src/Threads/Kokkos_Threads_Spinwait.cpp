@@ -111,9 +111,15 @@ void host_thread_yield(const uint32_t i, const WaitMode mode) {
 void spinwait_while_equal(std::atomic<ThreadState> const& flag,
                           ThreadState const value) {
   Kokkos::store_fence();
-  uint32_t i = 0;
+  const uint32_t spin = host_wait_spin_iterations();
+  uint32_t i          = 0;
   while (value == flag) {
-    host_thread_yield(++i, WaitMode::ACTIVE);
+    if (spin < ++i) {
+      // Done spinning, block until the state is changed
+      host_wait_while_equal(wait_address(flag), static_cast<int>(value));
+    } else {
+      host_thread_yield(i, WaitMode::ACTIVE);
+    }
   }
   Kokkos::load_fence();
 }
@@ -18,6 +18,7 @@
 #define KOKKOS_THREADS_SPINWAIT_HPP
 
 #include <Threads/Kokkos_Threads_State.hpp>
+#include <impl/Kokkos_HostWait.hpp>
 
 #include <cstdint>
 #include <atomic>
@@ -38,6 +39,19 @@ void host_thread_yield(const uint32_t i, const WaitMode mode);
 void spinwait_while_equal(std::atomic<ThreadState> const& flag,
                           ThreadState const value);
 
+// Address of a thread state for host_wait_while_equal and host_wake_all
+inline int const* wait_address(std::atomic<ThreadState> const& flag) {
+  static_assert(sizeof(std::atomic<ThreadState>) == sizeof(int));
+  return reinterpret_cast<int const*>(&flag);
+}
+
+// Set a thread state and wake the threads blocked until it changes
+inline void set_state_and_wake(std::atomic<ThreadState>& flag,
+                               ThreadState const value) {
+  flag = value;
+  host_wake_all(wait_address(flag));
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
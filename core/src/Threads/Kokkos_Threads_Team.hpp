@@ -90,7 +90,7 @@ class ThreadsExecTeamMember {
 
     // If not root then wait for release
     if (m_team_rank_rev) {
-      m_instance->state() = ThreadState::Rendezvous;
+      set_state_and_wake(m_instance->state(), ThreadState::Rendezvous);
       spinwait_while_equal(m_instance->state(), ThreadState::Rendezvous);
     }
 
@@ -102,7 +102,7 @@ class ThreadsExecTeamMember {
     for (n = 1;
          (!(m_team_rank_rev & n)) && ((j = m_team_rank_rev + n) < m_team_size);
          n <<= 1) {
-      m_team_base[j]->state() = ThreadState::Active;
+      set_state_and_wake(m_team_base[j]->state(), ThreadState::Active);
     }
   }
 
@@ -424,7 +424,7 @@ class ThreadsExecTeamMember {
 
       if ((m_team_rank_rev == 0) && (m_invalid_thread == 0)) {
         m_instance->set_work_range(m_league_rank, m_league_end, m_chunk_size);
-        m_instance->reset_steal_target(m_team_size);
+        m_instance->reset_steal_target();
       }
       if (std::is_same_v<
               typename TeamPolicyInternal<Kokkos::Threads,
@@ -18,6 +18,7 @@
 
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_HostAtomicCombining.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -218,6 +219,88 @@ class AtomicViewDataHandle {
   operator typename ViewTraits::value_type *() const { return ptr; }
 };
 
+/** \brief  Element of a view with the AtomicCombining memory trait.
+ *
+ *  Additive and exclusive-or updates issued from host threads are combined
+ *  in a per-thread buffer and reach memory at the end of the kernel (or when
+ *  evicted from the buffer).  Since the buffered update does not observe the
+ *  current value, these operators return the element itself instead of the
+ *  updated value.  An element should only be updated with one kind of
+ *  operation until the buffers are flushed.
+ *  All other operations, and all operations on device, are plain atomics.
+ */
+template <class ViewTraits>
+class AtomicCombiningDataElement : public AtomicDataElement<ViewTraits> {
+  using base_type = AtomicDataElement<ViewTraits>;
+
+ public:
+  using typename base_type::const_value_type;
+  using typename base_type::non_const_value_type;
+  using typename base_type::value_type;
+
+  KOKKOS_INLINE_FUNCTION
+  AtomicCombiningDataElement(value_type* ptr_, AtomicViewConstTag tag)
+      : base_type(ptr_, tag) {}
+
+  using base_type::operator=;
+
+  KOKKOS_INLINE_FUNCTION
+  void inc() const { *this += non_const_value_type(1); }
+
+  KOKKOS_INLINE_FUNCTION
+  void dec() const { *this -= non_const_value_type(1); }
+
+  KOKKOS_INLINE_FUNCTION
+  const AtomicCombiningDataElement& operator+=(const_value_type& val) const {
+    KOKKOS_IF_ON_HOST((combine<HostAtomicCombiningAdd>(val);))
+    KOKKOS_IF_ON_DEVICE((Kokkos::atomic_add(this->ptr, val);))
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const AtomicCombiningDataElement& operator-=(const_value_type& val) const {
+    KOKKOS_IF_ON_HOST((combine<HostAtomicCombiningAdd>(-val);))
+    KOKKOS_IF_ON_DEVICE((Kokkos::atomic_sub(this->ptr, val);))
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const AtomicCombiningDataElement& operator^=(const_value_type& val) const {
+    KOKKOS_IF_ON_HOST((combine<HostAtomicCombiningXor>(val);))
+    KOKKOS_IF_ON_DEVICE((Kokkos::atomic_xor(this->ptr, val);))
+    return *this;
+  }
+
+ private:
+  template <class Op>
+  void combine(const_value_type& val) const {
+    // HPX dispatches may return before the kernel completed, so the buffers
+    // could not be flushed at the end of the kernel.
+#ifndef KOKKOS_ENABLE_HPX
+    if constexpr (std::is_arithmetic_v<non_const_value_type>) {
+      HostAtomicCombiningBuffer<non_const_value_type, Op>::get().update(
+          this->ptr, val);
+    } else
+#endif
+    {
+      Op::apply(this->ptr, non_const_value_type(val));
+    }
+  }
+};
+
+template <class ViewTraits>
+class AtomicCombiningViewDataHandle : public AtomicViewDataHandle<ViewTraits> {
+ public:
+  using AtomicViewDataHandle<ViewTraits>::AtomicViewDataHandle;
+
+  template <class iType>
+  KOKKOS_INLINE_FUNCTION AtomicCombiningDataElement<ViewTraits> operator[](
+      const iType& i) const {
+    return AtomicCombiningDataElement<ViewTraits>(this->ptr + i,
+                                                  AtomicViewConstTag());
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -0,0 +1,571 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_VIEW_BLOCKED_LAYOUT_HPP
+#define KOKKOS_VIEW_BLOCKED_LAYOUT_HPP
+
+#include <Kokkos_Layout.hpp>
+#include <View/Kokkos_ViewMapping.hpp>
+
+#include <utility>
+
+//----------------------------------------------------------------------------
+// View mappings for Experimental::LayoutTiled and Experimental::LayoutAoSoA.
+//
+// Neither layout is strided, so View accesses go through
+// ViewOffset::operator().  Within one tile, or one vector block, both are
+// strided and stride_0() ... stride_7() report those strides.
+//
+// Subviews that keep every blocked index keep the layout: when each range
+// starts on a block boundary, the subview is the parent's block grid with
+// a moved origin and smaller extents.  Other subviews are LayoutStride Views
+// and must stay inside one block in every blocked index they keep.
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/// \brief Members common to the ViewOffset of the blocked layouts.
+///
+/// m_stride holds the run time part of the index math, see TiledIndex and
+/// AoSoAIndex.
+template <class Dimension, class Layout>
+struct ViewOffsetBlocked {
+  using is_mapping_plugin = std::true_type;
+  using is_regular        = std::false_type;
+
+  using size_type      = size_t;
+  using dimension_type = Dimension;
+  using array_layout   = Layout;
+
+  static_assert(0 < dimension_type::rank,
+                "Blocked View layouts require a rank of at least one");
+
+  dimension_type m_dim;
+  size_type m_stride[dimension_type::rank];
+  size_type m_span;
+
+  //----------------------------------------
+
+  KOKKOS_INLINE_FUNCTION
+  constexpr array_layout layout() const {
+    constexpr auto r = dimension_type::rank;
+    return array_layout((r > 0 ? m_dim.N0 : KOKKOS_INVALID_INDEX),
+                        (r > 1 ? m_dim.N1 : KOKKOS_INVALID_INDEX),
+                        (r > 2 ? m_dim.N2 : KOKKOS_INVALID_INDEX),
+                        (r > 3 ? m_dim.N3 : KOKKOS_INVALID_INDEX),
+                        (r > 4 ? m_dim.N4 : KOKKOS_INVALID_INDEX),
+                        (r > 5 ? m_dim.N5 : KOKKOS_INVALID_INDEX),
+                        (r > 6 ? m_dim.N6 : KOKKOS_INVALID_INDEX),
+                        (r > 7 ? m_dim.N7 : KOKKOS_INVALID_INDEX));
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const {
+    return m_dim.N0;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_1() const {
+    return m_dim.N1;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_2() const {
+    return m_dim.N2;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_3() const {
+    return m_dim.N3;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_4() const {
+    return m_dim.N4;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_5() const {
+    return m_dim.N5;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_6() const {
+    return m_dim.N6;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_7() const {
+    return m_dim.N7;
+  }
+
+  /* Cardinality of the domain index space */
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type size() const {
+    return size_type(m_dim.N0) * m_dim.N1 * m_dim.N2 * m_dim.N3 * m_dim.N4 *
+           m_dim.N5 * m_dim.N6 * m_dim.N7;
+  }
+
+  /* Span of the range space, including the padding of partial blocks */
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type span() const { return m_span; }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const {
+    return m_span == size();
+  }
+};
+
+//----------------------------------------------------------------------------
+
+template <class Dimension, size_t... TileDims>
+struct ViewOffset<Dimension, Kokkos::Experimental::LayoutTiled<TileDims...>,
+                  void>
+    : ViewOffsetBlocked<Dimension,
+                        Kokkos::Experimental::LayoutTiled<TileDims...>> {
+ private:
+  using base_type =
+      ViewOffsetBlocked<Dimension,
+                        Kokkos::Experimental::LayoutTiled<TileDims...>>;
+  using index_type = TiledIndex<TileDims...>;
+
+  static_assert(Dimension::rank == index_type::rank,
+                "LayoutTiled requires one tile extent per View rank");
+
+ public:
+  using typename base_type::size_type;
+
+  static constexpr bool only_index_0_is_blocked = false;
+
+  template <typename... I>
+  KOKKOS_FORCEINLINE_FUNCTION constexpr size_type operator()(
+      I const&... i) const {
+    static_assert(sizeof...(I) == index_type::rank);
+    return index_type::offset(std::make_index_sequence<sizeof...(I)>(),
+                              this->m_stride, i...);
+  }
+
+  /* Strides of dimensions within one tile */
+  template <unsigned R>
+  KOKKOS_INLINE_FUNCTION static constexpr size_type tile_stride() {
+    return R < index_type::rank ? size_type(1) << index_type::inner_shift(R)
+                                : 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_0() const {
+    return tile_stride<0>();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_1() const {
+    return tile_stride<1>();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const {
+    return tile_stride<2>();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_3() const {
+    return tile_stride<3>();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_4() const {
+    return tile_stride<4>();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_5() const {
+    return tile_stride<5>();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_6() const {
+    return tile_stride<6>();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_7() const {
+    return tile_stride<7>();
+  }
+
+  // Fill s with the strides within one tile, return the span
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION iType stride_fill(iType* const s) const {
+    for (unsigned r = 0; r < index_type::rank; ++r)
+      s[r] = size_type(1) << index_type::inner_shift(r);
+    return this->m_span;
+  }
+
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION void stride(iType* const s) const {
+    s[index_type::rank] = stride_fill(s);
+  }
+
+  // Whether [begin, begin + length) of index r lies in a single tile
+  KOKKOS_INLINE_FUNCTION
+  static constexpr bool in_one_block(unsigned r, size_t begin,
+                                     size_t length) {
+    const unsigned shift = index_type::tile_shift(r);
+    return length == 0 || (begin >> shift) == ((begin + length - 1) >> shift);
+  }
+
+  // Whether index r can start a subview at begin without leaving the tile
+  // grid
+  KOKKOS_INLINE_FUNCTION
+  static constexpr bool is_block_aligned(unsigned r, size_t begin) {
+    return (begin & (index_type::tile_extent(r) - 1)) == 0;
+  }
+
+  // Whether a static extent n of index r fits in one tile, 0 if dynamic
+  KOKKOS_INLINE_FUNCTION
+  static constexpr bool fits_in_one_block(unsigned r, size_t n) {
+    return n == 0 || n <= index_type::tile_extent(r);
+  }
+
+  //----------------------------------------
+
+  ViewOffset()                             = default;
+  ViewOffset(const ViewOffset&)            = default;
+  ViewOffset& operator=(const ViewOffset&) = default;
+
+  // Tiles are never padded further for alignment
+  template <unsigned TrivialScalarSize>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      std::integral_constant<unsigned, TrivialScalarSize> const&,
+      Kokkos::Experimental::LayoutTiled<TileDims...> const& arg_layout) {
+    this->m_dim = Dimension(
+        arg_layout.dimension[0], arg_layout.dimension[1],
+        arg_layout.dimension[2], arg_layout.dimension[3],
+        arg_layout.dimension[4], arg_layout.dimension[5],
+        arg_layout.dimension[6], arg_layout.dimension[7]);
+    this->m_span =
+        index_type::tile_strides(this->m_stride,
+                                 [&](unsigned r) {
+                                   return this->m_dim.extent(r);
+                                 }) *
+        index_type::tile_size;
+  }
+
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      const ViewOffset<DimRHS, Kokkos::Experimental::LayoutTiled<TileDims...>,
+                       void>& rhs) {
+    static_assert(int(DimRHS::rank) == int(Dimension::rank),
+                  "ViewOffset assignment requires equal rank");
+    this->m_dim = Dimension(rhs.m_dim.N0, rhs.m_dim.N1, rhs.m_dim.N2,
+                            rhs.m_dim.N3, rhs.m_dim.N4, rhs.m_dim.N5,
+                            rhs.m_dim.N6, rhs.m_dim.N7);
+    for (unsigned r = 0; r < Dimension::rank; ++r)
+      this->m_stride[r] = rhs.m_stride[r];
+    this->m_span = rhs.m_span;
+  }
+
+  // Subview starting on tile boundaries: the parent's tile grid, the
+  // origin is moved by the caller
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      const ViewOffset<DimRHS, Kokkos::Experimental::LayoutTiled<TileDims...>,
+                       void>& rhs,
+      const SubviewExtents<DimRHS::rank, Dimension::rank>& sub) {
+    static_assert(int(DimRHS::rank) == int(Dimension::rank),
+                  "A LayoutTiled subview must keep every index");
+    this->m_dim = Dimension(sub.range_extent(0), sub.range_extent(1),
+                            sub.range_extent(2), sub.range_extent(3),
+                            sub.range_extent(4), sub.range_extent(5),
+                            sub.range_extent(6), sub.range_extent(7));
+    // One past the last tile touched
+    size_type last_tile = 0;
+    for (unsigned r = 0; r < Dimension::rank; ++r) {
+      this->m_stride[r] = rhs.m_stride[r];
+      last_tile += ((this->m_dim.extent(r) - 1) >> index_type::tile_shift(r)) *
+                   this->m_stride[r];
+    }
+    this->m_span =
+        this->size() == 0 ? 0 : (last_tile + 1) * index_type::tile_size;
+  }
+};
+
+//----------------------------------------------------------------------------
+
+template <class Dimension, size_t VectorLength>
+struct ViewOffset<Dimension, Kokkos::Experimental::LayoutAoSoA<VectorLength>,
+                  void>
+    : ViewOffsetBlocked<Dimension,
+                        Kokkos::Experimental::LayoutAoSoA<VectorLength>> {
+ private:
+  using base_type =
+      ViewOffsetBlocked<Dimension,
+                        Kokkos::Experimental::LayoutAoSoA<VectorLength>>;
+  using index_type = AoSoAIndex<VectorLength>;
+
+ public:
+  using typename base_type::size_type;
+
+  static constexpr bool only_index_0_is_blocked = true;
+
+  template <typename... I>
+  KOKKOS_FORCEINLINE_FUNCTION constexpr size_type operator()(
+      I const&... i) const {
+    static_assert(sizeof...(I) == Dimension::rank);
+    return index_type::offset(std::make_index_sequence<sizeof...(I)>(),
+                              this->m_stride, i...);
+  }
+
+  /* Strides of dimensions within one vector block */
+  KOKKOS_INLINE_FUNCTION constexpr size_type block_stride(unsigned r) const {
+    return r == 0 ? 1
+                  : (r < Dimension::rank
+                         ? this->m_stride[r] << index_type::lane_shift
+                         : 0);
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_0() const {
+    return block_stride(0);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_1() const {
+    return block_stride(1);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const {
+    return block_stride(2);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_3() const {
+    return block_stride(3);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_4() const {
+    return block_stride(4);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_5() const {
+    return block_stride(5);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_6() const {
+    return block_stride(6);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_7() const {
+    return block_stride(7);
+  }
+
+  // Fill s with the strides within one vector block, return the span
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION iType stride_fill(iType* const s) const {
+    for (unsigned r = 0; r < Dimension::rank; ++r) s[r] = block_stride(r);
+    return this->m_span;
+  }
+
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION void stride(iType* const s) const {
+    s[Dimension::rank] = stride_fill(s);
+  }
+
+  // Whether [begin, begin + length) of index r lies in a single block
+  KOKKOS_INLINE_FUNCTION
+  static constexpr bool in_one_block(unsigned r, size_t begin,
+                                     size_t length) {
+    return r > 0 || length == 0 ||
+           (begin >> index_type::lane_shift) ==
+               ((begin + length - 1) >> index_type::lane_shift);
+  }
+
+  // Whether index r can start a subview at begin without leaving the block
+  // grid
+  KOKKOS_INLINE_FUNCTION
+  static constexpr bool is_block_aligned(unsigned r, size_t begin) {
+    return r > 0 || (begin & (VectorLength - 1)) == 0;
+  }
+
+  // Whether a static extent n of index r fits in one block, 0 if dynamic
+  KOKKOS_INLINE_FUNCTION
+  static constexpr bool fits_in_one_block(unsigned r, size_t n) {
+    return r > 0 || n == 0 || n <= VectorLength;
+  }
+
+  //----------------------------------------
+
+  ViewOffset()                             = default;
+  ViewOffset(const ViewOffset&)            = default;
+  ViewOffset& operator=(const ViewOffset&) = default;
+
+  template <unsigned TrivialScalarSize>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      std::integral_constant<unsigned, TrivialScalarSize> const&,
+      Kokkos::Experimental::LayoutAoSoA<VectorLength> const& arg_layout) {
+    this->m_dim = Dimension(
+        arg_layout.dimension[0], arg_layout.dimension[1],
+        arg_layout.dimension[2], arg_layout.dimension[3],
+        arg_layout.dimension[4], arg_layout.dimension[5],
+        arg_layout.dimension[6], arg_layout.dimension[7]);
+    index_type::strides(this->m_stride, Dimension::rank,
+                        [&](unsigned r) { return this->m_dim.extent(r); });
+    this->m_span = (index_type::num_blocks(this->m_dim.N0) * this->m_stride[0])
+                   << index_type::lane_shift;
+  }
+
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      const ViewOffset<DimRHS, Kokkos::Experimental::LayoutAoSoA<VectorLength>,
+                       void>& rhs) {
+    static_assert(int(DimRHS::rank) == int(Dimension::rank),
+                  "ViewOffset assignment requires equal rank");
+    this->m_dim = Dimension(rhs.m_dim.N0, rhs.m_dim.N1, rhs.m_dim.N2,
+                            rhs.m_dim.N3, rhs.m_dim.N4, rhs.m_dim.N5,
+                            rhs.m_dim.N6, rhs.m_dim.N7);
+    for (unsigned r = 0; r < Dimension::rank; ++r)
+      this->m_stride[r] = rhs.m_stride[r];
+    this->m_span = rhs.m_span;
+  }
+
+  // Subview keeping index 0, starting on a block boundary: the parent's
+  // strides of the kept indices, the origin is moved by the caller
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      const ViewOffset<DimRHS, Kokkos::Experimental::LayoutAoSoA<VectorLength>,
+                       void>& rhs,
+      const SubviewExtents<DimRHS::rank, Dimension::rank>& sub) {
+    this->m_dim = Dimension(sub.range_extent(0), sub.range_extent(1),
+                            sub.range_extent(2), sub.range_extent(3),
+                            sub.range_extent(4), sub.range_extent(5),
+                            sub.range_extent(6), sub.range_extent(7));
+    // Offset of the last element, in units of VectorLength
+    size_type last =
+        (index_type::num_blocks(this->m_dim.N0) - 1) * rhs.m_stride[0];
+    this->m_stride[0] = rhs.m_stride[0];
+    for (unsigned r = 1; r < Dimension::rank; ++r) {
+      this->m_stride[r] = rhs.m_stride[sub.range_index(r)];
+      last += (this->m_dim.extent(r) - 1) * this->m_stride[r];
+    }
+    this->m_span =
+        this->size() == 0 ? 0 : (last + 1) << index_type::lane_shift;
+  }
+};
+
+//----------------------------------------------------------------------------
+/** \brief  Subview of a View with a blocked layout.
+ *
+ *  A subview keeping every index of a LayoutTiled View, or index 0 of a
+ *  LayoutAoSoA View, has the same layout and its ranges must start on a
+ *  tile or vector block boundary.  Any other subview is a LayoutStride View
+ *  and has to stay inside a single tile, or a single vector block of index
+ *  0 for LayoutAoSoA.  Ranges are checked when the subview is created, ALL
+ *  over a static extent already at compile time.
+ */
+template <class SrcTraits, class... Args>
+class ViewMapping<
+    std::enable_if_t<(
+        std::is_void_v<typename SrcTraits::specialize> &&
+        is_blocked_layout<typename SrcTraits::array_layout>::value)>,
+    SrcTraits, Args...> {
+ private:
+  static_assert(SrcTraits::rank == sizeof...(Args),
+                "Subview mapping requires one argument for each dimension of "
+                "source View");
+
+  enum {
+    rank = unsigned(is_integral_extent<0, Args...>::value) +
+           unsigned(is_integral_extent<1, Args...>::value) +
+           unsigned(is_integral_extent<2, Args...>::value) +
+           unsigned(is_integral_extent<3, Args...>::value) +
+           unsigned(is_integral_extent<4, Args...>::value) +
+           unsigned(is_integral_extent<5, Args...>::value) +
+           unsigned(is_integral_extent<6, Args...>::value) +
+           unsigned(is_integral_extent<7, Args...>::value)
+  };
+
+  using src_offset_type = ViewOffset<typename SrcTraits::dimension,
+                                     typename SrcTraits::array_layout, void>;
+
+  static constexpr bool keeps_layout =
+      is_integral_extent<0, Args...>::value &&
+      (unsigned(rank) == SrcTraits::rank ||
+       src_offset_type::only_index_0_is_blocked);
+
+  template <size_t... R>
+  static constexpr bool all_fits_in_one_block(std::index_sequence<R...>) {
+    return (... && (!std::is_same_v<std::decay_t<Args>, Kokkos::ALL_t> ||
+                    src_offset_type::fits_in_one_block(
+                        R, SrcTraits::dimension::static_extent(R))));
+  }
+
+  static_assert(keeps_layout || all_fits_in_one_block(
+                                    std::index_sequence_for<Args...>()),
+                "Kokkos::subview ERROR: Kokkos::ALL over a static extent "
+                "crosses a tile or vector block boundary of a View with "
+                "LayoutTiled or LayoutAoSoA");
+
+  using array_layout =
+      std::conditional_t<keeps_layout, typename SrcTraits::array_layout,
+                         Kokkos::LayoutStride>;
+
+  using value_type = typename SrcTraits::value_type;
+
+  using data_type =
+      typename SubViewDataType<value_type,
+                               typename Kokkos::Impl::ParseViewExtents<
+                                   typename SrcTraits::data_type>::type,
+                               Args...>::type;
+
+  template <size_t... R>
+  KOKKOS_INLINE_FUNCTION static size_t origin(
+      const src_offset_type& offset,
+      const SubviewExtents<SrcTraits::rank, rank>& sub,
+      std::index_sequence<R...>) {
+    return offset(sub.domain_offset(R)...);
+  }
+
+ public:
+  using traits_type = Kokkos::ViewTraits<data_type, array_layout,
+                                         typename SrcTraits::device_type,
+                                         typename SrcTraits::memory_traits>;
+
+  using type =
+      Kokkos::View<data_type, array_layout, typename SrcTraits::device_type,
+                   typename SrcTraits::memory_traits>;
+
+  template <class MemoryTraits>
+  struct apply {
+    static_assert(Kokkos::is_memory_traits<MemoryTraits>::value);
+
+    using traits_type =
+        Kokkos::ViewTraits<data_type, array_layout,
+                           typename SrcTraits::device_type, MemoryTraits>;
+
+    using type = Kokkos::View<data_type, array_layout,
+                              typename SrcTraits::device_type, MemoryTraits>;
+  };
+
+  template <class DstTraits>
+  KOKKOS_INLINE_FUNCTION static void assign(
+      ViewMapping<DstTraits, void>& dst,
+      ViewMapping<SrcTraits, void> const& src, Args... args) {
+    static_assert(ViewMapping<DstTraits, traits_type, void>::is_assignable,
+                  "Subview destination type must be compatible with subview "
+                  "derived type");
+
+    using DstType = ViewMapping<DstTraits, void>;
+
+    using dst_offset_type = typename DstType::offset_type;
+
+    const SubviewExtents<SrcTraits::rank, rank> extents(src.m_impl_offset.m_dim,
+                                                        args...);
+
+    for (unsigned r = 0; r < unsigned(rank); ++r) {
+      const unsigned d = extents.range_index(r);
+      if constexpr (keeps_layout) {
+        if (!src.m_impl_offset.is_block_aligned(d, extents.domain_offset(d)))
+          Kokkos::abort(
+              "Kokkos::subview ERROR: a subview of a View with LayoutTiled or "
+              "LayoutAoSoA keeping the layout must start on a tile or vector "
+              "block boundary");
+      } else {
+        if (!src.m_impl_offset.in_one_block(d, extents.domain_offset(d),
+                                            extents.range_extent(r)))
+          Kokkos::abort(
+              "Kokkos::subview ERROR: a LayoutStride subview of a View with "
+              "LayoutTiled or LayoutAoSoA must not cross a tile or vector "
+              "block boundary");
+      }
+    }
+
+    dst.m_impl_offset = dst_offset_type(src.m_impl_offset, extents);
+
+    dst.m_impl_handle = ViewDataHandle<DstTraits>::assign(
+        src.m_impl_handle,
+        origin(src.m_impl_offset, extents,
+               std::make_index_sequence<SrcTraits::rank>()));
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_VIEW_BLOCKED_LAYOUT_HPP
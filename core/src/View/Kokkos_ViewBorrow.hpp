@@ -0,0 +1,91 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_VIEW_BORROW_HPP
+#define KOKKOS_VIEW_BORROW_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Abort.hpp>
+
+#include <sstream>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Scope that lends reference-count free copies of a managed View.
+ *
+ *  Copying a managed View atomically updates the reference count of its
+ *  allocation.  When many host threads copy the same View, e.g. into tasks
+ *  or lambdas, the count's cache line bounces between cores.  The handle
+ *  returned by view() refers to the same allocation but neither it nor any
+ *  of its copies or subviews touch the count; the scope itself holds one
+ *  reference for its whole lifetime instead.
+ *
+ *  Borrowed handles must not outlive the scope.  In debug builds they are
+ *  counted separately and the destructor aborts if any of them is still
+ *  alive.
+ *
+ *  \code
+ *  Kokkos::Experimental::ScopedViewBorrow borrow(a);
+ *  auto a_ = borrow.view();
+ *  run_tasks([a_](int i) { a_(i) = 0; });
+ *  \endcode
+ */
+template <class ViewType>
+class ScopedViewBorrow {
+  static_assert(Kokkos::is_view_v<ViewType>,
+                "ScopedViewBorrow can only borrow Kokkos::View");
+
+  ViewType m_owner;
+  ViewType m_borrowed;
+
+ public:
+  explicit ScopedViewBorrow(ViewType const& view)
+      : m_owner(view), m_borrowed(view.impl_borrow()) {}
+
+  ~ScopedViewBorrow() {
+#ifdef KOKKOS_ENABLE_DEBUG
+    m_borrowed = ViewType();
+    auto const* record = m_owner.impl_track()
+                             .template get_record<
+                                 typename ViewType::traits::memory_space>();
+    if (record != nullptr && record->borrow_count() != 0) {
+      std::stringstream ss;
+      ss << "Kokkos::Experimental::ScopedViewBorrow: " << record->borrow_count()
+         << " borrowed handle(s) to View \"" << m_owner.label()
+         << "\" outlive the borrow scope\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+#endif
+  }
+
+  ScopedViewBorrow(ScopedViewBorrow const&)            = delete;
+  ScopedViewBorrow(ScopedViewBorrow&&)                 = delete;
+  ScopedViewBorrow& operator=(ScopedViewBorrow const&) = delete;
+  ScopedViewBorrow& operator=(ScopedViewBorrow&&)      = delete;
+
+  ViewType const& view() const noexcept { return m_borrowed; }
+};
+
+template <class DataType, class... Properties>
+ScopedViewBorrow(View<DataType, Properties...> const&)
+    -> ScopedViewBorrow<View<DataType, Properties...>>;
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
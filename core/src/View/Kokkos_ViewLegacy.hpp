@@ -200,6 +200,7 @@ constexpr bool is_assignable(const Kokkos::View<ViewTDst...>& dst,
 //----------------------------------------------------------------------------
 
 #include <View/Kokkos_ViewMapping.hpp>
+#include <View/Kokkos_ViewBlockedLayout.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -440,6 +441,15 @@ class View : public ViewTraits<DataType, Properties...> {
   const Kokkos::Impl::SharedAllocationTracker& impl_track() const {
     return m_track.m_tracker;
   }
+
+  // Handle to the same allocation whose copies are never reference counted,
+  // see Kokkos::Experimental::ScopedViewBorrow.
+  View impl_borrow() const {
+    View borrowed;
+    borrowed.m_map = m_map;
+    borrowed.m_track.m_tracker.assign_borrowed(m_track.m_tracker);
+    return borrowed;
+  }
   //----------------------------------------
 
  private:
@@ -2381,8 +2381,14 @@ struct ViewDataHandle<
                       std::is_void_v<typename Traits::specialize> &&
                       Traits::memory_traits::is_atomic)>> {
   using value_type  = typename Traits::value_type;
-  using handle_type = typename Kokkos::Impl::AtomicViewDataHandle<Traits>;
-  using return_type = typename Kokkos::Impl::AtomicDataElement<Traits>;
+  using handle_type = std::conditional_t<
+      Traits::memory_traits::is_atomic_combining,
+      Kokkos::Impl::AtomicCombiningViewDataHandle<Traits>,
+      Kokkos::Impl::AtomicViewDataHandle<Traits>>;
+  using return_type =
+      std::conditional_t<Traits::memory_traits::is_atomic_combining,
+                         Kokkos::Impl::AtomicCombiningDataElement<Traits>,
+                         Kokkos::Impl::AtomicDataElement<Traits>>;
   using track_type  = Kokkos::Impl::SharedAllocationTracker;
 
   KOKKOS_INLINE_FUNCTION
@@ -0,0 +1,281 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+
+#ifndef KOKKOS_EXPERIMENTAL_MDSPAN_BLOCKED_LAYOUT_HPP
+#define KOKKOS_EXPERIMENTAL_MDSPAN_BLOCKED_LAYOUT_HPP
+
+#include "Kokkos_MDSpan_Header.hpp"
+#include <Kokkos_Layout.hpp>
+
+#include <utility>
+
+// mdspan layout policies with the same mapping as the View layouts
+// Experimental::LayoutTiled and Experimental::LayoutAoSoA.
+
+namespace Kokkos::Experimental {
+
+/// \brief Layout policy of Kokkos::Experimental::LayoutTiled
+template <size_t... TileDims>
+struct layout_tiled {
+  template <class Extents>
+  class mapping {
+   public:
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_tiled;
+
+   private:
+    using tiled_index = Kokkos::Impl::TiledIndex<TileDims...>;
+
+    static_assert(extents_type::rank() == tiled_index::rank,
+                  "layout_tiled requires one tile extent per rank");
+
+    extents_type m_extents;
+    size_t m_tile_stride[tiled_index::rank] = {};
+    size_t m_span                           = 0;
+
+   public:
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping() noexcept = default;
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping(const mapping&) noexcept =
+        default;
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping& operator=(
+        const mapping&) noexcept = default;
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr mapping(const extents_type& ext) noexcept : m_extents(ext) {
+      m_span = tiled_index::tile_strides(
+                   m_tile_stride,
+                   [&](unsigned r) { return size_t(m_extents.extent(r)); }) *
+               tiled_index::tile_size;
+    }
+
+    // The tile grid of a larger View, as used by a subview of that View
+    KOKKOS_INLINE_FUNCTION
+    constexpr mapping(mdspan_non_standard_tag, const extents_type& ext,
+                      const size_t* tile_stride, size_t span) noexcept
+        : m_extents(ext), m_span(span) {
+      for (unsigned r = 0; r < tiled_index::rank; ++r)
+        m_tile_stride[r] = tile_stride[r];
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr const extents_type& extents() const noexcept {
+      return m_extents;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr index_type required_span_size() const noexcept {
+      return index_type(m_span);
+    }
+
+    template <class... Indices>
+    KOKKOS_FORCEINLINE_FUNCTION constexpr index_type operator()(
+        Indices... idx) const noexcept {
+      static_assert(sizeof...(Indices) == tiled_index::rank);
+      return index_type(tiled_index::offset(
+          std::make_index_sequence<sizeof...(Indices)>(), m_tile_stride,
+          idx...));
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_always_unique() noexcept { return true; }
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_always_exhaustive() noexcept { return false; }
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_always_strided() noexcept {
+      return extents_type::rank() <= 1;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_unique() noexcept { return true; }
+    KOKKOS_INLINE_FUNCTION
+    constexpr bool is_exhaustive() const noexcept {
+      size_t size = 1;
+      for (rank_type r = 0; r < extents_type::rank(); ++r)
+        size *= m_extents.extent(r);
+      return size == m_span;
+    }
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_strided() noexcept {
+      return extents_type::rank() <= 1;
+    }
+
+    // Only meaningful for rank one, where the mapping is the identity
+    KOKKOS_INLINE_FUNCTION
+    constexpr index_type stride(rank_type) const noexcept { return 1; }
+
+    // Strides of the tile grid, in tiles
+    KOKKOS_INLINE_FUNCTION
+    constexpr const size_t* impl_strides() const noexcept {
+      return m_tile_stride;
+    }
+
+    template <class OtherExtents>
+    KOKKOS_INLINE_FUNCTION friend constexpr bool operator==(
+        const mapping& lhs, const mapping<OtherExtents>& rhs) noexcept {
+      if (lhs.extents() != rhs.extents()) return false;
+      for (unsigned r = 0; r < tiled_index::rank; ++r)
+        if (lhs.impl_strides()[r] != rhs.impl_strides()[r]) return false;
+      return true;
+    }
+
+    template <class OtherExtents>
+    KOKKOS_INLINE_FUNCTION friend constexpr bool operator!=(
+        const mapping& lhs, const mapping<OtherExtents>& rhs) noexcept {
+      return !(lhs == rhs);
+    }
+  };
+};
+
+/// \brief Layout policy of Kokkos::Experimental::LayoutAoSoA
+template <size_t VectorLength>
+struct layout_aosoa {
+  template <class Extents>
+  class mapping {
+   public:
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_aosoa;
+
+   private:
+    using aosoa_index = Kokkos::Impl::AoSoAIndex<VectorLength>;
+
+    static_assert(extents_type::rank() > 0,
+                  "layout_aosoa requires a rank of at least one");
+
+    extents_type m_extents;
+    size_t m_stride[extents_type::rank()] = {};
+    size_t m_span                         = 0;
+
+   public:
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping() noexcept = default;
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping(const mapping&) noexcept =
+        default;
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping& operator=(
+        const mapping&) noexcept = default;
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr mapping(const extents_type& ext) noexcept : m_extents(ext) {
+      aosoa_index::strides(m_stride, extents_type::rank(), [&](unsigned r) {
+        return size_t(m_extents.extent(r));
+      });
+      m_span = (aosoa_index::num_blocks(m_extents.extent(0)) * m_stride[0])
+               << aosoa_index::lane_shift;
+    }
+
+    // The strides of a larger View, as used by a subview of that View
+    KOKKOS_INLINE_FUNCTION
+    constexpr mapping(mdspan_non_standard_tag, const extents_type& ext,
+                      const size_t* stride, size_t span) noexcept
+        : m_extents(ext), m_span(span) {
+      for (rank_type r = 0; r < extents_type::rank(); ++r)
+        m_stride[r] = stride[r];
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr const extents_type& extents() const noexcept {
+      return m_extents;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr index_type required_span_size() const noexcept {
+      return index_type(m_span);
+    }
+
+    template <class... Indices>
+    KOKKOS_FORCEINLINE_FUNCTION constexpr index_type operator()(
+        Indices... idx) const noexcept {
+      static_assert(sizeof...(Indices) == extents_type::rank());
+      return index_type(aosoa_index::offset(
+          std::make_index_sequence<sizeof...(Indices)>(), m_stride, idx...));
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_always_unique() noexcept { return true; }
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_always_exhaustive() noexcept { return false; }
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_always_strided() noexcept {
+      return extents_type::rank() <= 1;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_unique() noexcept { return true; }
+    KOKKOS_INLINE_FUNCTION
+    constexpr bool is_exhaustive() const noexcept {
+      size_t size = 1;
+      for (rank_type r = 0; r < extents_type::rank(); ++r)
+        size *= m_extents.extent(r);
+      return size == m_span;
+    }
+    KOKKOS_INLINE_FUNCTION
+    static constexpr bool is_strided() noexcept {
+      return extents_type::rank() <= 1;
+    }
+
+    // Only meaningful for rank one, where the mapping is the identity
+    KOKKOS_INLINE_FUNCTION
+    constexpr index_type stride(rank_type) const noexcept { return 1; }
+
+    // Strides of the indices in a block divided by VectorLength, and the
+    // block stride for index 0
+    KOKKOS_INLINE_FUNCTION
+    constexpr const size_t* impl_strides() const noexcept { return m_stride; }
+
+    template <class OtherExtents>
+    KOKKOS_INLINE_FUNCTION friend constexpr bool operator==(
+        const mapping& lhs, const mapping<OtherExtents>& rhs) noexcept {
+      if (lhs.extents() != rhs.extents()) return false;
+      for (rank_type r = 0; r < extents_type::rank(); ++r)
+        if (lhs.impl_strides()[r] != rhs.impl_strides()[r]) return false;
+      return true;
+    }
+
+    template <class OtherExtents>
+    KOKKOS_INLINE_FUNCTION friend constexpr bool operator!=(
+        const mapping& lhs, const mapping<OtherExtents>& rhs) noexcept {
+      return !(lhs == rhs);
+    }
+  };
+};
+
+}  // namespace Kokkos::Experimental
+
+namespace Kokkos::Impl {
+
+template <class Layout>
+struct is_blocked_layout_policy : std::false_type {};
+
+template <size_t... TileDims>
+struct is_blocked_layout_policy<Experimental::layout_tiled<TileDims...>>
+    : std::true_type {};
+
+template <size_t VectorLength>
+struct is_blocked_layout_policy<Experimental::layout_aosoa<VectorLength>>
+    : std::true_type {};
+
+}  // namespace Kokkos::Impl
+
+#endif  // KOKKOS_EXPERIMENTAL_MDSPAN_BLOCKED_LAYOUT_HPP
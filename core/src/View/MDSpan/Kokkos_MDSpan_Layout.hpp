@@ -23,6 +23,7 @@ static_assert(false,
 #define KOKKOS_EXPERIMENTAL_MDSPAN_LAYOUT_HPP
 
 #include "Kokkos_MDSpan_Extents.hpp"
+#include "Kokkos_MDSpan_BlockedLayout.hpp"
 #include <View/Kokkos_ViewDataAnalysis.hpp>
 
 // The difference between a legacy Kokkos array layout and an
@@ -49,6 +50,16 @@ struct LayoutFromArrayLayout<Kokkos::LayoutStride> {
   using type = layout_stride;
 };
 
+template <size_t... TileDims>
+struct LayoutFromArrayLayout<Kokkos::Experimental::LayoutTiled<TileDims...>> {
+  using type = Kokkos::Experimental::layout_tiled<TileDims...>;
+};
+
+template <size_t VectorLength>
+struct LayoutFromArrayLayout<Kokkos::Experimental::LayoutAoSoA<VectorLength>> {
+  using type = Kokkos::Experimental::layout_aosoa<VectorLength>;
+};
+
 template <class ArrayLayout, class MDSpanType>
 KOKKOS_INLINE_FUNCTION auto array_layout_from_mapping(
     const typename MDSpanType::mapping_type &mapping) {
@@ -90,6 +101,13 @@ KOKKOS_INLINE_FUNCTION auto array_layout_from_mapping(
                        rank > 6 ? ext.extent(6) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
                        rank > 7 ? ext.extent(7) : KOKKOS_IMPL_CTOR_DEFAULT_ARG};
 
+    if constexpr (is_blocked_layout_policy<
+                      typename mapping_type::layout_type>::value) {
+      if (mapping != mapping_type(ext))
+        Kokkos::abort(
+            "Invalid conversion from a layout_tiled or layout_aosoa mapping "
+            "of a subview to a View layout");
+    }
     if constexpr (rank > 1 &&
                   std::is_same_v<typename mapping_type::layout_type,
                                  Kokkos::Experimental::layout_left_padded<
@@ -123,7 +141,9 @@ KOKKOS_INLINE_FUNCTION auto mapping_from_array_layout_impl(
   if constexpr (std::is_same_v<typename MappingType::layout_type,
                                layout_left> ||
                 std::is_same_v<typename MappingType::layout_type,
-                               layout_right>) {
+                               layout_right> ||
+                is_blocked_layout_policy<
+                    typename MappingType::layout_type>::value) {
     return MappingType{
         extents_type{dextents<index_type, MappingType::extents_type::rank()>{
             layout.dimension[Idx]...}}};
@@ -208,6 +228,13 @@ KOKKOS_INLINE_FUNCTION auto mapping_from_view_mapping(const VM &view_mapping) {
                                           Kokkos::dynamic_extent>>) {
     return mapping_type(extents_from_view_mapping<extents_type>(view_mapping),
                         strides[VM::Rank - 2]);
+  } else if constexpr (is_blocked_layout_policy<
+                           typename mapping_type::layout_type>::value) {
+    // A subview keeps the block strides of the View it was taken from
+    return mapping_type(Kokkos::mdspan_non_standard,
+                        extents_from_view_mapping<extents_type>(view_mapping),
+                        view_mapping.m_impl_offset.m_stride,
+                        view_mapping.m_impl_offset.m_span);
   } else {
     return mapping_type(extents_from_view_mapping<extents_type>(view_mapping));
   }
@@ -18,10 +18,19 @@
 #define KOKKOS_IMPL_PUBLIC_INCLUDE
 #endif
 
+#include <Kokkos_Macros.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
 
 #include <cstdlib>  // getenv
+#include <fstream>
 #include <string>
+#include <utility>
+
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#elif defined(__unix__)
+#include <unistd.h>  // sysconf
+#endif
 
 int Kokkos::Impl::mpi_ranks_per_node() {
   for (char const* env_var : {
@@ -56,3 +65,151 @@ int Kokkos::Impl::mpi_local_rank_on_node() {
 }
 
 bool Kokkos::Impl::mpi_detected() { return mpi_local_rank_on_node() != -1; }
+
+namespace {
+
+// Parses sizes reported by sysfs such as "48K" or "2M".
+int parse_cache_size(std::string const& str) {
+  std::size_t pos = 0;
+  int size        = std::stoi(str, &pos);
+  if (pos < str.size()) {
+    if (str[pos] == 'K') size *= 1024;
+    if (str[pos] == 'M') size *= 1024 * 1024;
+  }
+  return size;
+}
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define KOKKOS_IMPL_HOST_ISA_PROBE
+#endif
+
+// The builtin reads CPUID, and for AVX and later also checks with XGETBV that
+// the operating system saves the wide registers.
+int detect_host_cpu_supports(Kokkos::Impl::HostISA isa) {
+#ifdef KOKKOS_IMPL_HOST_ISA_PROBE
+  using Kokkos::Impl::HostISA;
+  __builtin_cpu_init();
+  switch (isa) {
+    case HostISA::sse42: return __builtin_cpu_supports("sse4.2") ? 1 : 0;
+    case HostISA::avx: return __builtin_cpu_supports("avx") ? 1 : 0;
+    case HostISA::fma: return __builtin_cpu_supports("fma") ? 1 : 0;
+    case HostISA::avx2: return __builtin_cpu_supports("avx2") ? 1 : 0;
+    case HostISA::avx512f: return __builtin_cpu_supports("avx512f") ? 1 : 0;
+    case HostISA::avx512bw: return __builtin_cpu_supports("avx512bw") ? 1 : 0;
+  }
+#else
+  (void)isa;
+#endif
+  return -1;
+}
+
+constexpr std::pair<Kokkos::Impl::HostISA, char const*> host_isa_table[] = {
+    {Kokkos::Impl::HostISA::sse42, "sse4.2"},
+    {Kokkos::Impl::HostISA::avx, "avx"},
+    {Kokkos::Impl::HostISA::fma, "fma"},
+    {Kokkos::Impl::HostISA::avx2, "avx2"},
+    {Kokkos::Impl::HostISA::avx512f, "avx512f"},
+    {Kokkos::Impl::HostISA::avx512bw, "avx512bw"},
+};
+
+// Whether the library is compiled for the extension, by the compiler flags of
+// the Kokkos_ARCH_* option or by user flags such as -march=native.
+constexpr bool host_isa_compiled(Kokkos::Impl::HostISA isa) {
+  using Kokkos::Impl::HostISA;
+  bool compiled = false;
+#if defined(__SSE4_2__)
+  compiled |= isa == HostISA::sse42;
+#endif
+#if defined(KOKKOS_ARCH_AVX512XEON) || defined(KOKKOS_ARCH_AVX512MIC) || \
+    defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_ARCH_AVX) || defined(__AVX__)
+  compiled |= isa == HostISA::avx;
+#endif
+#if defined(KOKKOS_ARCH_AVX512XEON) || defined(KOKKOS_ARCH_AVX512MIC) || \
+    defined(KOKKOS_ARCH_AVX2) || defined(__FMA__)
+  compiled |= isa == HostISA::fma;
+#endif
+#if defined(KOKKOS_ARCH_AVX512XEON) || defined(KOKKOS_ARCH_AVX512MIC) || \
+    defined(KOKKOS_ARCH_AVX2) || defined(__AVX2__)
+  compiled |= isa == HostISA::avx2;
+#endif
+#if defined(KOKKOS_ARCH_AVX512XEON) || defined(KOKKOS_ARCH_AVX512MIC) || \
+    defined(__AVX512F__)
+  compiled |= isa == HostISA::avx512f;
+#endif
+#if defined(KOKKOS_ARCH_AVX512XEON) || defined(__AVX512BW__)
+  compiled |= isa == HostISA::avx512bw;
+#endif
+  (void)isa;
+  return compiled;
+}
+
+int detect_host_data_cache_size(int level) {
+#if defined(__linux__)
+  for (int index = 0; index < 16; ++index) {
+    std::string const dir =
+        "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index);
+    std::ifstream level_file(dir + "/level");
+    if (!level_file) break;
+    int cache_level = 0;
+    std::string type, size;
+    level_file >> cache_level;
+    std::ifstream(dir + "/type") >> type;
+    std::ifstream(dir + "/size") >> size;
+    if (cache_level == level && type != "Instruction" && !size.empty()) {
+      return parse_cache_size(size);
+    }
+  }
+#endif
+#if defined(__APPLE__)
+  long long size     = 0;
+  std::size_t length = sizeof(size);
+  char const* name   = level == 1 ? "hw.l1dcachesize" : "hw.l2cachesize";
+  if (sysctlbyname(name, &size, &length, nullptr, 0) == 0 && size > 0) {
+    return static_cast<int>(size);
+  }
+#elif defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+  long const size =
+      sysconf(level == 1 ? _SC_LEVEL1_DCACHE_SIZE : _SC_LEVEL2_CACHE_SIZE);
+  if (size > 0) {
+    return static_cast<int>(size);
+  }
+#endif
+  return 0;
+}
+
+}  // namespace
+
+int Kokkos::Impl::host_data_cache_size(int level) {
+  if (level < 1 || level > 2) {
+    return 0;
+  }
+  // Detected once, the first time a host MDRangePolicy picks its tiles.
+  static int const sizes[2] = {detect_host_data_cache_size(1),
+                               detect_host_data_cache_size(2)};
+  return sizes[level - 1];
+}
+
+int Kokkos::Impl::host_cpu_supports(HostISA isa) {
+  return detect_host_cpu_supports(isa);
+}
+
+std::string Kokkos::Impl::host_isa_names() {
+  std::string names;
+  for (auto const& [isa, name] : host_isa_table) {
+    int const supported = host_cpu_supports(isa);
+    if (supported == -1) return "unknown";
+    if (supported == 1) {
+      if (!names.empty()) names += ' ';
+      names += name;
+    }
+  }
+  return names.empty() ? "none" : names;
+}
+
+char const* Kokkos::Impl::host_isa_missing() {
+  for (auto const& [isa, name] : host_isa_table) {
+    if (host_isa_compiled(isa) && host_cpu_supports(isa) == 0) return name;
+  }
+  return nullptr;
+}
@@ -13,6 +13,12 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //@HEADER
+
+#ifndef KOKKOS_IMPL_CPUDISCOVERY_HPP
+#define KOKKOS_IMPL_CPUDISCOVERY_HPP
+
+#include <string>
+
 namespace Kokkos {
 namespace Impl {
 
@@ -21,5 +27,28 @@ int mpi_local_rank_on_node();
 // returns true if MPI execution environment is detected, false otherwise.
 bool mpi_detected();
 
+// returns the size in bytes of the level 1 or level 2 data cache of a single
+// core of the host, or 0 if it could not be determined.
+int host_data_cache_size(int level);
+
+// Vector instruction set extensions of x86 host CPUs
+enum class HostISA { sse42, avx, fma, avx2, avx512f, avx512bw };
+
+// returns 1 if the host CPU and operating system support the instruction set
+// extension, 0 if they do not, or -1 if it could not be determined.
+int host_cpu_supports(HostISA isa);
+
+// returns the space separated names of the instruction set extensions
+// supported by the host CPU, or "unknown" if they could not be determined.
+std::string host_isa_names();
+
+// returns the name of an instruction set extension that Kokkos is compiled
+// for, by the Kokkos_ARCH_* option or by the compiler flags, but the host CPU
+// does not support, or nullptr if there is none or it could not be
+// determined.
+char const* host_isa_missing();
+
 }  // namespace Impl
 }  // namespace Kokkos
+
+#endif
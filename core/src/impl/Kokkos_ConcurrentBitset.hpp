@@ -188,7 +188,9 @@ struct concurrent_bitset {
       return type(-3, -3);
     }
 
-    const uint32_t word_count = bit_bound >> bits_per_int_lg2;
+    // The last word is partial if bit_bound is not a multiple of 32
+    const uint32_t word_count =
+        (bit_bound + bits_per_int_mask) >> bits_per_int_lg2;
 
     // Use potentially two fetch_add to avoid CAS loop.
     // Could generate "racing" failure-to-acquire
@@ -242,6 +244,8 @@ struct concurrent_bitset {
       if ((j < 0) || (bit_bound <= bit)) {
         bit = ((word + 1) < word_count ? ((word + 1) << bits_per_int_lg2) : 0) |
               (bit & bits_per_int_mask);
+        // Start a partial last word at its first bit
+        if (bit_bound <= bit) bit &= ~bits_per_int_mask;
       }
     }
   }
@@ -25,6 +25,7 @@
 #include <impl/Kokkos_DeviceManagement.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_HostWait.hpp>
 
 #include <algorithm>
 #include <cctype>
@@ -93,9 +94,11 @@ void combine(Kokkos::InitializationSettings& out,
   KOKKOS_IMPL_COMBINE_SETTING(disable_warnings);
   KOKKOS_IMPL_COMBINE_SETTING(print_configuration);
   KOKKOS_IMPL_COMBINE_SETTING(tune_internals);
+  KOKKOS_IMPL_COMBINE_SETTING(host_wait_spin);
   KOKKOS_IMPL_COMBINE_SETTING(tools_help);
   KOKKOS_IMPL_COMBINE_SETTING(tools_libs);
   KOKKOS_IMPL_COMBINE_SETTING(tools_args);
+  KOKKOS_IMPL_COMBINE_SETTING(tools_timer);
 #undef KOKKOS_IMPL_COMBINE_SETTING
 }
 
@@ -111,6 +114,9 @@ void combine(Kokkos::InitializationSettings& out,
   if (in.args != InitArguments::unset_string_option) {
     out.set_tools_args(in.args);
   }
+  if (in.timer != InitArguments::unset_string_option) {
+    out.set_tools_timer(in.timer);
+  }
 }
 
 void combine(Kokkos::Tools::InitArguments& out,
@@ -126,6 +132,9 @@ void combine(Kokkos::Tools::InitArguments& out,
   if (in.has_tools_args()) {
     out.args = in.get_tools_args();
   }
+  if (in.has_tools_timer()) {
+    out.timer = in.get_tools_timer();
+  }
 }
 
 int get_device_count() {
@@ -162,6 +171,8 @@ bool is_valid_num_threads(int x) { return x > 0; }
 
 bool is_valid_device_id(int x) { return x >= 0; }
 
+bool is_valid_host_wait_spin(int x) { return x >= 0; }
+
 bool is_valid_map_device_id_by(std::string const& x) {
   return x == "mpi_rank" || x == "random";
 }
@@ -473,6 +484,9 @@ void initialize_profiling(const Kokkos::Tools::InitArguments& args) {
     }
   } else {
     std::cerr << "Error initializing Kokkos Tools subsystem" << std::endl;
+    if (!initialization_status.error_message.empty()) {
+      std::cerr << initialization_status.error_message << std::endl;
+    }
     g_is_initialized = true;
     ::Kokkos::finalize();
     std::exit(EXIT_FAILURE);
@@ -487,10 +501,21 @@ std::string version_string_from_int(int version_number) {
 }
 
 void pre_initialize_internal(const Kokkos::InitializationSettings& settings) {
+  if (char const* isa = Kokkos::Impl::host_isa_missing()) {
+    std::stringstream ss;
+    ss << "Error: Kokkos was compiled for a CPU architecture using " << isa
+       << " instructions, which the host CPU does not support."
+       << " Configure Kokkos_ARCH_* and the compiler flags for the oldest CPU"
+       << " the executable runs on."
+       << " Raised by Kokkos::initialize().\n";
+    Kokkos::abort(ss.str().c_str());
+  }
   if (settings.has_disable_warnings() && settings.get_disable_warnings())
     g_show_warnings = false;
   if (settings.has_tune_internals() && settings.get_tune_internals())
     g_tune_internals = true;
+  if (settings.has_host_wait_spin())
+    Kokkos::Impl::host_wait_spin_iterations() = settings.get_host_wait_spin();
   declare_configuration_metadata("version_info", "Kokkos Version",
                                  version_string_from_int(KOKKOS_VERSION));
 #ifdef KOKKOS_COMPILER_APPLECC
@@ -611,6 +636,12 @@ void pre_initialize_internal(const Kokkos::InitializationSettings& settings) {
 #else
   declare_configuration_metadata("options", "KOKKOS_ENABLE_LIBDL", "no");
 #endif
+#ifdef KOKKOS_IMPL_HAVE_16BYTE_COMPARE_AND_SWAP
+  declare_configuration_metadata("options", "16-byte host atomics",
+                                 "compare-and-swap");
+#else
+  declare_configuration_metadata("options", "16-byte host atomics", "locks");
+#endif
 
   declare_configuration_metadata("architecture", "Default Device",
                                  Kokkos::DefaultExecutionSpace::name());
@@ -678,6 +709,8 @@ void pre_initialize_internal(const Kokkos::InitializationSettings& settings) {
 #else
   declare_configuration_metadata("architecture", "CPU architecture", "none");
 #endif
+  declare_configuration_metadata("architecture", "Host CPU instruction sets",
+                                 Kokkos::Impl::host_isa_names());
 
 #if defined(KOKKOS_ARCH_INTEL_GEN)
   declare_configuration_metadata("architecture", "GPU architecture",
@@ -819,6 +852,9 @@ void post_finalize_internal() {
   g_is_finalized   = true;
   g_show_warnings  = true;
   g_tune_internals = false;
+  Kokkos::Impl::host_wait_spin_iterations() =
+      Kokkos::Impl::host_wait_default_spin_iterations;
+  desul::Impl::finalize_host_lock_array();
 }
 
 void fence_internal(const std::string& name) {
@@ -842,6 +878,9 @@ Kokkos Core Options:
                                    left off, Kokkos uses heuristics
   --kokkos-num-threads=INT       : specify total number of threads to use for
                                    parallel regions on the host.
+  --kokkos-host-wait-spin=INT    : number of iterations idle host threads spin
+                                   before blocking until they are woken up
+                                   (default 1024, 0 blocks right away).
   --kokkos-device-id=INT         : specify device id to be used by Kokkos.
   --kokkos-map-device-id-by=(random|mpi_rank)
                                  : strategy to select device-id automatically from
@@ -865,6 +904,10 @@ Kokkos Tools Options:
                                    kokkos-tool as command-line arguments. E.g.
                                    `<EXE> --kokkos-tools-args="-c input.txt"` will
                                    pass `<EXE> -c input.txt` as argc/argv to tool
+  --kokkos-tools-timer=STR       : Time kernels with the built-in timer instead of a
+                                   library: 'summary' prints per-label statistics at
+                                   finalize, 'chrome[:FILE]' also writes a Chrome
+                                   trace (default kokkos_timer_<pid>.json)
 
 Except for --kokkos[-tools]-help, you can alternatively set the corresponding
 environment variable of a flag (all letters in upper-case and underscores
@@ -894,6 +937,7 @@ void Kokkos::Impl::parse_command_line_arguments(
   bool disable_warnings;
   bool print_configuration;
   bool tune_internals;
+  int host_wait_spin;
 
   bool help_flag = false;
 
@@ -933,6 +977,17 @@ void Kokkos::Impl::parse_command_line_arguments(
                               tune_internals)) {
       settings.set_tune_internals(tune_internals);
       remove_flag = true;
+    } else if (check_arg_int(argv[iarg], "--kokkos-host-wait-spin",
+                             host_wait_spin)) {
+      if (!is_valid_host_wait_spin(host_wait_spin)) {
+        std::stringstream ss;
+        ss << "Error: command line argument '" << argv[iarg] << "' is invalid."
+           << " The number of spin iterations must be greater than or equal"
+           << " to zero. Raised by Kokkos::initialize().\n";
+        Kokkos::abort(ss.str().c_str());
+      }
+      settings.set_host_wait_spin(host_wait_spin);
+      remove_flag = true;
     } else if (check_arg(argv[iarg], "--kokkos-help") ||
                check_arg(argv[iarg], "--help")) {
       help_flag   = true;
@@ -1025,6 +1080,18 @@ void Kokkos::Impl::parse_environment_variables(
   if (check_env_bool("KOKKOS_TUNE_INTERNALS", tune_internals)) {
     settings.set_tune_internals(tune_internals);
   }
+  int host_wait_spin;
+  if (check_env_int("KOKKOS_HOST_WAIT_SPIN", host_wait_spin)) {
+    if (!is_valid_host_wait_spin(host_wait_spin)) {
+      std::stringstream ss;
+      ss << "Error: environment variable 'KOKKOS_HOST_WAIT_SPIN="
+         << host_wait_spin << "' is invalid."
+         << " The number of spin iterations must be greater than or equal"
+         << " to zero. Raised by Kokkos::initialize().\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+    settings.set_host_wait_spin(host_wait_spin);
+  }
   char const* map_device_id_by = std::getenv("KOKKOS_MAP_DEVICE_ID_BY");
   if (map_device_id_by != nullptr) {
     if (std::getenv("KOKKOS_DEVICE_ID")) {
@@ -1108,7 +1175,10 @@ void Kokkos::finalize() {
 #ifdef KOKKOS_COMPILER_INTEL
 void Kokkos::fence() { fence("Kokkos::fence: Unnamed Global Fence"); }
 #endif
-void Kokkos::fence(const std::string& name) { fence_internal(name); }
+void Kokkos::fence(const std::string& name) {
+  fence_internal(name);
+  Kokkos::Impl::host_atomic_combining_flush();
+}
 
 namespace {
 void print_helper(std::ostream& os,
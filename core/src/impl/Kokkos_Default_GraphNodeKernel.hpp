@@ -25,6 +25,10 @@
 #include <Kokkos_Parallel.hpp>
 #include <Kokkos_Parallel_Reduce.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 namespace Kokkos {
 namespace Impl {
 
@@ -37,6 +41,13 @@ struct GraphNodeKernelDefaultImpl {
   //      function pointers like in the rest of the graph interface
   virtual void execute_kernel() = 0;
 
+  // Kernel fusion, see GraphImpl::fuse_kernels: a fusable kernel applies its
+  // functor to [begin, end) of its range in the calling thread.
+  virtual bool fusable_range(std::int64_t&, std::int64_t&) const {
+    return false;
+  }
+  virtual void execute_range(std::int64_t, std::int64_t) const {}
+
   GraphNodeKernelDefaultImpl() = default;
 
   explicit GraphNodeKernelDefaultImpl(ExecutionSpace exec)
@@ -83,6 +94,48 @@ class GraphNodeKernelImpl
   }
 
   void execute_kernel() override final { this->base_t::execute(); }
+
+  bool fusable_range(std::int64_t &begin,
+                     std::int64_t &end) const override final {
+    if constexpr (is_fusable) {
+      begin = this->base_t::get_policy().begin();
+      end   = this->base_t::get_policy().end();
+      return true;
+    } else {
+      (void)begin;
+      (void)end;
+      return false;
+    }
+  }
+
+  void execute_range(std::int64_t begin,
+                     std::int64_t end) const override final {
+    if constexpr (is_fusable) {
+      using index_type = typename PolicyType::member_type;
+      using work_tag   = typename PolicyType::work_tag;
+      auto const &functor = this->base_t::get_functor();
+      for (std::int64_t i = begin; i < end; ++i) {
+        if constexpr (std::is_void_v<work_tag>)
+          functor(index_type(i));
+        else
+          functor(work_tag{}, index_type(i));
+      }
+    } else {
+      (void)begin;
+      (void)end;
+    }
+  }
+
+ private:
+  template <class T>
+  using get_functor_t = decltype(std::declval<T const &>().get_functor());
+
+  // The host backends give access to the functor of a RangePolicy
+  // parallel_for
+  static constexpr bool is_fusable =
+      std::is_same_v<PatternTag, Kokkos::ParallelForTag> &&
+      is_specialization_of<PolicyType, Kokkos::RangePolicy>::value &&
+      Kokkos::is_detected_v<get_functor_t, base_t>;
 };
 
 // </editor-fold> end GraphNodeKernelImpl }}}1
@@ -94,6 +147,53 @@ struct GraphNodeAggregateDefaultImpl
   void execute_kernel() override final {}
 };
 
+// Chain of fusable kernels over the same range, run as one parallel loop
+// over chunks of the range with every kernel applied to a chunk in turn, so
+// that a chunk is still in cache when the next kernel touches it.
+template <class ExecutionSpace>
+struct GraphNodeFusedKernelDefaultImpl {
+  // Kernels are called from the threads of the execution space
+  static constexpr bool is_supported =
+      SpaceAccessibility<ExecutionSpace, Kokkos::HostSpace>::accessible;
+  static constexpr std::int64_t chunk_size = 4096;
+
+  GraphNodeKernelDefaultImpl<ExecutionSpace> const* const* m_kernels;
+  std::size_t m_num_kernels;
+  std::int64_t m_begin;
+  std::int64_t m_end;
+
+  void operator()(std::int64_t chunk) const {
+    const std::int64_t begin = m_begin + chunk * chunk_size;
+    const std::int64_t end   = std::min(begin + chunk_size, m_end);
+    for (std::size_t k = 0; k < m_num_kernels; ++k)
+      m_kernels[k]->execute_range(begin, end);
+  }
+
+  static void execute(
+      ExecutionSpace const& exec,
+      std::vector<GraphNodeKernelDefaultImpl<ExecutionSpace> const*> const&
+          kernels,
+      std::int64_t begin, std::int64_t end) {
+    // GraphImpl::fuse_kernels only fuses kernels of supported spaces
+    if constexpr (is_supported) {
+      using policy_t =
+          Kokkos::RangePolicy<ExecutionSpace, Kokkos::IndexType<std::int64_t>>;
+      const std::int64_t num_chunks =
+          (end - begin + chunk_size - 1) / chunk_size;
+      ParallelFor<GraphNodeFusedKernelDefaultImpl, policy_t> closure(
+          GraphNodeFusedKernelDefaultImpl{kernels.data(), kernels.size(),
+                                          begin, end},
+          policy_t(exec, 0, num_chunks));
+      closure.execute();
+    } else {
+      (void)exec;
+      (void)kernels;
+      (void)begin;
+      (void)end;
+    }
+  }
+};
+
 }  // end namespace Impl
 }  // end namespace Kokkos
 
@@ -22,7 +22,9 @@
 #include <impl/Kokkos_Default_Graph_fwd.hpp>
 
 #include <Kokkos_Graph.hpp>
+#include <impl/Kokkos_HostAtomicCombining.hpp>
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -46,6 +48,15 @@ struct GraphNodeBackendSpecificDetails {
 
   Kokkos::ObservingRawPtr<default_kernel_impl_t> m_kernel_ptr = nullptr;
 
+  // Set on the last node of a chain of fused kernels: the first node of the
+  // chain, the kernels of the chain in order, and their common range.
+  Kokkos::ObservingRawPtr<GraphNodeBackendSpecificDetails> m_fused_first =
+      nullptr;
+  std::vector<Kokkos::ObservingRawPtr<default_kernel_impl_t const>>
+      m_fused_kernels          = {};
+  std::int64_t m_fused_begin = 0;
+  std::int64_t m_fused_end   = 0;
+
   bool m_has_executed = false;
   bool m_is_aggregate = false;
   bool m_is_root      = false;
@@ -53,6 +64,9 @@ struct GraphNodeBackendSpecificDetails {
   template <class>
   friend struct HostGraphImpl;
 
+  template <class>
+  friend struct GraphImpl;
+
  protected:
   //----------------------------------------------------------------------------
   // <editor-fold desc="Ctors, destructor, and assignment"> {{{2
@@ -126,20 +140,32 @@ struct GraphNodeBackendSpecificDetails {
       // I'm pretty sure this doesn't need to be atomic under our current
       // supported semantics, but instinct I have feels like it should be...
       m_has_executed = true;
-      for (auto const& predecessor : m_predecessors) {
+      // The nodes fused into this one only have this node as successor, so
+      // running the predecessors of the first one is enough.
+      auto& first = m_fused_first ? *m_fused_first : *this;
+      for (auto const& predecessor : first.m_predecessors) {
         predecessor->execute_node(exec);
       }
 
       // Before executing the kernel, be sure to fence the execution space
       // instance of predecessors.
-      for (const auto& predecessor : m_predecessors) {
+      for (const auto& predecessor : first.m_predecessors) {
         if (predecessor->awaitable() &&
             predecessor->get_execution_space() != this->get_execution_space())
           predecessor->get_execution_space().fence(
               "Kokkos::DefaultGraphNode::execute_node: sync with predecessors");
       }
 
-      m_kernel_ptr->execute_kernel();
+      if (m_fused_first) {
+        GraphNodeFusedKernelDefaultImpl<ExecutionSpace>::execute(
+            get_execution_space(), m_fused_kernels, m_fused_begin,
+            m_fused_end);
+      } else {
+        m_kernel_ptr->execute_kernel();
+      }
+      // Graph kernels bypass the parallel_* dispatch that flushes the host
+      // combining buffers.
+      host_atomic_combining_flush();
     }
     KOKKOS_ENSURES(m_has_executed)
   }
@@ -30,7 +30,12 @@
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_EBO.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace Kokkos {
 namespace Impl {
@@ -136,8 +141,17 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
     return rv;
   }
 
+  void set_kernel_fusion(bool arg_kernel_fusion) {
+    KOKKOS_EXPECTS(!m_has_been_instantiated);
+    m_kernel_fusion = arg_kernel_fusion;
+  }
+
   void instantiate() {
     KOKKOS_EXPECTS(!m_has_been_instantiated);
+    if constexpr (GraphNodeFusedKernelDefaultImpl<
+                      ExecutionSpace>::is_supported) {
+      if (m_kernel_fusion) fuse_kernels();
+    }
     m_has_been_instantiated = true;
   }
 
@@ -169,6 +183,71 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
 
  private:
   bool m_has_been_instantiated = false;
+  bool m_kernel_fusion         = false;
+
+  // Replace every linear chain of parallel_for kernels over the same
+  // RangePolicy range by a single loop applying the kernels chunk by chunk.
+  // A kernel joins the chain of its predecessor if it is its only
+  // predecessor and it is the only successor of that predecessor.
+  void fuse_kernels() {
+    std::vector<node_details_t*> nodes;
+    std::unordered_map<node_details_t*, int> num_successors;
+    {
+      std::unordered_set<node_details_t*> visited;
+      std::vector<node_details_t*> stack;
+      for (auto const& sink : m_sinks) stack.push_back(sink.get());
+      while (!stack.empty()) {
+        auto* node = stack.back();
+        stack.pop_back();
+        if (!visited.insert(node).second) continue;
+        nodes.push_back(node);
+        for (auto const& predecessor : node->m_predecessors) {
+          ++num_successors[predecessor.get()];
+          stack.push_back(predecessor.get());
+        }
+      }
+    }
+
+    auto fusable_range = [](node_details_t const* node, std::int64_t& begin,
+                            std::int64_t& end) {
+      return node->m_kernel_ptr && !node->m_is_aggregate &&
+             node->m_kernel_ptr->fusable_range(begin, end);
+    };
+    // The predecessor this node is fused with, if any
+    auto fused_predecessor = [&](node_details_t const* node) {
+      std::int64_t begin, end, pred_begin, pred_end;
+      if (node->m_predecessors.size() != 1 ||
+          !fusable_range(node, begin, end))
+        return static_cast<node_details_t*>(nullptr);
+      auto* pred = node->m_predecessors.front().get();
+      const bool fuse =
+          num_successors[pred] == 1 &&
+          fusable_range(pred, pred_begin, pred_end) && pred_begin == begin &&
+          pred_end == end &&
+          pred->get_execution_space() == node->get_execution_space();
+      return fuse ? pred : nullptr;
+    };
+
+    std::unordered_set<node_details_t*> fused_into_successor;
+    for (auto* node : nodes)
+      if (auto* pred = fused_predecessor(node))
+        fused_into_successor.insert(pred);
+
+    for (auto* node : nodes) {
+      if (fused_into_successor.count(node)) continue;
+      auto* first = fused_predecessor(node);
+      if (!first) continue;
+      node->m_fused_kernels = {node->m_kernel_ptr, first->m_kernel_ptr};
+      while (auto* pred = fused_predecessor(first)) {
+        node->m_fused_kernels.push_back(pred->m_kernel_ptr);
+        first = pred;
+      }
+      std::reverse(node->m_fused_kernels.begin(), node->m_fused_kernels.end());
+      node->m_fused_first = first;
+      node->m_kernel_ptr->fusable_range(node->m_fused_begin,
+                                        node->m_fused_end);
+    }
+  }
 
   // </editor-fold> end required customizations }}}2
   //----------------------------------------------------------------------------
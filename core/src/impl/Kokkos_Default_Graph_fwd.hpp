@@ -28,6 +28,9 @@ struct GraphNodeKernelDefaultImpl;
 template <class ExecutionSpace>
 struct GraphNodeAggregateDefaultImpl;
 
+template <class ExecutionSpace>
+struct GraphNodeFusedKernelDefaultImpl;
+
 }  // end namespace Impl
 }  // end namespace Kokkos
 
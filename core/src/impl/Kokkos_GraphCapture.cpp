@@ -0,0 +1,46 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+
+namespace Kokkos {
+namespace Impl {
+
+std::atomic<int>& graph_capture_count() {
+  static std::atomic<int> count{0};
+  return count;
+}
+
+int& graph_capture_bypass_depth() {
+  static thread_local int depth = 0;
+  return depth;
+}
+
+std::mutex& graph_capture_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,183 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+
+#ifndef KOKKOS_IMPL_GRAPH_CAPTURE_HPP
+#define KOKKOS_IMPL_GRAPH_CAPTURE_HPP
+
+#include <Kokkos_Graph.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Stream-capture style construction of a Kokkos::Graph: between
+// Experimental::begin_capture(exec) and Experimental::end_capture(exec),
+// parallel_for and parallel_reduce dispatched on exec are appended to a graph
+// instead of being executed.  Each captured kernel depends on the previous
+// one, so the graph preserves the ordering of the instance it replaces.
+
+namespace Kokkos {
+namespace Impl {
+
+std::mutex& graph_capture_mutex();
+
+template <class ExecutionSpace>
+struct GraphCapture {
+  ExecutionSpace exec;
+  Kokkos::Experimental::Graph<ExecutionSpace> graph;
+  Kokkos::Experimental::GraphNodeRef<ExecutionSpace> tail;
+};
+
+// Captures in progress, guarded by graph_capture_mutex()
+template <class ExecutionSpace>
+std::vector<std::unique_ptr<GraphCapture<ExecutionSpace>>>& graph_captures() {
+  static std::vector<std::unique_ptr<GraphCapture<ExecutionSpace>>> captures;
+  return captures;
+}
+
+template <class ExecutionSpace>
+GraphCapture<ExecutionSpace>* graph_capture_find(ExecutionSpace const& exec) {
+  for (auto& capture : graph_captures<ExecutionSpace>())
+    if (capture->exec == exec) return capture.get();
+  return nullptr;
+}
+
+template <class Policy, class Enable = void>
+struct graph_capture_supports_policy : std::false_type {};
+
+template <class Policy>
+struct graph_capture_supports_policy<
+    Policy, std::void_t<typename _add_graph_kernel_tag<Policy>::type>>
+    : std::is_constructible<typename _add_graph_kernel_tag<Policy>::type,
+                            Policy const&> {};
+
+template <class ExecPolicy, class FunctorType>
+bool graph_capture_parallel_for(std::string const& label,
+                                ExecPolicy const& policy,
+                                FunctorType const& functor) {
+  using execution_space = typename ExecPolicy::execution_space;
+  std::lock_guard<std::mutex> lock(graph_capture_mutex());
+  auto* capture = graph_capture_find(policy.space());
+  if (!capture) return false;
+  if constexpr (graph_capture_supports_policy<ExecPolicy>::value) {
+    capture->tail = capture->tail.then_parallel_for(label, policy, functor);
+  } else {
+    throw_runtime_exception(
+        std::string("Kokkos::parallel_for(\"") + label + "\") on " +
+        execution_space::name() +
+        " can't be captured into a graph: unsupported execution policy");
+  }
+  return true;
+}
+
+template <class ExecPolicy, class FunctorType, class ReturnType>
+bool graph_capture_parallel_reduce(std::string const& label,
+                                   ExecPolicy const& policy,
+                                   FunctorType const& functor,
+                                   ReturnType& return_value) {
+  using execution_space = typename ExecPolicy::execution_space;
+  using return_type     = std::remove_cv_t<ReturnType>;
+  std::lock_guard<std::mutex> lock(graph_capture_mutex());
+  auto* capture = graph_capture_find(policy.space());
+  if (!capture) return false;
+
+  constexpr bool accessible_result = [] {
+    if constexpr (Kokkos::is_reducer_v<return_type>)
+      return SpaceAccessibility<execution_space,
+                                typename return_type::result_view_type::
+                                    memory_space>::accessible;
+    else if constexpr (Kokkos::is_view_v<return_type>)
+      return SpaceAccessibility<execution_space,
+                                typename return_type::memory_space>::accessible;
+    else
+      return false;
+  }();
+  if constexpr (accessible_result &&
+                graph_capture_supports_policy<ExecPolicy>::value) {
+    capture->tail = capture->tail.then_parallel_reduce(label, policy, functor,
+                                                       return_value);
+  } else {
+    throw_runtime_exception(
+        std::string("Kokkos::parallel_reduce(\"") + label + "\") on " +
+        execution_space::name() +
+        " can't be captured into a graph: captured reductions need a View or "
+        "reducer result accessible by the execution space");
+  }
+  return true;
+}
+
+template <class ExecutionSpace>
+void graph_capture_reject(ExecutionSpace const& exec, char const* name) {
+  std::lock_guard<std::mutex> lock(graph_capture_mutex());
+  if (graph_capture_find(exec))
+    throw_runtime_exception(std::string(name) + " on " +
+                            ExecutionSpace::name() +
+                            " can't be captured into a graph");
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Start recording the parallel_for and parallel_reduce dispatches
+/// on \c exec into a graph instead of executing them
+///
+/// Other operations on \c exec, e.g. deep_copy, keep executing eagerly, and
+/// parallel_scan throws while the capture is active.  Capture on a dedicated
+/// instance: Views allocated during the capture initialize their data with
+/// kernels on the default instance.
+template <class ExecutionSpace>
+void begin_capture(ExecutionSpace const& exec) {
+  std::lock_guard<std::mutex> lock(Kokkos::Impl::graph_capture_mutex());
+  if (Kokkos::Impl::graph_capture_find(exec))
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("Kokkos::Experimental::begin_capture: this ") +
+        ExecutionSpace::name() + " instance is already being captured");
+  auto capture = std::make_unique<Kokkos::Impl::GraphCapture<ExecutionSpace>>(
+      Kokkos::Impl::GraphCapture<ExecutionSpace>{exec, create_graph(exec), {}});
+  capture->tail = Kokkos::Impl::GraphAccess::create_root_ref(capture->graph);
+  Kokkos::Impl::graph_captures<ExecutionSpace>().push_back(std::move(capture));
+  Kokkos::Impl::graph_capture_count().fetch_add(1, std::memory_order_relaxed);
+}
+
+/// \brief Stop the capture on \c exec and return the recorded graph
+template <class ExecutionSpace>
+Graph<ExecutionSpace> end_capture(ExecutionSpace const& exec) {
+  std::lock_guard<std::mutex> lock(Kokkos::Impl::graph_capture_mutex());
+  auto& captures = Kokkos::Impl::graph_captures<ExecutionSpace>();
+  auto it        = std::find_if(captures.begin(), captures.end(),
+                                [&](auto const& c) { return c->exec == exec; });
+  if (it == captures.end())
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("Kokkos::Experimental::end_capture: this ") +
+        ExecutionSpace::name() + " instance is not being captured");
+  auto graph = std::move((*it)->graph);
+  captures.erase(it);
+  Kokkos::Impl::graph_capture_count().fetch_sub(1, std::memory_order_relaxed);
+  return graph;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_GRAPH_CAPTURE_HPP
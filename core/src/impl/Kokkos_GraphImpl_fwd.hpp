@@ -19,6 +19,11 @@
 
 #include <Kokkos_Macros.hpp>
 
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+#include <atomic>
+#include <string>
+#endif
+
 namespace Kokkos {
 namespace Impl {
 
@@ -53,6 +58,52 @@ struct KernelInGraphProperty {};
 
 struct IsGraphKernelTag {};
 
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+// Number of execution space instances being captured into a graph, see
+// Kokkos::Experimental::begin_capture
+std::atomic<int>& graph_capture_count();
+
+// Number of GraphCaptureBypass scopes open on the calling thread
+int& graph_capture_bypass_depth();
+
+inline bool graph_capture_active() {
+  return graph_capture_count().load(std::memory_order_relaxed) != 0 &&
+         graph_capture_bypass_depth() == 0;
+}
+
+// Record the dispatch into the graph captured on policy.space(), if any.
+// Return whether the dispatch was recorded.
+template <class ExecPolicy, class FunctorType>
+bool graph_capture_parallel_for(std::string const& label,
+                                ExecPolicy const& policy,
+                                FunctorType const& functor);
+
+template <class ExecPolicy, class FunctorType, class ReturnType>
+bool graph_capture_parallel_reduce(std::string const& label,
+                                   ExecPolicy const& policy,
+                                   FunctorType const& functor,
+                                   ReturnType& return_value);
+
+// Throw if exec is being captured, for dispatches graphs can't express
+template <class ExecutionSpace>
+void graph_capture_reject(ExecutionSpace const& exec, char const* name);
+#endif
+
+// Dispatches made by the calling thread inside this scope are executed even
+// if their instance is being captured.  The kernels deep_copy launches
+// internally use it, so that a deep_copy runs eagerly whether it is
+// performed by a memcpy or by a kernel.
+struct GraphCaptureBypass {
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+  GraphCaptureBypass() { ++graph_capture_bypass_depth(); }
+  ~GraphCaptureBypass() { --graph_capture_bypass_depth(); }
+#else
+  GraphCaptureBypass() {}
+#endif
+  GraphCaptureBypass(GraphCaptureBypass const&)            = delete;
+  GraphCaptureBypass& operator=(GraphCaptureBypass const&) = delete;
+};
+
 }  // end namespace Impl
 }  // end namespace Kokkos
 
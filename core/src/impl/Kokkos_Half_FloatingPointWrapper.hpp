@@ -34,6 +34,11 @@ struct is_float16 : std::false_type {};
 /// @tparam T The type to specialize on.
 template <class T>
 struct is_bfloat16 : std::false_type {};
+
+/// @brief templated struct for determining if convert_n(Dst*, const Src*, n)
+/// provides a vectorized conversion of contiguous arrays.
+template <class Dst, class Src>
+struct has_bulk_conversion : std::false_type {};
 }  // namespace Kokkos::Experimental::Impl
 
 #ifdef KOKKOS_IMPL_HALF_TYPE_DEFINED
@@ -0,0 +1,74 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_HostAtomicCombining.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+struct HostAtomicCombiningRegistry {
+  std::mutex mutex;
+  std::vector<HostAtomicCombiningBufferBase*> buffers;
+};
+
+// Intentionally leaked: pool threads may still deregister their buffers while
+// static objects are being destroyed.
+HostAtomicCombiningRegistry& host_atomic_combining_registry() {
+  static auto* registry = new HostAtomicCombiningRegistry;
+  return *registry;
+}
+
+}  // namespace
+
+std::atomic<int>& host_atomic_combining_dirty_count() {
+  static std::atomic<int> dirty_count{0};
+  return dirty_count;
+}
+
+void host_atomic_combining_register(HostAtomicCombiningBufferBase* buffer) {
+  auto& registry = host_atomic_combining_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.buffers.push_back(buffer);
+}
+
+void host_atomic_combining_deregister(HostAtomicCombiningBufferBase* buffer) {
+  auto& registry = host_atomic_combining_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.buffers.erase(
+      std::remove(registry.buffers.begin(), registry.buffers.end(), buffer),
+      registry.buffers.end());
+}
+
+void host_atomic_combining_flush_all() {
+  auto& registry = host_atomic_combining_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto* buffer : registry.buffers) {
+    buffer->flush();
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
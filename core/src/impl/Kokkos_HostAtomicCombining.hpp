@@ -0,0 +1,174 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_ATOMIC_COMBINING_HPP
+#define KOKKOS_IMPL_HOST_ATOMIC_COMBINING_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Atomic.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+/** \brief  Per-thread combining buffers for views with the AtomicCombining
+ *          memory trait.
+ *
+ *  Each host thread owns a small direct-mapped cache per value type and
+ *  operation.  Updates to an address already present in the cache are
+ *  combined locally; an address that evicts another one flushes the evicted
+ *  partial result with a single atomic.  All buffers are flushed at the end
+ *  of every parallel dispatch, by execution space fences, after graph nodes
+ *  and by Kokkos::fence().
+ *
+ *  Each buffer is guarded by its own spin lock.  The owning thread takes
+ *  it for every update, which stays in its own cache, and a flush takes it
+ *  before writing the entries back.  A flush issued for one execution space
+ *  instance may thus run while another instance (e.g. a partition of the
+ *  same host pool) still updates through its threads' buffers: it only
+ *  publishes their partial results early.
+ */
+namespace Kokkos {
+namespace Impl {
+
+class HostAtomicCombiningBufferBase {
+ public:
+  virtual void flush() = 0;
+
+ protected:
+  ~HostAtomicCombiningBufferBase() = default;
+};
+
+void host_atomic_combining_register(HostAtomicCombiningBufferBase*);
+void host_atomic_combining_deregister(HostAtomicCombiningBufferBase*);
+void host_atomic_combining_flush_all();
+
+/** \brief  Number of buffers currently holding unflushed contributions. */
+std::atomic<int>& host_atomic_combining_dirty_count();
+
+/** \brief  Flush the buffers of all threads if any of them is non-empty.
+ *
+ *  Called after every host dispatch, by host execution space fences and
+ *  after each graph node ran.
+ */
+inline void host_atomic_combining_flush() {
+  if (host_atomic_combining_dirty_count().load(std::memory_order_relaxed) !=
+      0) {
+    host_atomic_combining_flush_all();
+  }
+}
+
+struct HostAtomicCombiningAdd {
+  template <class T>
+  static T combine(T const& lhs, T const& rhs) {
+    return lhs + rhs;
+  }
+  template <class T>
+  static void apply(T* ptr, T const& val) {
+    Kokkos::atomic_add(ptr, val);
+  }
+};
+
+struct HostAtomicCombiningXor {
+  template <class T>
+  static T combine(T const& lhs, T const& rhs) {
+    return lhs ^ rhs;
+  }
+  template <class T>
+  static void apply(T* ptr, T const& val) {
+    Kokkos::atomic_xor(ptr, val);
+  }
+};
+
+template <class T, class Op>
+class HostAtomicCombiningBuffer final : public HostAtomicCombiningBufferBase {
+  static constexpr int num_entries = 64;
+
+  struct Entry {
+    T* ptr;
+    T value;
+  };
+
+  Entry m_entries[num_entries] = {};
+  int m_num_used               = 0;
+  std::atomic<bool> m_locked{false};
+
+  void lock() {
+    while (m_locked.exchange(true, std::memory_order_acquire)) {
+      while (m_locked.load(std::memory_order_relaxed)) {
+      }
+    }
+  }
+
+  void unlock() { m_locked.store(false, std::memory_order_release); }
+
+  HostAtomicCombiningBuffer() { host_atomic_combining_register(this); }
+
+  ~HostAtomicCombiningBuffer() {
+    flush();
+    host_atomic_combining_deregister(this);
+  }
+
+ public:
+  HostAtomicCombiningBuffer(HostAtomicCombiningBuffer const&) = delete;
+  HostAtomicCombiningBuffer& operator=(HostAtomicCombiningBuffer const&) =
+      delete;
+
+  static HostAtomicCombiningBuffer& get() {
+    static thread_local HostAtomicCombiningBuffer buffer;
+    return buffer;
+  }
+
+  void update(T* ptr, T const& val) {
+    lock();
+    Entry& entry = m_entries[(reinterpret_cast<uintptr_t>(ptr) / sizeof(T)) %
+                             num_entries];
+    if (entry.ptr == ptr) {
+      entry.value = Op::combine(entry.value, val);
+    } else {
+      if (entry.ptr != nullptr) {
+        Op::apply(entry.ptr, entry.value);
+      } else if (m_num_used++ == 0) {
+        host_atomic_combining_dirty_count().fetch_add(
+            1, std::memory_order_relaxed);
+      }
+      entry.ptr   = ptr;
+      entry.value = val;
+    }
+    unlock();
+  }
+
+  void flush() override {
+    lock();
+    if (m_num_used != 0) {
+      for (Entry& entry : m_entries) {
+        if (entry.ptr != nullptr) {
+          Op::apply(entry.ptr, entry.value);
+          entry.ptr = nullptr;
+        }
+      }
+      m_num_used = 0;
+      host_atomic_combining_dirty_count().fetch_sub(1,
+                                                    std::memory_order_relaxed);
+    }
+    unlock();
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
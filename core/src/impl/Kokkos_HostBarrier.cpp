@@ -37,14 +37,17 @@ namespace Impl {
 
 void HostBarrier::impl_backoff_wait_until_equal(
     int* ptr, const int v, const bool active_wait) noexcept {
-  unsigned count = 0u;
+  const int spin = active_wait ? host_wait_spin_iterations() : 0;
+  int count      = 0;
 
   while (!test_equal(ptr, v)) {
-    const int c = int_log2(++count);
-    if (!active_wait || c > log2_iterations_till_sleep) {
-      std::this_thread::sleep_for(
-          std::chrono::nanoseconds(c < 16 ? 256 * c : 4096));
-    } else if (c > log2_iterations_till_yield) {
+    if (spin < ++count) {
+      // Done spinning, block until the next arrival or release
+      const int observed = Kokkos::atomic_load(ptr);
+      if (observed != v) host_wait_while_equal(ptr, observed);
+      continue;
+    }
+    if (int_log2(static_cast<unsigned>(count)) > log2_iterations_till_yield) {
       std::this_thread::yield();
     }
 #if defined(KOKKOS_ENABLE_ASM)
@@ -19,6 +19,7 @@
 
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_HostWait.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -64,7 +65,6 @@ class HostBarrier {
   static constexpr int num_nops                   = 32;
   static constexpr int iterations_till_backoff    = 64;
   static constexpr int log2_iterations_till_yield = 4;
-  static constexpr int log2_iterations_till_sleep = 6;
 
  public:
   // will return true if call is the last thread to arrive
@@ -80,6 +80,7 @@ class HostBarrier {
 
     if (master_wait && result) {
       Kokkos::atomic_fetch_add(buffer + master_idx, 1);
+      KOKKOS_IF_ON_HOST((host_wake_all(buffer + master_idx);))
     }
 
     return result;
@@ -95,6 +96,7 @@ class HostBarrier {
     Kokkos::memory_fence();
     Kokkos::atomic_fetch_sub(buffer + arrive_idx, size);
     Kokkos::atomic_fetch_add(buffer + wait_idx, 1);
+    KOKKOS_IF_ON_HOST((host_wake_all(buffer + wait_idx);))
   }
 
   // should only be called by the master thread, will allow the master thread to
@@ -21,6 +21,9 @@
 #include "Kokkos_Core.hpp"
 #include "Kokkos_HostSpace_deepcopy.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace Kokkos {
 
 namespace Impl {
@@ -59,82 +62,24 @@ void hostspace_parallel_deepcopy_async(const ExecutionSpace& exec, void* dst,
     if (0 < n) std::memcpy(dst, src, n);
     return;
   }
-
-  // Both src and dst are aligned the same way with respect to 8 byte words
-  if (reinterpret_cast<ptrdiff_t>(src) % 8 ==
-      reinterpret_cast<ptrdiff_t>(dst) % 8) {
-    char* dst_c       = reinterpret_cast<char*>(dst);
-    const char* src_c = reinterpret_cast<const char*>(src);
-    int count         = 0;
-    // get initial bytes copied
-    while (reinterpret_cast<ptrdiff_t>(dst_c) % 8 != 0) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-      count++;
-    }
-
-    // copy the bulk of the data
-    double* dst_p       = reinterpret_cast<double*>(dst_c);
-    const double* src_p = reinterpret_cast<const double*>(src_c);
-    Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_double",
-                         policy_t(exec, 0, (n - count) / 8),
-                         [=](const ptrdiff_t i) { dst_p[i] = src_p[i]; });
-
-    // get final data copied
-    dst_c += ((n - count) / 8) * 8;
-    src_c += ((n - count) / 8) * 8;
-    char* dst_end = reinterpret_cast<char*>(dst) + n;
-    while (dst_c != dst_end) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-    }
-    return;
-  }
-
-  // Both src and dst are aligned the same way with respect to 4 byte words
-  if (reinterpret_cast<ptrdiff_t>(src) % 4 ==
-      reinterpret_cast<ptrdiff_t>(dst) % 4) {
-    char* dst_c       = reinterpret_cast<char*>(dst);
-    const char* src_c = reinterpret_cast<const char*>(src);
-    int count         = 0;
-    // get initial bytes copied
-    while (reinterpret_cast<ptrdiff_t>(dst_c) % 4 != 0) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-      count++;
-    }
-
-    // copy the bulk of the data
-    int32_t* dst_p       = reinterpret_cast<int32_t*>(dst_c);
-    const int32_t* src_p = reinterpret_cast<const int32_t*>(src_c);
-    Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_int",
-                         policy_t(exec, 0, (n - count) / 4),
-                         [=](const ptrdiff_t i) { dst_p[i] = src_p[i]; });
-
-    // get final data copied
-    dst_c += ((n - count) / 4) * 4;
-    src_c += ((n - count) / 4) * 4;
-    char* dst_end = reinterpret_cast<char*>(dst) + n;
-    while (dst_c != dst_end) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-    }
-    return;
-  }
 #endif
 
-  // Src and dst are not aligned the same way, we can only to byte wise copy.
-  {
-    char* dst_p       = reinterpret_cast<char*>(dst);
-    const char* src_p = reinterpret_cast<const char*>(src);
-    Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_char",
-                         policy_t(exec, 0, n),
-                         [=](const ptrdiff_t i) { dst_p[i] = src_p[i]; });
-  }
+  // Copy blocks with std::memcpy, which the C library dispatches at run time
+  // to the widest vector instructions of the host CPU whatever the
+  // configured architecture, and which handles any relative alignment of
+  // src and dst.
+  constexpr ptrdiff_t block_size = 4 * 8192;
+  char* dst_c                    = reinterpret_cast<char*>(dst);
+  const char* src_c              = reinterpret_cast<const char*>(src);
+  GraphCaptureBypass bypass_capture;
+  Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_blocks",
+                       policy_t(exec, 0, (n + block_size - 1) / block_size),
+                       [=](const ptrdiff_t i) {
+                         const ptrdiff_t begin = i * block_size;
+                         const ptrdiff_t end = std::min(begin + block_size, n);
+                         std::memcpy(dst_c + begin, src_c + begin,
+                                     end - begin);
+                       });
 }
 
 // Explicit instantiation
@@ -66,6 +66,7 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
         mem->m_team_alloc             = 1;
         mem->m_league_rank            = rank;
         mem->m_league_size            = size;
+        mem->m_pool_rendezvous_step   = 0;
         mem->m_team_rendezvous_step   = 0;
         pool[rank]                    = mem;
       }
@@ -213,53 +214,9 @@ int HostThreadTeamData::get_work_stealing() noexcept {
       }
     }
 
-    if (w.first == -1 && m_steal_rank != m_pool_rank) {
-      HostThreadTeamData *const *const pool =
-          reinterpret_cast<HostThreadTeamData **>(m_pool_scratch +
-                                                  m_pool_members);
-
-      // Attempt from beginning failed, try to steal from end of neighbor
-
-      pair_int_t volatile *steal_range = &(pool[m_steal_rank]->m_work_range);
-
-      for (int attempt = true; attempt;) {
-        // Query and attempt to update steal_work_range
-        //   from: [ w.first , w.second )
-        //   to:   [ w.first , w.second - 1 ) = w_new
-        //
-        // If w is invalid then is just a query.
-
-        const pair_int_t w_new(w.first, w.second - 1);
-
-        w = Kokkos::atomic_compare_exchange(steal_range, w, w_new);
-
-        if (w.first < w.second) {
-          // steal_work_range is viable
-
-          // If steal is successful then don't repeat attempt to steal
-          attempt = !(w_new.first == w.first && w_new.second == w.second - 1);
-        } else {
-          // steal_work_range is not viable, move to next member
-          w.first  = -1;
-          w.second = -1;
-
-          // We need to figure out whether the next team is active
-          // m_steal_rank + m_team_alloc could be the next base_rank to steal
-          // from but only if there are another m_team_size threads available so
-          // that that base rank has a full team.
-          m_steal_rank =
-              m_steal_rank + m_team_alloc + m_team_size <= m_pool_size
-                  ? m_steal_rank + m_team_alloc
-                  : 0;
-
-          steal_range = &(pool[m_steal_rank]->m_work_range);
-
-          // If tried all other members then don't repeat attempt to steal
-          attempt = m_steal_rank != m_pool_rank;
-        }
-      }
-
-      if (w.first != -1) w.first = w.second - 1;
+    if (w.first == -1 && 1 < m_league_size) {
+      // Attempt from beginning failed, try to steal from another team
+      w.first = steal_work_from_other_team();
     }
 
     if (1 < m_team_size) {
@@ -278,5 +235,65 @@ int HostThreadTeamData::get_work_stealing() noexcept {
   return w.first;
 }
 
+int HostThreadTeamData::steal_work_from_other_team() noexcept {
+  HostThreadTeamData *const *const pool =
+      reinterpret_cast<HostThreadTeamData **>(m_pool_scratch + m_pool_members);
+
+  // Start at a random team so that idle teams spread over the victims
+  // instead of all draining the same neighbor one index at a time.
+  m_steal_seed ^= m_steal_seed << 13;
+  m_steal_seed ^= m_steal_seed >> 17;
+  m_steal_seed ^= m_steal_seed << 5;
+  const int start = m_steal_seed % m_league_size;
+
+  for (int i = 0; i < m_league_size; ++i) {
+    const int steal_rank = ((start + i) % m_league_size) * m_team_alloc;
+
+    // Skip this team, and a partial team at the end of the pool
+    if (steal_rank == m_team_base || m_pool_size < steal_rank + m_team_size)
+      continue;
+
+    pair_int_t volatile *steal_range = &(pool[steal_rank]->m_work_range);
+
+    for (pair_int_t w(-1, -1);;) {
+      // Query and attempt to update steal_work_range
+      //   from: [ w.first , w.second )
+      //   to:   [ w.first , w.second - half ) = w_new
+      // taking the upper half, rounded up, like guided self-scheduling.
+      //
+      // If w is invalid then is just a query.
+
+      const int64_t half = (w.second - w.first + 1) / 2;
+      const pair_int_t w_new(w.first, w.second - half);
+
+      const pair_int_t w_old =
+          Kokkos::atomic_compare_exchange(steal_range, w, w_new);
+
+      // steal_work_range is not viable, move to next team
+      if (!(w_old.first < w_old.second)) break;
+
+      if (w_old.first == w.first && w_old.second == w.second) {
+        // Stole [ w_new.second , w.second ), keep the rest of it stealable
+        // by other teams as this team's partition.
+        const pair_int_t rest(w_new.second + 1, w.second);
+        if (rest.first < rest.second) {
+          for (pair_int_t own(-1, -1);;) {
+            const pair_int_t own_old =
+                Kokkos::atomic_compare_exchange(&m_work_range, own, rest);
+            if (own_old.first == own.first && own_old.second == own.second)
+              break;
+            own = own_old;
+          }
+        }
+        return w_new.second;
+      }
+
+      w = w_old;
+    }
+  }
+
+  return -1;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -24,6 +24,7 @@
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_HostBarrier.hpp>
 
+#include <cstdint>
 #include <limits>     // std::numeric_limits
 #include <algorithm>  // std::max
 
@@ -95,7 +96,7 @@ class HostThreadTeamData {
   int m_league_rank;
   int m_league_size;
   int m_work_chunk;
-  int m_steal_rank;  // work stealing rank
+  uint32_t m_steal_seed;  // random choice of the teams to steal from
   int mutable m_pool_rendezvous_step;
   int mutable m_team_rendezvous_step;
 
@@ -193,7 +194,7 @@ class HostThreadTeamData {
         m_league_rank(0),
         m_league_size(1),
         m_work_chunk(0),
-        m_steal_rank(0),
+        m_steal_seed(0),
         m_pool_rendezvous_step(0),
         m_team_rendezvous_step(0) {
   }
@@ -350,6 +351,14 @@ class HostThreadTeamData {
   // If that fails then try to steal from end of another teams' partition.
   int get_work_stealing() noexcept;
 
+ private:
+  // Steal the upper half of the partition of another team, visiting the
+  // teams from a random one.  Return the first stolen index and make the
+  // rest of the stolen indices this team's partition.
+  int steal_work_from_other_team() noexcept;
+
+ public:
+
   //----------------------------------------
   // Set the initial work partitioning of [ 0 .. length ) among the teams
   // with granularity of chunk
@@ -371,12 +380,8 @@ class HostThreadTeamData {
     m_work_range.first  = static_cast<int64_t>(part) * m_league_rank;
     m_work_range.second = m_work_range.first + part;
 
-    // Steal from next team, round robin
-    // The next team is offset by m_team_alloc if it fits in the pool.
-
-    m_steal_rank = m_team_base + m_team_alloc + m_team_size <= m_pool_size
-                       ? m_team_base + m_team_alloc
-                       : 0;
+    // Any nonzero seed works for the xorshift generator
+    if (m_steal_seed == 0) m_steal_seed = 2654435761u * (m_pool_rank + 1u);
   }
 
   std::pair<int64_t, int64_t> get_work_partition() noexcept {
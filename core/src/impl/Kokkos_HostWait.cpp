@@ -0,0 +1,78 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_HostWait.hpp>
+#include <impl/Kokkos_BitOps.hpp>
+
+#if defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+int& host_wait_spin_iterations() {
+  static int spin_iterations = host_wait_default_spin_iterations;
+  return spin_iterations;
+}
+
+std::atomic<int>& host_wait_sleeper_count() {
+  static std::atomic<int> sleeper_count{0};
+  return sleeper_count;
+}
+
+void host_wait_while_equal(int const* ptr, int value) noexcept {
+  int const volatile* const flag = ptr;
+#if defined(__linux__)
+  host_wait_sleeper_count().fetch_add(1);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  // The kernel only puts the thread to sleep if *ptr still equals value, so
+  // a wake up between the test and the system call is not lost.  Loop on
+  // spurious wake ups.
+  while (*flag == value) {
+    syscall(SYS_futex, ptr, FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+  }
+  host_wait_sleeper_count().fetch_sub(1);
+#else
+  for (unsigned count = 0u; *flag == value;) {
+    const int c = int_log2(++count);
+    std::this_thread::sleep_for(
+        std::chrono::nanoseconds(c < 16 ? 256 * c : 4096));
+  }
+#endif
+  std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+void host_wake_all_impl(int const* ptr) noexcept {
+#if defined(__linux__)
+  syscall(SYS_futex, ptr, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+  (void)ptr;
+#endif
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
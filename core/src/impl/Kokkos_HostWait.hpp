@@ -0,0 +1,64 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_WAIT_HPP
+#define KOKKOS_IMPL_HOST_WAIT_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <atomic>
+
+//----------------------------------------------------------------------------
+/** \brief  Passive waiting of host threads on an int.
+ *
+ *  Host thread pools spin for a while on the flags they wait for, then call
+ *  host_wait_while_equal to block without using the CPU.  On Linux this is
+ *  a futex, elsewhere it falls back to sleeping with exponential backoff.
+ *  A thread changing a flag other threads may block on must then call
+ *  host_wake_all, which only makes a system call if some thread is blocked.
+ */
+namespace Kokkos {
+namespace Impl {
+
+inline constexpr int host_wait_default_spin_iterations = 1 << 10;
+
+/** \brief  Spin iterations of a waiting host thread before it blocks, set
+ *          by the host_wait_spin initialization setting.
+ */
+int& host_wait_spin_iterations();
+
+/** \brief  Number of host threads blocked in host_wait_while_equal. */
+std::atomic<int>& host_wait_sleeper_count();
+
+/** \brief  Block the calling thread as long as *ptr == value. */
+void host_wait_while_equal(int const* ptr, int value) noexcept;
+
+void host_wake_all_impl(int const* ptr) noexcept;
+
+/** \brief  Wake the threads blocked on ptr, after *ptr was changed. */
+inline void host_wake_all(int const* ptr) noexcept {
+  // Either the waiter sees the new value of *ptr, or this sees the waiter
+  // in the sleeper count, see host_wait_while_equal.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (host_wait_sleeper_count().load(std::memory_order_relaxed) != 0) {
+    host_wake_all_impl(ptr);
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_HOST_WAIT_HPP
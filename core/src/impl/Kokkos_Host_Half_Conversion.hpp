@@ -0,0 +1,355 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_HALF_HPP_
+#define KOKKOS_HOST_HALF_HPP_
+
+#if defined(KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED) || \
+    defined(KOKKOS_IMPL_HOST_BHALF_TYPE_DEFINED)
+
+#include <impl/Kokkos_Half_FloatingPointWrapper.hpp>
+#include <Kokkos_ReductionIdentity.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__F16C__) || defined(__AVX512F__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#ifdef KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED
+namespace Kokkos {
+namespace Experimental {
+
+/************************** half conversions **********************************/
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(half_t val) { return val; }
+
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(float val) { return half_t::impl_type(val); }
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(bool val) { return half_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(double val) {
+  return half_t::impl_type(Kokkos::Impl::double_to_float_round_to_odd(val));
+}
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(short val) { return half_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(unsigned short val) {
+  return half_t::impl_type(float(val));
+}
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(int val) { return half_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(unsigned int val) { return half_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(long long val) { return half_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(unsigned long long val) {
+  return half_t::impl_type(float(val));
+}
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(long val) { return half_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(unsigned long val) {
+  return half_t::impl_type(float(val));
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, float>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, bool>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, double>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, short>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, unsigned short>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, int>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, unsigned int>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, long>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, unsigned long>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, long long>, T>
+cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION
+    std::enable_if_t<std::is_same_v<T, unsigned long long>, T>
+    cast_from_half(half_t val) {
+  return static_cast<T>(static_cast<float>(half_t::impl_type(val)));
+}
+
+}  // namespace Experimental
+
+template <>
+struct reduction_identity<Kokkos::Experimental::half_t> {
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float sum() noexcept {
+    return 0.0F;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float prod() noexcept {
+    return 1.0F;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float max() noexcept {
+    return -65504.0F;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float min() noexcept {
+    return 65504.0F;
+  }
+};
+
+}  // namespace Kokkos
+#endif  // KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED
+
+#ifdef KOKKOS_IMPL_HOST_BHALF_TYPE_DEFINED
+namespace Kokkos {
+namespace Experimental {
+
+/************************** bhalf conversions *********************************/
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(bhalf_t val) { return val; }
+
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(float val) { return bhalf_t::impl_type(val); }
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(bool val) { return bhalf_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(double val) {
+  return bhalf_t::impl_type(Kokkos::Impl::double_to_float_round_to_odd(val));
+}
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(short val) { return bhalf_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(unsigned short val) {
+  return bhalf_t::impl_type(float(val));
+}
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(int val) { return bhalf_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(unsigned int val) {
+  return bhalf_t::impl_type(float(val));
+}
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(long long val) { return bhalf_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(unsigned long long val) {
+  return bhalf_t::impl_type(float(val));
+}
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(long val) { return bhalf_t::impl_type(float(val)); }
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(unsigned long val) {
+  return bhalf_t::impl_type(float(val));
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, float>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, bool>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, double>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, short>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, unsigned short>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, int>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, unsigned int>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, long>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, unsigned long>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_same_v<T, long long>, T>
+cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+template <class T>
+KOKKOS_INLINE_FUNCTION
+    std::enable_if_t<std::is_same_v<T, unsigned long long>, T>
+    cast_from_bhalf(bhalf_t val) {
+  return static_cast<T>(static_cast<float>(bhalf_t::impl_type(val)));
+}
+
+}  // namespace Experimental
+
+template <>
+struct reduction_identity<Kokkos::Experimental::bhalf_t> {
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float sum() noexcept {
+    return 0.0F;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float prod() noexcept {
+    return 1.0F;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float max() noexcept {
+    return -3.38953139e38F;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr static float min() noexcept {
+    return 3.38953139e38F;
+  }
+};
+
+}  // namespace Kokkos
+#endif  // KOKKOS_IMPL_HOST_BHALF_TYPE_DEFINED
+
+/************************** bulk conversions **********************************/
+// Contiguous float <-> half conversions for deep_copy between Views of the
+// two types.  They use the vector conversion instructions where the target
+// has them and leave the rest of the work to the scalar versions.
+namespace Kokkos::Experimental::Impl {
+
+#ifdef KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED
+template <>
+struct has_bulk_conversion<half_t, float> : std::true_type {};
+template <>
+struct has_bulk_conversion<float, half_t> : std::true_type {};
+
+inline void convert_n(half_t* dst, const float* src, std::size_t n) {
+  // half_t is standard layout with the bits as its first member
+  auto* out     = reinterpret_cast<std::uint16_t*>(dst);
+  std::size_t i = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(out + i),
+        _mm512_cvtps_ph(_mm512_loadu_ps(src + i),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+#elif defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(out + i),
+        _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  for (; i + 4 <= n; i += 4) {
+    vst1_u16(out + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+  }
+#endif
+  for (; i < n; ++i) out[i] = Kokkos::Impl::float_to_half_bits(src[i]);
+}
+
+inline void convert_n(float* dst, const half_t* src, std::size_t n) {
+  const auto* in = reinterpret_cast<const std::uint16_t*>(src);
+  std::size_t i  = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(dst + i,
+                     _mm512_cvtph_ps(_mm256_loadu_si256(
+                         reinterpret_cast<const __m256i*>(in + i))));
+  }
+#elif defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(
+                                  reinterpret_cast<const __m128i*>(in + i))));
+  }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  for (; i + 4 <= n; i += 4) {
+    vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(in + i))));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = Kokkos::Impl::half_bits_to_float(in[i]);
+}
+#endif  // KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED
+
+#ifdef KOKKOS_IMPL_HOST_BHALF_TYPE_DEFINED
+template <>
+struct has_bulk_conversion<bhalf_t, float> : std::true_type {};
+template <>
+struct has_bulk_conversion<float, bhalf_t> : std::true_type {};
+
+// The bfloat16 conversions are branch-free integer ops that the compiler
+// vectorizes for whatever the target supports.
+inline void convert_n(bhalf_t* dst, const float* src, std::size_t n) {
+  auto* out = reinterpret_cast<std::uint16_t*>(dst);
+  for (std::size_t i = 0; i < n; ++i)
+    out[i] = Kokkos::Impl::float_to_bhalf_bits(src[i]);
+}
+
+inline void convert_n(float* dst, const bhalf_t* src, std::size_t n) {
+  const auto* in = reinterpret_cast<const std::uint16_t*>(src);
+  for (std::size_t i = 0; i < n; ++i)
+    dst[i] = Kokkos::Impl::bhalf_bits_to_float(in[i]);
+}
+#endif  // KOKKOS_IMPL_HOST_BHALF_TYPE_DEFINED
+
+}  // namespace Kokkos::Experimental::Impl
+
+#endif  // KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED || ..._BHALF_TYPE_DEFINED
+#endif  // KOKKOS_HOST_HALF_HPP_
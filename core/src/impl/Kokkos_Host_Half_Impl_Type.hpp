@@ -0,0 +1,199 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_HALF_IMPL_TYPE_HPP_
+#define KOKKOS_HOST_HALF_IMPL_TYPE_HPP_
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_BitManipulation.hpp>  // bit_cast
+
+#include <cstdint>
+
+// Builds without a device backend get 16-bit storage for half_t and bhalf_t.
+// The wrapper still does arithmetic in float, only loads and stores convert.
+// Device backends bring their own half types, so stay out of their way.
+#if !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_HIP) &&         \
+    !defined(KOKKOS_ENABLE_SYCL) && !defined(KOKKOS_ENABLE_OPENMPTARGET) && \
+    !defined(KOKKOS_ENABLE_OPENACC)
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace Kokkos::Impl {
+
+// binary16 <-> binary32 with round to nearest even.  The portable versions
+// follow F. Giesen, "half <-> float conversions" (public domain).
+KOKKOS_INLINE_FUNCTION
+std::uint16_t float_to_half_bits(float f) noexcept {
+#if defined(__F16C__)
+  return _cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT);
+#elif defined(__aarch64__)
+  return Kokkos::bit_cast<std::uint16_t>(static_cast<__fp16>(f));
+#else
+  constexpr std::uint32_t f32_infinity = 255u << 23;
+  constexpr std::uint32_t f16_overflow = (127u + 16u) << 23;  // 65536.f
+  constexpr std::uint32_t f16_normal   = (127u - 14u) << 23;  // 2^-14
+  constexpr std::uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u)
+                                         << 23;
+
+  std::uint32_t x          = Kokkos::bit_cast<std::uint32_t>(f);
+  const std::uint32_t sign = (x >> 16) & 0x8000u;
+  x &= 0x7fffffffu;
+
+  std::uint32_t h;
+  if (x >= f16_overflow) {
+    // Inf stays Inf, NaN becomes a quiet NaN
+    h = x > f32_infinity ? 0x7e00u : 0x7c00u;
+  } else if (x < f16_normal) {
+    // Subnormal or zero: let the float adder do the rounding
+    h = Kokkos::bit_cast<std::uint32_t>(Kokkos::bit_cast<float>(x) +
+                                        Kokkos::bit_cast<float>(denorm_magic)) -
+        denorm_magic;
+  } else {
+    // Rebias the exponent and round the 13 dropped mantissa bits
+    const std::uint32_t mant_odd = (x >> 13) & 1u;
+    h = (x + ((15u - 127u) << 23) + 0xfffu + mant_odd) >> 13;
+  }
+  return static_cast<std::uint16_t>(sign | h);
+#endif
+}
+
+KOKKOS_INLINE_FUNCTION
+float half_bits_to_float(std::uint16_t h) noexcept {
+#if defined(__F16C__)
+  return _cvtsh_ss(h);
+#elif defined(__aarch64__)
+  return static_cast<float>(Kokkos::bit_cast<__fp16>(h));
+#else
+  constexpr std::uint32_t shifted_exp = 0x7c00u << 13;
+  constexpr std::uint32_t magic       = 113u << 23;
+
+  std::uint32_t x         = (std::uint32_t(h) & 0x7fffu) << 13;
+  const std::uint32_t exp = x & shifted_exp;
+  x += (127u - 15u) << 23;
+  if (exp == shifted_exp) {
+    // Inf or NaN
+    x += (128u - 16u) << 23;
+  } else if (exp == 0) {
+    // Zero or subnormal: renormalize through the float subtraction
+    x += 1u << 23;
+    x = Kokkos::bit_cast<std::uint32_t>(Kokkos::bit_cast<float>(x) -
+                                        Kokkos::bit_cast<float>(magic));
+  }
+  return Kokkos::bit_cast<float>(x | (std::uint32_t(h) & 0x8000u) << 16);
+#endif
+}
+
+// bfloat16 is the upper half of a binary32, rounding is a few integer ops
+// on any target.
+KOKKOS_INLINE_FUNCTION
+std::uint16_t float_to_bhalf_bits(float f) noexcept {
+  const std::uint32_t x       = Kokkos::bit_cast<std::uint32_t>(f);
+  const std::uint32_t rounded = (x + 0x7fffu + ((x >> 16) & 1u)) >> 16;
+  // Keep NaN a quiet NaN even if its payload sits in the low bits
+  const std::uint32_t nan = (x >> 16) | 0x40u;
+  return static_cast<std::uint16_t>((x & 0x7fffffffu) > 0x7f800000u ? nan
+                                                                    : rounded);
+}
+
+KOKKOS_INLINE_FUNCTION
+float bhalf_bits_to_float(std::uint16_t h) noexcept {
+  return Kokkos::bit_cast<float>(std::uint32_t(h) << 16);
+}
+
+// double -> float rounding to odd: truncate and set the last bit if anything
+// was dropped.  Rounding the result to binary16 or bfloat16 to nearest even
+// then gives the correctly rounded double, unlike two round to nearest steps.
+KOKKOS_INLINE_FUNCTION
+float double_to_float_round_to_odd(double d) noexcept {
+  float f = static_cast<float>(d);
+  // NaN fails both comparisons and is passed through
+  if (static_cast<double>(f) != d && d == d) {
+    std::uint32_t x = Kokkos::bit_cast<std::uint32_t>(f);
+    // Step back towards zero if round to nearest went away from it
+    if ((d < 0) == (static_cast<double>(f) < d)) --x;
+    f = Kokkos::bit_cast<float>(x | 1u);
+  }
+  return f;
+}
+
+/// \brief 16-bit storage of a binary16 value.
+///
+/// Only converts to and from float, floating_point_wrapper provides the
+/// arithmetic.
+struct host_half_storage {
+  std::uint16_t bits;
+
+  host_half_storage() = default;
+
+  KOKKOS_FUNCTION
+  explicit host_half_storage(float f) noexcept : bits(float_to_half_bits(f)) {}
+
+  KOKKOS_FUNCTION
+  explicit operator float() const noexcept { return half_bits_to_float(bits); }
+
+  KOKKOS_FUNCTION
+  explicit operator double() const noexcept { return half_bits_to_float(bits); }
+};
+
+/// \brief 16-bit storage of a bfloat16 value.
+struct host_bhalf_storage {
+  std::uint16_t bits;
+
+  host_bhalf_storage() = default;
+
+  KOKKOS_FUNCTION
+  explicit host_bhalf_storage(float f) noexcept
+      : bits(float_to_bhalf_bits(f)) {}
+
+  KOKKOS_FUNCTION
+  explicit operator float() const noexcept { return bhalf_bits_to_float(bits); }
+
+  KOKKOS_FUNCTION
+  explicit operator double() const noexcept {
+    return bhalf_bits_to_float(bits);
+  }
+};
+
+}  // namespace Kokkos::Impl
+
+// Make sure no one else tries to define half_t
+#ifndef KOKKOS_IMPL_HALF_TYPE_DEFINED
+#define KOKKOS_IMPL_HALF_TYPE_DEFINED
+#define KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED
+
+namespace Kokkos::Impl {
+struct half_impl_t {
+  using type = host_half_storage;
+};
+}  // namespace Kokkos::Impl
+#endif  // KOKKOS_IMPL_HALF_TYPE_DEFINED
+
+// Make sure no one else tries to define bhalf_t
+#ifndef KOKKOS_IMPL_BHALF_TYPE_DEFINED
+#define KOKKOS_IMPL_BHALF_TYPE_DEFINED
+#define KOKKOS_IMPL_HOST_BHALF_TYPE_DEFINED
+
+namespace Kokkos::Impl {
+struct bhalf_impl_t {
+  using type = host_bhalf_storage;
+};
+}  // namespace Kokkos::Impl
+#endif  // KOKKOS_IMPL_BHALF_TYPE_DEFINED
+
+#endif  // no device backend
+#endif  // KOKKOS_HOST_HALF_IMPL_TYPE_HPP_
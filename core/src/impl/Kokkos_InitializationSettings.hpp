@@ -67,9 +67,11 @@ class InitializationSettings {
   KOKKOS_IMPL_DECLARE(bool, disable_warnings);
   KOKKOS_IMPL_DECLARE(bool, print_configuration);
   KOKKOS_IMPL_DECLARE(bool, tune_internals);
+  KOKKOS_IMPL_DECLARE(int, host_wait_spin);
   KOKKOS_IMPL_DECLARE(bool, tools_help);
   KOKKOS_IMPL_DECLARE(std::string, tools_libs);
   KOKKOS_IMPL_DECLARE(std::string, tools_args);
+  KOKKOS_IMPL_DECLARE(std::string, tools_timer);
 
 #undef KOKKOS_IMPL_INIT_ARGS_DATA_MEMBER_TYPE
 #undef KOKKOS_IMPL_INIT_ARGS_DATA_MEMBER
@@ -18,6 +18,7 @@
 #define KOKKOS_IMPL_PUBLIC_INCLUDE
 #endif
 
+#include <Kokkos_MemoryPool.hpp>
 #include <impl/Kokkos_Error.hpp>
 
 #include <ostream>
@@ -84,24 +85,71 @@ void memory_pool_bounds_verification(size_t min_block_alloc_size,
   }
 }
 
+/* Verify size class constraints:
+ *   size_classes_per_doubling is 1, 2, 4 or 8
+ *   8 <= min_block_size / size_classes_per_doubling
+ *   at most 31 size classes if size_classes_per_doubling > 1
+ */
+void memory_pool_size_class_verification(size_t size_classes_per_doubling,
+                                         size_t min_block_size,
+                                         size_t max_block_size) {
+  const bool ok_classes =
+      size_classes_per_doubling == 1 || size_classes_per_doubling == 2 ||
+      size_classes_per_doubling == 4 || size_classes_per_doubling == 8;
+
+  size_t class_count = 1;
+  for (size_t size = min_block_size; size < max_block_size; size *= 2) {
+    class_count += size_classes_per_doubling;
+  }
+
+  const bool ok_alignment =
+      ok_classes && 8 <= min_block_size / size_classes_per_doubling;
+
+  const bool ok_count = size_classes_per_doubling == 1 || class_count <= 31;
+
+  if (!ok_classes || !ok_alignment || !ok_count) {
+    std::ostringstream msg;
+
+    msg << "Kokkos::MemoryPool size class constraint violation";
+
+    if (!ok_classes) {
+      msg << " : size_classes_per_doubling(" << size_classes_per_doubling
+          << ") is not 1, 2, 4 or 8";
+    } else if (!ok_alignment) {
+      msg << " : min_block_size(" << min_block_size
+          << ") / size_classes_per_doubling(" << size_classes_per_doubling
+          << ") < 8";
+    }
+
+    if (!ok_count) {
+      msg << " : size_class_count(" << class_count << ") > 31";
+    }
+
+    Kokkos::Impl::throw_runtime_exception(msg.str());
+  }
+}
+
 // This has way too many parameters, but it is entirely for moving the iostream
 // inclusion out of the header file with as few changes as possible
 void _print_memory_pool_state(std::ostream& s, uint32_t const* sb_state_ptr,
                               int32_t sb_count, uint32_t sb_size_lg2,
                               uint32_t sb_state_size, uint32_t state_shift,
-                              uint32_t state_used_mask) {
+                              uint32_t state_used_mask, uint32_t state_base,
+                              uint32_t min_block_size_lg2,
+                              uint32_t size_class_lg2) {
   s << "pool_size(" << (size_t(sb_count) << sb_size_lg2) << ")"
     << " superblock_size(" << (1LU << sb_size_lg2) << ")" << std::endl;
 
   for (int32_t i = 0; i < sb_count; ++i, sb_state_ptr += sb_state_size) {
     if (*sb_state_ptr) {
-      const uint32_t block_count_lg2 = (*sb_state_ptr) >> state_shift;
-      const uint32_t block_size_lg2  = sb_size_lg2 - block_count_lg2;
-      const uint32_t block_count     = 1u << block_count_lg2;
-      const uint32_t block_used      = (*sb_state_ptr) & state_used_mask;
+      const uint32_t size_class = state_base - ((*sb_state_ptr) >> state_shift);
+      const uint32_t block_size = memory_pool_block_size(
+          size_class, min_block_size_lg2, size_class_lg2);
+      const uint32_t block_count = uint32_t((1LU << sb_size_lg2) / block_size);
+      const uint32_t block_used  = (*sb_state_ptr) & state_used_mask;
 
       s << "Superblock[ " << i << " / " << sb_count << " ] {"
-        << " block_size(" << (1 << block_size_lg2) << ")"
+        << " block_size(" << block_size << ")"
         << " block_count( " << block_used << " / " << block_count << " )"
         << std::endl;
     }
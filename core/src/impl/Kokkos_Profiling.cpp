@@ -26,6 +26,7 @@
 #include <impl/Kokkos_Profiling.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #include <impl/Kokkos_Command_Line_Parsing.hpp>
+#include <impl/Kokkos_Tools_Timer.hpp>
 
 #if defined(KOKKOS_ENABLE_LIBDL) || defined(KOKKOS_TOOLS_INDEPENDENT_BUILD)
 #include <dlfcn.h>
@@ -69,6 +70,17 @@ void warn_env_var_ignored_when_kokkos_tools_disabled(char const* env_var,
   (void)val;
 #endif
 }
+void warn_timer_ignored_when_disabled(char const* setting) {
+#ifndef KOKKOS_ENABLE_TOOLS_TIMER
+  if (Kokkos::show_warnings()) {
+    std::cerr << "Warning: '" << setting
+              << "' ignored because the kernel timer is disabled."
+              << " Raised by Kokkos::initialize()." << std::endl;
+  }
+#else
+  (void)setting;
+#endif
+}
 }  // namespace
 
 namespace Kokkos {
@@ -85,9 +97,10 @@ void parse_command_line_arguments(int& argc, char* argv[],
   using Kokkos::Impl::check_arg;
   using Kokkos::Impl::check_arg_str;
 
-  auto& libs = arguments.lib;
-  auto& args = arguments.args;
-  auto& help = arguments.help;
+  auto& libs  = arguments.lib;
+  auto& args  = arguments.args;
+  auto& help  = arguments.help;
+  auto& timer = arguments.timer;
   while (iarg < argc) {
     bool remove_flag = false;
     if (check_arg_str(argv[iarg], "--kokkos-tools-libs", libs) ||
@@ -120,6 +133,9 @@ void parse_command_line_arguments(int& argc, char* argv[],
       help = InitArguments::PossiblyUnsetOption::on;
       warn_cmd_line_arg_ignored_when_kokkos_tools_disabled(argv[iarg]);
       remove_flag = true;
+    } else if (check_arg_str(argv[iarg], "--kokkos-tools-timer", timer)) {
+      warn_timer_ignored_when_disabled(argv[iarg]);
+      remove_flag = true;
     } else if (std::regex_match(argv[iarg], std::regex("-?-kokkos-tool.*",
                                                        std::regex::egrep))) {
       std::cerr << "Warning: command line argument '" << argv[iarg]
@@ -174,12 +190,36 @@ Kokkos::Tools::Impl::InitializationStatus parse_environment_variables(
                                                     env_tools_args);
     args = env_tools_args;
   }
+  auto env_tools_timer = std::getenv("KOKKOS_TOOLS_TIMER");
+  if (env_tools_timer != nullptr) {
+    warn_timer_ignored_when_disabled("KOKKOS_TOOLS_TIMER");
+    arguments.timer = env_tools_timer;
+  }
   return {
       Kokkos::Tools::Impl::InitializationStatus::InitializationResult::success,
       ""};
 }
 InitializationStatus initialize_tools_subsystem(
     const Kokkos::Tools::InitArguments& args) {
+#ifdef KOKKOS_ENABLE_TOOLS_TIMER
+  // The built-in timer installs its callbacks before the library would be
+  // loaded so that Profiling::initialize() requests its tool settings.
+  if (args.timer != Kokkos::Tools::InitArguments::unset_string_option &&
+      !args.timer.empty() && args.timer != "off") {
+    if (args.lib != Kokkos::Tools::InitArguments::unset_string_option &&
+        !args.lib.empty()) {
+      if (Kokkos::show_warnings()) {
+        std::cerr << "Warning: kernel timer '" << args.timer
+                  << "' ignored because a tools library is loaded."
+                  << " Raised by Kokkos::initialize()." << std::endl;
+      }
+    } else if (!initialize_tools_timer(args.timer)) {
+      return {InitializationStatus::InitializationResult::failure,
+              "Error: unknown kernel timer mode '" + args.timer +
+                  "', expected 'summary', 'chrome' or 'chrome:<file>'."};
+    }
+  }
+#endif
 #ifdef KOKKOS_TOOLS_ENABLE_LIBDL
   Kokkos::Profiling::initialize(args.lib);
   auto final_args =
@@ -196,6 +236,10 @@ InitializationStatus initialize_tools_subsystem(
   Kokkos::Tools::parseArgs(final_args);
 #else
   (void)args;
+#ifdef KOKKOS_ENABLE_TOOLS_TIMER
+  // no library can be loaded, but the built-in timer may have been installed
+  Kokkos::Profiling::initialize(args.lib);
+#endif
 #endif
   return {InitializationStatus::InitializationResult::success, ""};
 }
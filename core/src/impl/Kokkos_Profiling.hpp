@@ -51,6 +51,7 @@ struct InitArguments {
   PossiblyUnsetOption help = unset;
   std::string lib          = unset_string_option;
   std::string args         = unset_string_option;
+  std::string timer        = unset_string_option;
 };
 
 namespace Impl {
@@ -161,7 +161,8 @@ SharedAllocationRecord<void, void>::SharedAllocationRecord(
       ,
       m_root(arg_root),
       m_prev(nullptr),
-      m_next(nullptr)
+      m_next(nullptr),
+      m_borrow_count(0)
 #endif
       ,
       m_count(0),
@@ -221,6 +222,14 @@ SharedAllocationRecord<void, void>* SharedAllocationRecord<
     }
 
 #ifdef KOKKOS_ENABLE_DEBUG
+    if (arg_record->borrow_count() != 0) {
+      std::stringstream ss;
+      ss << "Kokkos allocation \"" << arg_record->get_label()
+         << "\" is being deallocated while " << arg_record->borrow_count()
+         << " borrowed handle(s) to it are alive\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+
     // before:  arg_record->m_prev->m_next == arg_record  &&
     //          arg_record->m_next->m_prev == arg_record
     //
@@ -278,6 +287,19 @@ SharedAllocationRecord<void, void>* SharedAllocationRecord<
 }
 
 #ifdef KOKKOS_ENABLE_DEBUG
+void SharedAllocationRecord<void, void>::increment_borrow(
+    SharedAllocationRecord<void, void>* arg_record) {
+  Kokkos::atomic_inc(&arg_record->m_borrow_count);
+}
+
+void SharedAllocationRecord<void, void>::decrement_borrow(
+    SharedAllocationRecord<void, void>* arg_record) {
+  if (Kokkos::atomic_fetch_sub(&arg_record->m_borrow_count, 1) < 1) {
+    Kokkos::abort(
+        "Kokkos::Impl::SharedAllocationRecord failed borrow decrement");
+  }
+}
+
 void SharedAllocationRecord<void, void>::print_host_accessible_records(
     std::ostream& s, const char* const space_name,
     const SharedAllocationRecord* const root, const bool detail) {
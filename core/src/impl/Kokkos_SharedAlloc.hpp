@@ -97,6 +97,7 @@ class SharedAllocationRecord<void, void> {
   SharedAllocationRecord* const m_root;
   SharedAllocationRecord* m_prev;
   SharedAllocationRecord* m_next;
+  int m_borrow_count;
 #endif
   int m_count;
   std::string m_label;
@@ -153,6 +154,7 @@ class SharedAllocationRecord<void, void> {
         m_root(this),
         m_prev(this),
         m_next(this),
+        m_borrow_count(0),
 #endif
         m_count(0) {
   }
@@ -180,6 +182,16 @@ class SharedAllocationRecord<void, void> {
    * m_dealloc */
   static SharedAllocationRecord* decrement(SharedAllocationRecord*);
 
+#ifdef KOKKOS_ENABLE_DEBUG
+  /* Number of live handles borrowed through ScopedViewBorrow */
+  int borrow_count() const {
+    return *static_cast<const volatile int*>(&m_borrow_count);
+  }
+
+  static void increment_borrow(SharedAllocationRecord*);
+  static void decrement_borrow(SharedAllocationRecord*);
+#endif
+
   /* Given a root record and data pointer find the record */
   static SharedAllocationRecord* find(SharedAllocationRecord* const,
                                       void* const);
@@ -520,7 +532,10 @@ union SharedAllocationTracker {
  private:
   using Record = SharedAllocationRecord<void, void>;
 
-  enum : uintptr_t { DO_NOT_DEREF_FLAG = 0x01ul };
+  // BORROWED_FLAG is only set in debug builds, on handles created by
+  // assign_borrowed and their copies; it always comes with DO_NOT_DEREF_FLAG.
+  enum : uintptr_t { DO_NOT_DEREF_FLAG = 0x01ul, BORROWED_FLAG = 0x02ul };
+  static constexpr uintptr_t RECORD_MASK = ~(DO_NOT_DEREF_FLAG | BORROWED_FLAG);
 
   // The allocation record resides in Host memory space
   uintptr_t m_record_bits;
@@ -537,6 +552,25 @@ union SharedAllocationTracker {
 #define KOKKOS_IMPL_BRANCH_PROB
 #endif
 
+#ifdef KOKKOS_ENABLE_DEBUG
+#define KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_INCREMENT                     \
+  KOKKOS_IF_ON_HOST(                                                        \
+      (if (!(m_record_bits & DO_NOT_DEREF_FLAG))                            \
+           KOKKOS_IMPL_BRANCH_PROB { Record::increment(m_record); }         \
+       else if (m_record_bits & BORROWED_FLAG) {                            \
+         Record::increment_borrow(                                          \
+             reinterpret_cast<Record*>(m_record_bits & RECORD_MASK));       \
+       }))
+
+#define KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_DECREMENT                     \
+  KOKKOS_IF_ON_HOST(                                                        \
+      (if (!(m_record_bits & DO_NOT_DEREF_FLAG))                            \
+           KOKKOS_IMPL_BRANCH_PROB { Record::decrement(m_record); }         \
+       else if (m_record_bits & BORROWED_FLAG) {                            \
+         Record::decrement_borrow(                                          \
+             reinterpret_cast<Record*>(m_record_bits & RECORD_MASK));       \
+       }))
+#else
 #define KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_INCREMENT \
   KOKKOS_IF_ON_HOST(                                    \
       (if (!(m_record_bits & DO_NOT_DEREF_FLAG))        \
@@ -546,6 +580,7 @@ union SharedAllocationTracker {
   KOKKOS_IF_ON_HOST(                                    \
       (if (!(m_record_bits & DO_NOT_DEREF_FLAG))        \
            KOKKOS_IMPL_BRANCH_PROB { Record::decrement(m_record); }))
+#endif
 
 #define KOKKOS_IMPL_SHARED_ALLOCATION_CARRY_RECORD_BITS(rhs,               \
                                                         override_tracking) \
@@ -577,21 +612,21 @@ union SharedAllocationTracker {
     return (m_record_bits == DO_NOT_DEREF_FLAG)
                ? std::string()
                : reinterpret_cast<SharedAllocationRecord<MemorySpace, void>*>(
-                     m_record_bits & ~DO_NOT_DEREF_FLAG)
+                     m_record_bits & RECORD_MASK)
                      ->get_label();
   }
 
   KOKKOS_INLINE_FUNCTION
   int use_count() const {
     KOKKOS_IF_ON_HOST((Record* const tmp = reinterpret_cast<Record*>(
-                           m_record_bits & ~DO_NOT_DEREF_FLAG);
+                           m_record_bits & RECORD_MASK);
                        return (tmp ? tmp->use_count() : 0);))
 
     KOKKOS_IF_ON_DEVICE((return 0;))
   }
 
   KOKKOS_INLINE_FUNCTION bool has_record() const {
-    return (m_record_bits & (~DO_NOT_DEREF_FLAG)) != 0;
+    return (m_record_bits & RECORD_MASK) != 0;
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
@@ -675,6 +710,28 @@ union SharedAllocationTracker {
   void assign_force_disable(const SharedAllocationTracker& rhs) {
     KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_DECREMENT
     m_record_bits = rhs.m_record_bits | DO_NOT_DEREF_FLAG;
+#ifdef KOKKOS_ENABLE_DEBUG
+    // only counts copies of a borrowed handle
+    KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_INCREMENT
+#endif
+  }
+
+  /** \brief  Copy assignment that never counts the reference.
+   *
+   *  The caller guarantees that the allocation outlives this handle and all
+   *  its copies, see Kokkos::Experimental::ScopedViewBorrow.  In debug builds
+   *  the borrowed handles are counted separately so that the guarantee can
+   *  be checked.
+   */
+  void assign_borrowed(const SharedAllocationTracker& rhs) {
+    KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_DECREMENT
+    m_record_bits = rhs.m_record_bits | DO_NOT_DEREF_FLAG;
+#ifdef KOKKOS_ENABLE_DEBUG
+    if (!(rhs.m_record_bits & DO_NOT_DEREF_FLAG)) {
+      m_record_bits |= BORROWED_FLAG;
+    }
+    KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_INCREMENT
+#endif
   }
 
   // report if record is tracking or not
@@ -0,0 +1,411 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_BitManipulation.hpp>
+#include <impl/Kokkos_Tools_Timer.hpp>
+#include <impl/Kokkos_Profiling.hpp>
+#include <impl/Kokkos_Profiling_Interface.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+namespace {
+
+using timer_clock = std::chrono::steady_clock;
+
+enum KernelKind : int { kernel_for = 0, kernel_reduce, kernel_scan };
+
+constexpr std::array<char const*, 3> kernel_kind_names = {
+    "for", "reduce", "scan"};
+
+// Bucket b holds durations whose bit width is b, i.e. [2^(b-1), 2^b) ns.
+// The last bucket collects everything from about 4.5 minutes on.
+constexpr int num_histogram_buckets = 40;
+
+struct KernelStats {
+  std::string label;
+  KernelKind kind   = kernel_for;
+  uint64_t count    = 0;
+  uint64_t total_ns = 0;
+  uint64_t min_ns   = UINT64_MAX;
+  uint64_t max_ns   = 0;
+  std::array<uint64_t, num_histogram_buckets> histogram = {};
+
+  void record(uint64_t ns) {
+    ++count;
+    total_ns += ns;
+    min_ns = std::min(min_ns, ns);
+    max_ns = std::max(max_ns, ns);
+    ++histogram[std::min<int>(Kokkos::Experimental::bit_width_builtin(ns),
+                              num_histogram_buckets - 1)];
+  }
+
+  void merge(KernelStats const& other) {
+    count += other.count;
+    total_ns += other.total_ns;
+    min_ns = std::min(min_ns, other.min_ns);
+    max_ns = std::max(max_ns, other.max_ns);
+    for (int b = 0; b < num_histogram_buckets; ++b) {
+      histogram[b] += other.histogram[b];
+    }
+  }
+
+  // Upper bound of the histogram bucket holding the requested quantile.
+  uint64_t quantile_ns(double q) const {
+    auto const target = static_cast<uint64_t>(q * count);
+    uint64_t seen     = 0;
+    for (int b = 0; b < num_histogram_buckets; ++b) {
+      seen += histogram[b];
+      if (seen > target) return std::min(uint64_t(1) << b, max_ns);
+    }
+    return max_ns;
+  }
+};
+
+struct TraceEvent {
+  uint32_t stats;
+  uint64_t begin_ns;
+  uint64_t end_ns;
+};
+
+// A thread appends its trace events to the file once it buffered this many,
+// so that the memory used by long runs stays bounded.
+constexpr std::size_t trace_chunk_events = 16384;
+
+// Everything a thread records lives in its own ThreadTimer.  The kernel
+// callbacks only touch the timer of the calling thread, so recording takes
+// no lock; the buffers of all threads are merged once at finalize.
+struct ThreadTimer {
+  struct OpenKernel {
+    uint32_t stats;
+    timer_clock::time_point start;
+  };
+
+  int id = 0;
+  // deque keeps the labels at fixed addresses for the string_view keys
+  std::deque<KernelStats> stats;
+  std::array<std::unordered_map<std::string_view, uint32_t>, 3> index;
+  std::vector<OpenKernel> open;
+  std::vector<TraceEvent> events;
+
+  uint32_t lookup(KernelKind kind, char const* label) {
+    auto& map = index[kind];
+    if (auto it = map.find(std::string_view(label)); it != map.end()) {
+      return it->second;
+    }
+    auto& entry = stats.emplace_back();
+    entry.label = label;
+    entry.kind  = kind;
+    auto const i = static_cast<uint32_t>(stats.size() - 1);
+    map.emplace(std::string_view(entry.label), i);
+    return i;
+  }
+
+  void clear() {
+    stats.clear();
+    for (auto& map : index) map.clear();
+    open.clear();
+    events.clear();
+  }
+};
+
+struct TimerState {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadTimer>> threads;
+  timer_clock::time_point origin;
+  bool trace = false;
+  std::string trace_file;
+  std::ofstream trace_out;
+  char const* trace_separator = "\n";
+};
+
+TimerState& timer_state() {
+  static TimerState state;
+  return state;
+}
+
+ThreadTimer& this_thread_timer() {
+  thread_local ThreadTimer* timer = nullptr;
+  if (timer == nullptr) {
+    auto& state = timer_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.threads.push_back(std::make_unique<ThreadTimer>());
+    timer     = state.threads.back().get();
+    timer->id = static_cast<int>(state.threads.size() - 1);
+  }
+  return *timer;
+}
+
+uint64_t nanoseconds_between(timer_clock::time_point begin,
+                             timer_clock::time_point end) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+      .count();
+}
+
+int process_id() {
+#ifdef _WIN32
+  return _getpid();
+#else
+  return getpid();
+#endif
+}
+
+void write_json_string(std::ostream& out, std::string const& str) {
+  out << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+          << static_cast<int>(c) << std::dec << std::setfill(' ');
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+bool open_trace(TimerState& state) {
+  state.trace_out.open(state.trace_file);
+  if (!state.trace_out) {
+    std::cerr << "Kokkos::Tools: unable to open kernel timer trace file '"
+              << state.trace_file << "'" << std::endl;
+    return false;
+  }
+  state.trace_out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  state.trace_separator = "\n";
+  return true;
+}
+
+// Appends the buffered events of a thread to the trace file and empties the
+// buffer.  The caller holds the state mutex.
+void write_trace_events(TimerState& state, ThreadTimer& timer) {
+  auto& out      = state.trace_out;
+  auto const pid = process_id();
+  for (auto const& event : timer.events) {
+    auto const& stats = timer.stats[event.stats];
+    out << state.trace_separator << "{\"name\":";
+    write_json_string(out, stats.label);
+    out << ",\"cat\":\"parallel_" << kernel_kind_names[stats.kind]
+        << "\",\"ph\":\"X\",\"ts\":" << event.begin_ns * 1e-3
+        << ",\"dur\":" << (event.end_ns - event.begin_ns) * 1e-3
+        << ",\"pid\":" << pid << ",\"tid\":" << timer.id << "}";
+    state.trace_separator = ",\n";
+  }
+  timer.events.clear();
+}
+
+void close_trace(TimerState& state) {
+  for (auto& timer : state.threads) write_trace_events(state, *timer);
+  state.trace_out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  state.trace_out.close();
+}
+
+void begin_kernel(KernelKind kind, char const* label, uint64_t* kernel_id) {
+  auto& timer = this_thread_timer();
+  auto stats  = timer.lookup(kind, label);
+  *kernel_id  = timer.open.size();
+  timer.open.push_back({stats, timer_clock::now()});
+}
+
+void end_kernel(uint64_t kernel_id) {
+  auto const end = timer_clock::now();
+  auto& timer    = this_thread_timer();
+  if (kernel_id >= timer.open.size()) return;
+
+  auto const kernel = timer.open[kernel_id];
+  timer.open.resize(kernel_id);
+  timer.stats[kernel.stats].record(nanoseconds_between(kernel.start, end));
+
+  auto& state = timer_state();
+  if (state.trace) {
+    timer.events.push_back({kernel.stats,
+                            nanoseconds_between(state.origin, kernel.start),
+                            nanoseconds_between(state.origin, end)});
+    if (timer.events.size() >= trace_chunk_events) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      write_trace_events(state, timer);
+    }
+  }
+}
+
+void begin_parallel_for(char const* label, uint32_t, uint64_t* kernel_id) {
+  begin_kernel(kernel_for, label, kernel_id);
+}
+void begin_parallel_reduce(char const* label, uint32_t, uint64_t* kernel_id) {
+  begin_kernel(kernel_reduce, label, kernel_id);
+}
+void begin_parallel_scan(char const* label, uint32_t, uint64_t* kernel_id) {
+  begin_kernel(kernel_scan, label, kernel_id);
+}
+
+void request_tool_settings(
+    uint32_t, Kokkos::Tools::Experimental::ToolSettings* settings) {
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) ||         \
+    defined(KOKKOS_ENABLE_SYCL) || defined(KOKKOS_ENABLE_OPENMPTARGET) || \
+    defined(KOKKOS_ENABLE_OPENACC) || defined(KOKKOS_ENABLE_HPX)
+  // Asynchronous backends need the fence around every kernel, otherwise only
+  // the launch would be timed.
+  (void)settings;
+#else
+  // Host dispatches only return once the kernel has completed.
+  settings->requires_global_fencing = false;
+#endif
+}
+
+void print_summary(std::vector<KernelStats const*> const& kernels,
+                   double elapsed_s) {
+  uint64_t kernel_ns = 0;
+  uint64_t launches  = 0;
+  for (auto const* k : kernels) {
+    kernel_ns += k->total_ns;
+    launches += k->count;
+  }
+
+  auto& out             = std::cout;
+  auto const flags      = out.flags();
+  auto const precision  = out.precision();
+  auto const percent_of = kernel_ns > 0 ? 100. / kernel_ns : 0.;
+
+  out << "Kokkos kernel timer: " << kernels.size() << " kernels, " << launches
+      << " launches, " << std::fixed << std::setprecision(6)
+      << kernel_ns * 1e-9 << " s in kernels, " << elapsed_s
+      << " s since initialize\n";
+  out << std::setw(12) << "Total(s)" << std::setw(8) << "%" << std::setw(10)
+      << "Count" << std::setw(12) << "Avg(us)" << std::setw(12) << "Min(us)"
+      << std::setw(12) << "Max(us)" << std::setw(12) << "p50(us)"
+      << std::setw(12) << "p99(us)" << "  " << std::setw(8) << std::left
+      << "Type" << "Label\n"
+      << std::right;
+  for (auto const* k : kernels) {
+    out << std::setprecision(6) << std::setw(12) << k->total_ns * 1e-9
+        << std::setprecision(2) << std::setw(8) << k->total_ns * percent_of
+        << std::setw(10) << k->count << std::setprecision(3) << std::setw(12)
+        << k->total_ns * 1e-3 / k->count << std::setw(12) << k->min_ns * 1e-3
+        << std::setw(12) << k->max_ns * 1e-3 << std::setw(12)
+        << k->quantile_ns(0.5) * 1e-3 << std::setw(12)
+        << k->quantile_ns(0.99) * 1e-3 << "  " << std::setw(8) << std::left
+        << kernel_kind_names[k->kind] << k->label << '\n'
+        << std::right;
+  }
+  out << std::flush;
+  out.flags(flags);
+  out.precision(precision);
+}
+
+void finalize() {
+  auto& state = timer_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  double const elapsed_s =
+      nanoseconds_between(state.origin, timer_clock::now()) * 1e-9;
+
+  std::map<std::pair<int, std::string_view>, KernelStats> merged;
+  for (auto const& timer : state.threads) {
+    for (auto const& stats : timer->stats) {
+      auto [it, inserted] =
+          merged.try_emplace({stats.kind, std::string_view(stats.label)});
+      if (inserted) {
+        it->second.label = stats.label;
+        it->second.kind  = stats.kind;
+      }
+      it->second.merge(stats);
+    }
+  }
+
+  std::vector<KernelStats const*> kernels;
+  kernels.reserve(merged.size());
+  for (auto const& entry : merged) {
+    if (entry.second.count > 0) kernels.push_back(&entry.second);
+  }
+  std::stable_sort(kernels.begin(), kernels.end(),
+                   [](KernelStats const* a, KernelStats const* b) {
+                     return a->total_ns > b->total_ns;
+                   });
+
+  print_summary(kernels, elapsed_s);
+  if (state.trace) close_trace(state);
+
+  for (auto& timer : state.threads) timer->clear();
+}
+
+}  // namespace
+
+bool initialize_tools_timer(std::string const& mode) {
+  auto& state = timer_state();
+
+  std::string_view const chrome = "chrome";
+  if (mode == "summary") {
+    state.trace = false;
+  } else if (mode.compare(0, chrome.size(), chrome) == 0 &&
+             (mode.size() == chrome.size() || mode[chrome.size()] == ':')) {
+    state.trace = true;
+    if (mode.size() > chrome.size() + 1) {
+      state.trace_file = mode.substr(chrome.size() + 1);
+    } else {
+      state.trace_file =
+          "kokkos_timer_" + std::to_string(process_id()) + ".json";
+    }
+    // Keep the summary if the trace file cannot be written.
+    state.trace = open_trace(state);
+  } else {
+    return false;
+  }
+  state.origin = timer_clock::now();
+
+  using namespace Kokkos::Tools::Experimental;
+  set_begin_parallel_for_callback(begin_parallel_for);
+  set_begin_parallel_reduce_callback(begin_parallel_reduce);
+  set_begin_parallel_scan_callback(begin_parallel_scan);
+  set_end_parallel_for_callback(end_kernel);
+  set_end_parallel_reduce_callback(end_kernel);
+  set_end_parallel_scan_callback(end_kernel);
+  set_request_tool_settings_callback(request_tool_settings);
+  set_finalize_callback(finalize);
+  return true;
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
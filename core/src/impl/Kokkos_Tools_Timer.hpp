@@ -0,0 +1,46 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_TOOLS_TIMER_HPP
+#define KOKKOS_IMPL_TOOLS_TIMER_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+/** \brief  Install the callbacks of the built-in kernel timer.
+ *
+ *  The timer records, per kernel label, the number of launches, the total,
+ *  minimum and maximum duration and a log2 histogram of the durations.
+ *  Records are kept in per-thread buffers that are only merged at finalize.
+ *
+ *  \c mode is either "summary", which prints a table sorted by total time to
+ *  std::cout, or "chrome" / "chrome:<file>", which in addition writes every
+ *  launch to a Chrome trace file (default kokkos_timer_<pid>.json).
+ *
+ *  Returns false, without installing anything, if \c mode is not recognized.
+ */
+bool initialize_tools_timer(std::string const& mode);
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif
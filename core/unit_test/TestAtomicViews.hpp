@@ -16,6 +16,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <vector>
+
 namespace {
 
 //-------------------------------------------------
@@ -1252,6 +1254,71 @@ void XOrEqualAtomicViewTest(int64_t input_length) {
       << ">(length=" << input_length << ")";
 }
 
+//---------------------------------------------------
+//-----------atomic combining view-------------------
+//---------------------------------------------------
+
+template <class T, class execution_space>
+struct CombiningAtomicViewFunctor {
+  using combining_view_type =
+      Kokkos::View<T*, execution_space,
+                   Kokkos::MemoryTraits<Kokkos::AtomicCombining> >;
+
+  combining_view_type sums;
+  combining_view_type counts;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i) const {
+    const int64_t bin = i % static_cast<int64_t>(sums.extent(0));
+    (sums(bin) += T(i % 7)) -= T(1);
+    counts(bin).inc();
+  }
+};
+
+template <class T, class DeviceType>
+void CombiningAtomicViewTest(int64_t input_length, int64_t num_bins) {
+  using view_type = Kokkos::View<T*, DeviceType>;
+
+  view_type sums("sums", num_bins);
+  view_type counts("counts", num_bins);
+
+  using functor_type = CombiningAtomicViewFunctor<T, DeviceType>;
+  using policy_type  = Kokkos::RangePolicy<DeviceType>;
+
+  // Run the kernel twice to check that the per-thread buffers were flushed
+  // and emptied at the end of the first one.
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    Kokkos::parallel_for(policy_type(0, input_length),
+                         functor_type{sums, counts});
+  }
+  // A launch that bypasses parallel_for, as graph nodes do, is flushed by
+  // the instance fence.
+  typename DeviceType::execution_space exec;
+  Kokkos::Impl::ParallelFor<functor_type, policy_type> closure(
+      functor_type{sums, counts}, policy_type(exec, 0, input_length));
+  closure.execute();
+  exec.fence();
+
+  auto h_sums = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sums);
+  auto h_counts =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+
+  std::vector<T> expected_sums(num_bins, T(0));
+  std::vector<T> expected_counts(num_bins, T(0));
+  for (int64_t i = 0; i < input_length; ++i) {
+    expected_sums[i % num_bins] += 3 * (T(i % 7) - T(1));
+    expected_counts[i % num_bins] += 3;
+  }
+  for (int64_t bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(h_sums(bin), expected_sums[bin])
+        << "CombiningAtomicViewTest<" << Kokkos::Impl::TypeInfo<T>::name()
+        << ">(length=" << input_length << ", bins=" << num_bins << ")";
+    ASSERT_EQ(h_counts(bin), expected_counts[bin])
+        << "CombiningAtomicViewTest<" << Kokkos::Impl::TypeInfo<T>::name()
+        << ">(length=" << input_length << ", bins=" << num_bins << ")";
+  }
+}
+
 // inc/dec?
 
 TEST(TEST_CATEGORY, atomic_views_integral) {
@@ -1274,6 +1341,15 @@ TEST(TEST_CATEGORY, atomic_views_nonintegral) {
   DivEqualAtomicViewTest<double, TEST_EXECSPACE>(length);
 }
 
+TEST(TEST_CATEGORY, atomic_views_combining) {
+  const int64_t length = 100000;
+  // Fewer bins than buffer entries, and more to exercise evictions.
+  CombiningAtomicViewTest<int64_t, TEST_EXECSPACE>(length, 16);
+  CombiningAtomicViewTest<int64_t, TEST_EXECSPACE>(length, 1000);
+  CombiningAtomicViewTest<double, TEST_EXECSPACE>(length, 16);
+  CombiningAtomicViewTest<double, TEST_EXECSPACE>(length, 1000);
+}
+
 TEST(TEST_CATEGORY, atomic_view_api) {
   TestAtomicViewAPI<int, TEST_EXECSPACE>();
 }
@@ -171,6 +171,93 @@ void test_constructor(std::int32_t nrows) {
   }
 }
 
+// Rows with a skewed number of entries and repeated columns, as in graphs
+// with a few dense rows.
+std::vector<std::vector<std::int32_t>> make_skewed_rows(std::int32_t nrows) {
+  std::vector<std::vector<std::int32_t>> rows(nrows);
+  std::uint32_t state = 12345;
+  for (std::int32_t i = 0; i < nrows; ++i) {
+    const std::int32_t n = (i % 97 == 0) ? nrows : (i % 7);
+    for (std::int32_t j = 0; j < n; ++j) {
+      state = state * 1664525u + 1013904223u;
+      rows[i].push_back((state >> 8) % nrows);
+    }
+  }
+  return rows;
+}
+
+template <class ExecSpace>
+void test_transpose(std::int32_t nrows) {
+  using crs_type  = Kokkos::Crs<std::int32_t, ExecSpace, void, std::int32_t>;
+  using host_type = typename crs_type::HostMirror;
+
+  const auto rows = make_skewed_rows(nrows);
+  std::vector<std::vector<std::int32_t>> expected(nrows);
+  for (std::int32_t i = 0; i < nrows; ++i)
+    for (auto c : rows[i]) expected[c].push_back(i);
+
+  host_type h_in;
+  h_in.row_map = typename host_type::row_map_type("row_map", nrows + 1);
+  for (std::int32_t i = 0; i < nrows; ++i)
+    h_in.row_map(i + 1) = h_in.row_map(i) + rows[i].size();
+  h_in.entries =
+      typename host_type::entries_type("entries", h_in.row_map(nrows));
+  for (std::int32_t i = 0; i < nrows; ++i)
+    for (size_t j = 0; j < rows[i].size(); ++j)
+      h_in.entries(h_in.row_map(i) + j) = rows[i][j];
+  crs_type in(Kokkos::create_mirror_view_and_copy(ExecSpace(), h_in.row_map),
+              Kokkos::create_mirror_view_and_copy(ExecSpace(), h_in.entries));
+  crs_type out;
+  Kokkos::transpose_crs(out, in);
+
+  host_type h_out(
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out.row_map),
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out.entries));
+  ASSERT_EQ(h_out.numRows(), nrows);
+  for (std::int32_t c = 0; c < nrows; ++c) {
+    ASSERT_EQ(h_out.row_map(c + 1) - h_out.row_map(c),
+              std::int32_t(expected[c].size()));
+    for (size_t j = 0; j < expected[c].size(); ++j)
+      ASSERT_EQ(h_out.entries(h_out.row_map(c) + j), expected[c][j]);
+  }
+}
+
+template <class ExecSpace>
+void test_create_from_coo(std::int32_t nrows) {
+  using crs_type = Kokkos::Crs<std::int32_t, ExecSpace, void, std::int32_t>;
+  using coo_type = Kokkos::View<std::int32_t*, ExecSpace>;
+
+  // Every row gets its columns in the order they appear in the input.
+  const auto cols = make_skewed_rows(nrows);
+  std::vector<std::int32_t> coo_rows, coo_cols;
+  std::vector<std::vector<std::int32_t>> expected(nrows);
+  for (std::int32_t i = 0; i < nrows; ++i)
+    for (auto c : cols[i]) {
+      coo_rows.push_back(c);
+      coo_cols.push_back(i);
+      expected[c].push_back(i);
+    }
+  const auto n = coo_rows.size();
+  coo_type d_rows("rows", n), d_cols("cols", n);
+  Kokkos::deep_copy(d_rows, Kokkos::View<std::int32_t*, Kokkos::HostSpace>(
+                                coo_rows.data(), n));
+  Kokkos::deep_copy(d_cols, Kokkos::View<std::int32_t*, Kokkos::HostSpace>(
+                                coo_cols.data(), n));
+
+  crs_type out;
+  Kokkos::create_crs_from_coo(out, nrows, d_rows, d_cols);
+  auto row_map =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out.entries);
+  ASSERT_EQ(row_map.extent(0), size_t(nrows) + 1);
+  for (std::int32_t r = 0; r < nrows; ++r) {
+    ASSERT_EQ(row_map(r + 1) - row_map(r), std::int32_t(expected[r].size()));
+    for (size_t j = 0; j < expected[r].size(); ++j)
+      ASSERT_EQ(entries(row_map(r) + j), expected[r][j]);
+  }
+}
+
 }  // anonymous namespace
 
 TEST(TEST_CATEGORY, crs_count_fill) {
@@ -195,4 +282,18 @@ TEST(TEST_CATEGORY, crs_copy_constructor) {
   test_constructor<TEST_EXECSPACE>(10000);
 }
 
+TEST(TEST_CATEGORY, crs_transpose) {
+  test_transpose<TEST_EXECSPACE>(1);
+  test_transpose<TEST_EXECSPACE>(13);
+  test_transpose<TEST_EXECSPACE>(1000);
+  test_transpose<TEST_EXECSPACE>(5000);
+}
+
+TEST(TEST_CATEGORY, crs_create_from_coo) {
+  test_create_from_coo<TEST_EXECSPACE>(1);
+  test_create_from_coo<TEST_EXECSPACE>(13);
+  test_create_from_coo<TEST_EXECSPACE>(1000);
+  test_create_from_coo<TEST_EXECSPACE>(5000);
+}
+
 }  // namespace Test
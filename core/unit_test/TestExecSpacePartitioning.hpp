@@ -142,4 +142,39 @@ TEST(TEST_CATEGORY, partitioning_by_vector) {
   ASSERT_EQ(int(instances.size()), 2);
   test_partitioning(instances);
 }
+
+#ifdef KOKKOS_ENABLE_OPENMP
+// A template so that the OpenMP only branch is discarded for other spaces
+template <class ExecSpace>
+void test_partitioning_by_numa() {
+  if constexpr (std::is_same_v<ExecSpace, Kokkos::OpenMP>) {
+    ExecSpace space;
+    auto instances = Kokkos::Experimental::partition_space_by_numa(space);
+    ASSERT_GE(int(instances.size()), 1);
+
+    // The partitions share the threads of the main instance
+    int pool_size = 0;
+    for (auto const& instance : instances) {
+      ASSERT_GE(instance.impl_thread_pool_size(), 1);
+      pool_size += instance.impl_thread_pool_size();
+    }
+    ASSERT_EQ(pool_size, space.impl_thread_pool_size());
+
+    for (auto const& instance : instances) {
+      int sum = 0;
+      int N   = 3910;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<ExecSpace>(instance, 0, N), SumFunctor(), sum);
+      ASSERT_EQ(sum, N * (N - 1) / 2);
+    }
+    if (instances.size() > 1) test_partitioning(instances);
+  } else {
+    GTEST_SKIP() << "topology partitioning is only implemented for OpenMP";
+  }
+}
+
+TEST(TEST_CATEGORY, partitioning_by_numa) {
+  test_partitioning_by_numa<TEST_EXECSPACE>();
+}
+#endif
 }  // namespace Test
@@ -226,6 +226,180 @@ TEST_F(TEST_CATEGORY_FIXTURE(graph),
   ASSERT_TRUE(contains(execution_space_instances.at(1), bugs, 0));
 }
 
+// An element-wise chain of kernels gives the same result with kernel fusion.
+TEST_F(TEST_CATEGORY_FIXTURE(graph), kernel_fusion_chain) {
+  constexpr int n = 10000;
+  Kokkos::View<double*, TEST_EXECSPACE> x(Kokkos::view_alloc("x", ex), n);
+  Kokkos::View<double*, TEST_EXECSPACE> y(Kokkos::view_alloc("y", ex), n);
+  Kokkos::View<double*, TEST_EXECSPACE> z(Kokkos::view_alloc("z", ex), n);
+
+  auto graph = Kokkos::Experimental::create_graph(ex, [&](auto root) {
+    auto init = root.then_parallel_for(
+        "init", n, KOKKOS_LAMBDA(int i) { x(i) = i; });
+    auto axpy = init.then_parallel_for(
+        "axpy", n, KOKKOS_LAMBDA(int i) { y(i) = 2 * x(i) + 1; });
+    auto scale = axpy.then_parallel_for(
+        "scale", n, KOKKOS_LAMBDA(int i) { y(i) *= 0.5; });
+    // Not fused: a different range, and a second successor of scale
+    auto clamp = scale.then_parallel_for(
+        "clamp", Kokkos::RangePolicy<TEST_EXECSPACE>(ex, 0, n / 2),
+        KOKKOS_LAMBDA(int i) { y(i) = Kokkos::min(y(i), 1000.); });
+    auto copy = scale.then_parallel_for(
+        "copy", n, KOKKOS_LAMBDA(int i) { z(i) = y(n / 2 + i / 2); });
+    Kokkos::Experimental::when_all(clamp, copy)
+        .then_parallel_for(1, count_functor{count, bugs, 0, 0});
+  });
+  graph.enable_kernel_fusion();
+
+  for (int submit = 0; submit < 2; ++submit) {
+    Kokkos::deep_copy(ex, count, 0);
+    graph.submit(ex);
+    auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, y);
+    auto z_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, z);
+    for (int i = 0; i < n; ++i) {
+      const double expected = i + 0.5;
+      ASSERT_EQ(y_h(i), i < n / 2 ? Kokkos::min(expected, 1000.) : expected);
+      ASSERT_EQ(z_h(i), n / 2 + i / 2 + 0.5);
+    }
+    ASSERT_TRUE(contains(ex, count, 1));
+    ASSERT_TRUE(contains(ex, bugs, 0));
+  }
+}
+
+// Fused kernels are interleaved chunk by chunk.
+TEST_F(TEST_CATEGORY_FIXTURE(graph), kernel_fusion_interleaves_kernels) {
+  using fused_kernel_t =
+      Kokkos::Impl::GraphNodeFusedKernelDefaultImpl<TEST_EXECSPACE>;
+  if constexpr (!fused_kernel_t::is_supported) {
+    GTEST_SKIP() << "kernel fusion is not supported by this backend";
+  } else {
+    // At least two chunks per thread
+    const int n = 2 * fused_kernel_t::chunk_size * ex.concurrency();
+    Kokkos::View<int*, TEST_EXECSPACE> first(Kokkos::view_alloc("first", ex),
+                                             n);
+    Kokkos::View<int*, TEST_EXECSPACE> second(
+        Kokkos::view_alloc("second", ex), n);
+    Kokkos::View<int, TEST_EXECSPACE> stamp(Kokkos::view_alloc("stamp", ex));
+
+    auto graph = Kokkos::Experimental::create_graph(ex, [&](auto root) {
+      root.then_parallel_for(
+              n,
+              KOKKOS_LAMBDA(int i) {
+                first(i) = Kokkos::atomic_fetch_add(&stamp(), 1);
+              })
+          .then_parallel_for(n, KOKKOS_LAMBDA(int i) {
+            second(i) = Kokkos::atomic_fetch_add(&stamp(), 1);
+          });
+    });
+    graph.enable_kernel_fusion();
+    graph.submit(ex);
+
+    int last_first   = 0;
+    int first_second = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<TEST_EXECSPACE>(ex, 0, n),
+        KOKKOS_LAMBDA(int i, int& max_first, int& min_second) {
+          max_first  = Kokkos::max(max_first, first(i));
+          min_second = Kokkos::min(min_second, second(i));
+        },
+        Kokkos::Max<int>(last_first), Kokkos::Min<int>(first_second));
+    ASSERT_LT(first_second, last_first);
+  }
+}
+
+#ifdef KOKKOS_ENABLE_IMPL_GRAPH_CAPTURE
+// Dispatches on a captured instance are recorded in order and only run when
+// the graph is submitted.
+TEST_F(TEST_CATEGORY_FIXTURE(graph), capture_parallel_dispatches) {
+  using policy_t = Kokkos::RangePolicy<TEST_EXECSPACE>;
+  view_type result(Kokkos::view_alloc("result", ex));
+
+  Kokkos::Experimental::begin_capture(ex);
+  Kokkos::parallel_for("first", policy_t(ex, 0, 1),
+                       count_functor{count, bugs, 0, 0});
+  Kokkos::parallel_for("second", policy_t(ex, 0, 1),
+                       count_functor{count, bugs, 1, 1});
+  Kokkos::parallel_reduce("sum", policy_t(ex, 0, 10),
+                          set_result_functor{count}, result);
+  auto graph = Kokkos::Experimental::end_capture(ex);
+
+  ASSERT_TRUE(contains(ex, count, 0));
+  ASSERT_TRUE(contains(ex, result, 0));
+
+  for (int i = 0; i < 2; ++i) {
+    Kokkos::deep_copy(ex, count, 0);
+    graph.submit(ex);
+    ASSERT_TRUE(contains(ex, count, 2));
+    ASSERT_TRUE(contains(ex, bugs, 0));
+    ASSERT_TRUE(contains(ex, result, 20));
+  }
+
+  // Back to eager execution
+  Kokkos::parallel_for(policy_t(ex, 0, 1), count_functor{count, bugs, 2, 2});
+  ASSERT_TRUE(contains(ex, count, 3));
+  ASSERT_TRUE(contains(ex, bugs, 0));
+}
+
+TEST_F(TEST_CATEGORY_FIXTURE(graph), capture_unsupported_dispatches) {
+  using policy_t = Kokkos::RangePolicy<TEST_EXECSPACE>;
+
+  Kokkos::Experimental::begin_capture(ex);
+  ASSERT_THROW(Kokkos::Experimental::begin_capture(ex), std::runtime_error);
+
+  int scalar = 0;
+  auto reduce_into_scalar = [&]() {
+    Kokkos::parallel_reduce(policy_t(ex, 0, 1), set_result_functor{count},
+                            scalar);
+  };
+  ASSERT_THROW(reduce_into_scalar(), std::runtime_error);
+
+  auto scan = [&]() {
+    Kokkos::parallel_scan(
+        policy_t(ex, 0, 1), KOKKOS_LAMBDA(int, int&, bool){});
+  };
+  ASSERT_THROW(scan(), std::runtime_error);
+
+  auto graph = Kokkos::Experimental::end_capture(ex);
+  ASSERT_THROW(Kokkos::Experimental::end_capture(ex), std::runtime_error);
+
+  graph.submit(ex);
+  ASSERT_TRUE(contains(ex, count, 0));
+}
+
+// The kernels deep_copy launches internally are not captured, so deep_copy
+// runs eagerly whatever the layout of its views.
+TEST_F(TEST_CATEGORY_FIXTURE(graph), capture_deep_copy_runs_eagerly) {
+  using view_2d = Kokkos::View<int**, Kokkos::LayoutRight, TEST_EXECSPACE>;
+  view_2d a(Kokkos::view_alloc("a", ex), 8, 8);
+  view_2d b(Kokkos::view_alloc("b", ex), 8, 8);
+  auto a_left = Kokkos::subview(a, Kokkos::ALL, Kokkos::pair<int, int>(0, 4));
+  auto b_left = Kokkos::subview(b, Kokkos::ALL, Kokkos::pair<int, int>(0, 4));
+  // Large enough for the host copy to be split into parallel blocks
+  Kokkos::View<int*, Kokkos::HostSpace> src("src", 1 << 16);
+  Kokkos::View<int*, Kokkos::HostSpace> dst("dst", 1 << 16);
+  Kokkos::deep_copy(src, 1);
+
+  Kokkos::Experimental::begin_capture(ex);
+  Kokkos::deep_copy(ex, a_left, 1);
+  Kokkos::deep_copy(ex, b_left, a_left);
+  Kokkos::deep_copy(ex, dst, src);
+  auto graph = Kokkos::Experimental::end_capture(ex);
+  ex.fence();
+
+  auto b_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, b);
+  for (int i = 0; i < 8; ++i)
+    for (int j = 0; j < 8; ++j) ASSERT_EQ(b_host(i, j), j < 4 ? 1 : 0);
+  for (int i = 0; i < (1 << 16); ++i) ASSERT_EQ(dst(i), 1);
+
+  // Nothing was recorded
+  Kokkos::deep_copy(ex, b, 0);
+  graph.submit(ex);
+  Kokkos::deep_copy(b_host, b);
+  for (int i = 0; i < 8; ++i)
+    for (int j = 0; j < 8; ++j) ASSERT_EQ(b_host(i, j), 0);
+}
+#endif
+
 // This test ensures that it's possible to build a Kokkos::Graph using
 // Kokkos::Experimental::create_graph without providing a closure, but giving an
 // execution space instance.
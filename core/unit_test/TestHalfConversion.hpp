@@ -88,9 +88,83 @@ void test_bhalf_conversion() {
   test_bhalf_conversion_type<unsigned long long>();
 }
 
-TEST(TEST_CATEGORY, half_conversion) { test_half_conversion(); }
+// deep_copy between float and half Views has to round each element exactly
+// like the scalar conversion, whether it takes the contiguous bulk path or
+// the element-wise one.
+template <class HalfType>
+void test_half_deep_copy() {
+  if (!std::is_same_v<HalfType, float>) {
+    ASSERT_EQ(sizeof(HalfType), 2u);
+  }
+
+  const int n = 10007;
+  Kokkos::View<float*, TEST_EXECSPACE> f("f", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, n), KOKKOS_LAMBDA(int i) {
+        // Spans subnormals, normals, the largest finite values and overflow
+        const float x = 5.96e-8f * (1 << (i % 24)) * (1.f + (i % 1021) / 7.f);
+        f(i)          = i % 2 ? -x : x;
+      });
+
+  Kokkos::View<HalfType*, TEST_EXECSPACE> h("h", n);
+  Kokkos::View<float*, TEST_EXECSPACE> g("g", n);
+  Kokkos::deep_copy(h, f);
+  Kokkos::deep_copy(g, h);
+
+  auto h_f = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f);
+  auto h_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), h);
+  auto h_g = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), g);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(static_cast<float>(h_h(i)),
+              static_cast<float>(static_cast<HalfType>(h_f(i))));
+    ASSERT_EQ(h_g(i), static_cast<float>(h_h(i)));
+  }
+
+  // Different layouts cannot be copied as flat arrays
+  Kokkos::View<float**, Kokkos::LayoutLeft, TEST_EXECSPACE> f2("f2", 37, 29);
+  Kokkos::View<HalfType**, Kokkos::LayoutRight, TEST_EXECSPACE> h2("h2", 37,
+                                                                   29);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, 37), KOKKOS_LAMBDA(int i) {
+        for (int j = 0; j < 29; ++j) f2(i, j) = 0.1f * i - 0.3f * j;
+      });
+  Kokkos::deep_copy(h2, f2);
+  auto h_f2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f2);
+  auto h_h2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), h2);
+  for (int i = 0; i < 37; ++i)
+    for (int j = 0; j < 29; ++j)
+      ASSERT_EQ(static_cast<float>(h_h2(i, j)),
+                static_cast<float>(static_cast<HalfType>(h_f2(i, j))));
+}
+
+// A double just above the midpoint of two half values must round up, even
+// though rounding it to float first lands exactly on the midpoint.
+void test_half_conversion_from_double_rounds_once() {
+#if defined(KOKKOS_HALF_T_IS_FLOAT) && !KOKKOS_HALF_T_IS_FLOAT
+  const double h = 1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -30);
+  ASSERT_EQ(static_cast<double>(Kokkos::Experimental::cast_to_half(h)),
+            1.0 + std::ldexp(1.0, -10));
+  ASSERT_EQ(static_cast<double>(Kokkos::Experimental::cast_to_half(-h)),
+            -1.0 - std::ldexp(1.0, -10));
+#endif
+#if defined(KOKKOS_BHALF_T_IS_FLOAT) && !KOKKOS_BHALF_T_IS_FLOAT
+  const double b = 1.0 + std::ldexp(1.0, -8) + std::ldexp(1.0, -30);
+  ASSERT_EQ(static_cast<double>(Kokkos::Experimental::cast_to_bhalf(b)),
+            1.0 + std::ldexp(1.0, -7));
+#endif
+}
+
+TEST(TEST_CATEGORY, half_conversion) {
+  test_half_conversion();
+  test_half_conversion_from_double_rounds_once();
+}
 
 TEST(TEST_CATEGORY, bhalf_conversion) { test_bhalf_conversion(); }
 
+TEST(TEST_CATEGORY, half_deep_copy) {
+  test_half_deep_copy<Kokkos::Experimental::half_t>();
+  test_half_deep_copy<Kokkos::Experimental::bhalf_t>();
+}
+
 }  // namespace Test
 #endif
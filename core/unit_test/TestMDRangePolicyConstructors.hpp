@@ -175,12 +175,21 @@ TEST(TEST_CATEGORY, policy_get_tile_size) {
     EXPECT_EQ(default_size_properties.max_total_tile_size,
               policy.max_total_tile_size());
 
+    // Host tiles sized from the cache hierarchy do not depend on the tiles
+    // the policy was constructed with.
+    Policy policy_default({0, 0, 0}, {dim_length, dim_length, dim_length});
+    const bool cache_aware = default_size_properties.l1_cache_size > 0 &&
+                             default_size_properties.l2_cache_size > 0;
+
     int prod_rec_tile_size = 1;
     for (std::size_t i = 0; i < rank; ++i) {
       EXPECT_GT(rec_tile_sizes[i], 0)
           << " invalid default tile size for rank " << i;
 
-      if (default_size_properties.default_largest_tile_size == 0) {
+      if (cache_aware) {
+        EXPECT_EQ(policy_default.m_tile[i], rec_tile_sizes[i])
+            << " incorrect recommended tile size returned for rank " << i;
+      } else if (default_size_properties.default_largest_tile_size == 0) {
         auto expected_rec_tile_size =
             (i == last_rank) ? dim_length
                              : default_size_properties.default_tile_size;
@@ -200,4 +209,23 @@ TEST(TEST_CATEGORY, policy_get_tile_size) {
   }
 }
 
+TEST(TEST_CATEGORY, policy_default_tile_size_keeps_user_tiles) {
+  using Policy = Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<3>>;
+
+  Policy policy({0, 0, 0}, {300, 200, 100}, {4, 0, 0});
+  EXPECT_TRUE(policy.impl_tune_tile_size());
+
+  const int inner = (Policy::inner_direction == Kokkos::Iterate::Right) ? 2 : 0;
+  const Kokkos::Array<int, 3> extents = {300, 200, 100};
+
+  EXPECT_EQ(policy.m_tile[0], 4);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_GT(policy.m_tile[i], 0) << " invalid tile size for rank " << i;
+    if (i != inner && i != 0) {
+      EXPECT_LE(policy.m_tile[i], extents[i])
+          << " tile larger than the extent for rank " << i;
+    }
+  }
+}
+
 }  // namespace
@@ -19,6 +19,9 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace TestMemoryPool {
 
 template <typename MemSpace = Kokkos::HostSpace>
@@ -143,6 +146,122 @@ void test_host_memory_pool_stats() {
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+template <typename MemSpace = Kokkos::HostSpace>
+void test_host_memory_pool_size_classes() {
+  using Space   = typename MemSpace::execution_space;
+  using MemPool = typename Kokkos::MemoryPool<Space>;
+
+  // 4 classes per doubling: 64, 80, 96, 112, 128, 160, ... 4096
+  MemPool pool(MemSpace(), 1 << 20, 64, 4096, 1 << 16, 4);
+
+  ASSERT_EQ(pool.allocate_block_size(1), 64u);
+  ASSERT_EQ(pool.allocate_block_size(64), 64u);
+  ASSERT_EQ(pool.allocate_block_size(65), 80u);
+  ASSERT_EQ(pool.allocate_block_size(80), 80u);
+  ASSERT_EQ(pool.allocate_block_size(81), 96u);
+  ASSERT_EQ(pool.allocate_block_size(128), 128u);
+  ASSERT_EQ(pool.allocate_block_size(129), 160u);
+  ASSERT_EQ(pool.allocate_block_size(3073), 3584u);
+  ASSERT_EQ(pool.allocate_block_size(4096), 4096u);
+  ASSERT_EQ(pool.allocate_block_size(4097), 0u);
+
+  // Fill the pool with 80 byte blocks: every block is distinct and lies in
+  // the pool, and all of them go back.
+  std::vector<char*> ptrs;
+  for (void* p; (p = pool.allocate(70, 4)) != nullptr;) {
+    ptrs.push_back(static_cast<char*>(p));
+  }
+  ASSERT_GT(ptrs.size(), size_t(0.9 * (1 << 20) / 80));
+  std::sort(ptrs.begin(), ptrs.end());
+  for (size_t i = 1; i < ptrs.size(); ++i) {
+    ASSERT_LE(ptrs[i - 1] + 80, ptrs[i]);
+  }
+
+  typename MemPool::usage_statistics stats;
+  pool.get_usage_statistics(stats);
+  ASSERT_EQ(stats.consumed_blocks, ptrs.size());
+  ASSERT_EQ(stats.consumed_bytes, 80 * ptrs.size());
+
+  for (char* p : ptrs) pool.deallocate(p, 70);
+  pool.get_usage_statistics(stats);
+  ASSERT_EQ(stats.consumed_blocks, 0u);
+
+  ASSERT_THROW(MemPool(MemSpace(), 1 << 20, 64, 4096, 1 << 16, 3),
+               std::runtime_error);
+  ASSERT_THROW(MemPool(MemSpace(), 1 << 20, 32, 1 << 16, 1 << 16, 8),
+               std::runtime_error);
+}
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+template <class DeviceType>
+void test_memory_pool_cached() {
+  using execution_space = typename DeviceType::execution_space;
+  using pool_type       = Kokkos::MemoryPool<DeviceType>;
+  using token_type      = Kokkos::Experimental::UniqueToken<execution_space>;
+  using ptrs_type       = Kokkos::View<uintptr_t*, DeviceType>;
+
+  token_type token;
+  pool_type pool(typename DeviceType::memory_space(), 1 << 22, 64, 1024,
+                 1 << 16, 2, token.size());
+  ASSERT_EQ(pool.number_of_cache_slots(), token.size());
+
+  const int n = 10000;
+  ptrs_type ptrs("ptrs", n);
+
+  // Every thread allocates and frees through its cache, some blocks are
+  // freed by another thread than the one that allocated them.
+  long errors = 0;
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    long failed = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<execution_space>(0, n),
+        KOKKOS_LAMBDA(int i, long& err) {
+          const int slot = token.acquire();
+          const size_t size = 48 * (1 + i % 11);
+          auto p = static_cast<int*>(pool.allocate_cached(slot, size));
+          if (p == nullptr) {
+            ++err;
+          } else {
+            p[0]    = i;
+            ptrs(i) = reinterpret_cast<uintptr_t>(p);
+          }
+          token.release(slot);
+        },
+        failed);
+    errors += failed;
+
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<execution_space>(0, n),
+        KOKKOS_LAMBDA(int i, long& err) {
+          auto p = reinterpret_cast<int*>(ptrs(n - 1 - i));
+          if (p[0] != n - 1 - i) ++err;
+          const size_t size = 48 * (1 + (n - 1 - i) % 11);
+          const int slot    = token.acquire();
+          pool.deallocate_cached(slot, p, size);
+          token.release(slot);
+        },
+        failed);
+    errors += failed;
+  }
+  ASSERT_EQ(errors, 0);
+
+  // Only the cached blocks are still in use
+  typename pool_type::usage_statistics stats;
+  pool.get_usage_statistics(stats);
+  ASSERT_EQ(stats.consumed_blocks, stats.cached_blocks);
+  ASSERT_LE(stats.cached_blocks, size_t(16 * 11 * token.size()));
+
+  pool.flush_cached();
+  pool.get_usage_statistics(stats);
+  ASSERT_EQ(stats.consumed_blocks, 0u);
+  ASSERT_EQ(stats.cached_blocks, 0u);
+}
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
 template <class DeviceType>
 struct TestMemoryPool_Functor {
   using ptrs_type = Kokkos::View<uintptr_t*, DeviceType>;
@@ -530,6 +649,8 @@ namespace Test {
 TEST(TEST_CATEGORY, memory_pool) {
   TestMemoryPool::test_host_memory_pool_defaults<>();
   TestMemoryPool::test_host_memory_pool_stats<>();
+  TestMemoryPool::test_host_memory_pool_size_classes<>();
+  TestMemoryPool::test_memory_pool_cached<TEST_EXECSPACE>();
   TestMemoryPool::test_memory_pool_v2<TEST_EXECSPACE>(false, false);
   TestMemoryPool::test_memory_pool_corners<TEST_EXECSPACE>(false, false);
 #ifdef KOKKOS_ENABLE_LARGE_MEM_TESTS
@@ -192,6 +192,19 @@ TEST(defaultdevicetype, cmd_line_args_tune_internals) {
   EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
 }
 
+TEST(defaultdevicetype, cmd_line_args_host_wait_spin) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-host-wait-spin=0",
+      "--dummy",
+      "--kokkos-host-wait-spin=128",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_host_wait_spin());
+  EXPECT_EQ(settings.get_host_wait_spin(), 128);
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {"--dummy"});
+}
+
 TEST(defaultdevicetype, cmd_line_args_help) {
   CmdLineArgsHelper cla = {{
       "--help",
@@ -335,6 +348,17 @@ TEST(defaultdevicetype, env_vars_device_id) {
   EXPECT_EQ(settings.get_device_id(), 33);
 }
 
+TEST(defaultdevicetype, env_vars_host_wait_spin) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_HOST_WAIT_SPIN", "512"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_host_wait_spin());
+  EXPECT_EQ(settings.get_host_wait_spin(), 512);
+}
+
 TEST(defaultdevicetype, env_vars_disable_warnings) {
   for (auto const& value_true : {"1", "true", "TRUE", "yEs"}) {
     EnvVarsHelper ev = {{
@@ -226,4 +226,50 @@ TEST(TEST_CATEGORY, impl_shared_alloc) {
 #endif
 }
 
+TEST(TEST_CATEGORY, view_scoped_borrow) {
+  using view_type = Kokkos::View<int*, TEST_EXECSPACE>;
+  view_type a("a", 10);
+  {
+    Kokkos::Experimental::ScopedViewBorrow borrow(a);
+    ASSERT_EQ(a.use_count(), 2);
+    {
+      view_type b                      = borrow.view();
+      typename view_type::const_type c = b;
+      auto d                           = Kokkos::subview(b, std::pair(2, 5));
+      view_type e                      = b;
+      e                                = borrow.view();
+      ASSERT_EQ(a.use_count(), 2);
+      ASSERT_EQ(b.data(), a.data());
+      ASSERT_EQ(c.data(), a.data());
+      ASSERT_EQ(d.extent(0), 3u);
+      ASSERT_EQ(e.label(), "a");
+    }
+    auto b = borrow.view();
+    Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(0, 10),
+                         KOKKOS_LAMBDA(int i) { b(i) = i; });
+    Kokkos::fence();
+    ASSERT_EQ(a.use_count(), 2);
+  }
+  ASSERT_EQ(a.use_count(), 1);
+
+  auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  for (int i = 0; i < 10; ++i) ASSERT_EQ(h(i), i);
+}
+
+#ifdef KOKKOS_ENABLE_DEBUG
+TEST(TEST_CATEGORY_DEATH, view_scoped_borrow_escape) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+  using view_type = Kokkos::View<int*, TEST_EXECSPACE>;
+  view_type a("a", 10);
+  view_type escaped;
+  ASSERT_DEATH(
+      {
+        Kokkos::Experimental::ScopedViewBorrow borrow(a);
+        escaped = borrow.view();
+      },
+      "outlive the borrow scope");
+}
+#endif
+
 }  // namespace Test
@@ -0,0 +1,320 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace Test {
+
+namespace {
+
+using TiledLayout = Kokkos::Experimental::LayoutTiled<4, 8>;
+using AoSoALayout = Kokkos::Experimental::LayoutAoSoA<8>;
+
+template <class View>
+size_t offset_of(const View& v, size_t i, size_t j) {
+  return &v(i, j) - v.data();
+}
+
+size_t tiled_offset(size_t i, size_t j, size_t n1) {
+  const size_t tiles_1 = (n1 + 7) / 8;
+  return ((i / 4) * tiles_1 + j / 8) * 32 + (i % 4) * 8 + j % 8;
+}
+
+size_t aosoa_offset(size_t i, size_t k, size_t n1) {
+  return (i / 8) * 8 * n1 + k * 8 + i % 8;
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, view_layout_tiled) {
+  using view_type = Kokkos::View<int**, TiledLayout, TEST_EXECSPACE>;
+  constexpr int n0 = 10;
+  constexpr int n1 = 13;
+
+  view_type v("tiled", n0, n1);
+  ASSERT_EQ(v.extent(0), size_t(n0));
+  ASSERT_EQ(v.extent(1), size_t(n1));
+  ASSERT_EQ(v.span(), size_t(3 * 2 * 32));
+  ASSERT_FALSE(v.span_is_contiguous());
+  ASSERT_EQ(v.layout().dimension[1], size_t(n1));
+
+  for (size_t i = 0; i < v.extent(0); ++i)
+    for (size_t j = 0; j < v.extent(1); ++j)
+      ASSERT_EQ(offset_of(v, i, j), tiled_offset(i, j, n1));
+
+  // Fill tile by tile, with the policy tiles matching the layout
+  using selector = Kokkos::Impl::layout_iterate_type_selector<TiledLayout>;
+  using policy_type =
+      Kokkos::MDRangePolicy<TEST_EXECSPACE,
+                            Kokkos::Rank<2, selector::outer_iteration_pattern,
+                                         selector::inner_iteration_pattern>>;
+  Kokkos::parallel_for(
+      policy_type({0, 0}, {n0, n1},
+                  {int(TiledLayout::tile_extent(0)),
+                   int(TiledLayout::tile_extent(1))}),
+      KOKKOS_LAMBDA(int i, int j) { v(i, j) = 100 * i + j; });
+
+  // Element-wise copy to and from a LayoutRight View
+  Kokkos::View<int**, Kokkos::LayoutRight, TEST_EXECSPACE> right("right", n0,
+                                                                 n1);
+  Kokkos::deep_copy(right, v);
+  auto right_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), right);
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < n1; ++j) ASSERT_EQ(right_h(i, j), 100 * i + j);
+
+  view_type w("tiled_copy", n0, n1);
+  Kokkos::deep_copy(w, right);
+  auto w_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), w);
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < n1; ++j) ASSERT_EQ(w_h(i, j), 100 * i + j);
+
+  // A subview keeping both indices keeps the layout
+  auto t = Kokkos::subview(v, Kokkos::pair<int, int>(4, 8),
+                           Kokkos::pair<int, int>(8, 13));
+  static_assert(
+      std::is_same_v<typename decltype(t)::array_layout, TiledLayout>);
+  ASSERT_EQ(t.extent(0), 4u);
+  ASSERT_EQ(t.extent(1), 5u);
+  ASSERT_EQ(t.stride(0), 8u);
+  ASSERT_EQ(t.stride(1), 1u);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 5; ++j) ASSERT_EQ(&t(i, j), &v(4 + i, 8 + j));
+
+  // A row inside one tile is a LayoutStride View
+  auto row = Kokkos::subview(v, 9, Kokkos::pair<int, int>(8, 13));
+  static_assert(std::is_same_v<typename decltype(row)::array_layout,
+                               Kokkos::LayoutStride>);
+  for (int j = 0; j < 5; ++j) ASSERT_EQ(&row(j), &v(9, 8 + j));
+
+  auto element = Kokkos::subview(v, 6, 11);
+  ASSERT_EQ(&element(), &v(6, 11));
+}
+
+TEST(TEST_CATEGORY, view_layout_tiled_subview) {
+  using view_type = Kokkos::View<int**, TiledLayout, TEST_EXECSPACE>;
+  constexpr int n0 = 11;
+  constexpr int n1 = 21;
+
+  view_type v("tiled", n0, n1);
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<2>>({0, 0}, {n0, n1}),
+      KOKKOS_LAMBDA(int i, int j) { v(i, j) = 100 * i + j; });
+
+  // Whole tiles, across tile boundaries, keep the tile grid
+  auto tiles = Kokkos::subview(v, Kokkos::pair<int, int>(4, 11), Kokkos::ALL);
+  static_assert(
+      std::is_same_v<typename decltype(tiles)::array_layout, TiledLayout>);
+  ASSERT_EQ(tiles.extent(0), 7u);
+  ASSERT_EQ(tiles.extent(1), size_t(n1));
+  ASSERT_EQ(tiles.span(), size_t(2 * 3 * 32));
+  ASSERT_FALSE(tiles.span_is_contiguous());
+  for (int i = 0; i < 7; ++i)
+    for (int j = 0; j < n1; ++j) ASSERT_EQ(&tiles(i, j), &v(4 + i, j));
+
+  auto cols = Kokkos::subview(v, Kokkos::ALL, Kokkos::pair<int, int>(8, 20));
+  ASSERT_EQ(cols.span(), size_t((2 * 3 + 2) * 32));
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < 12; ++j) ASSERT_EQ(&cols(i, j), &v(i, 8 + j));
+
+  auto all = Kokkos::subview(v, Kokkos::ALL, Kokkos::ALL);
+  ASSERT_EQ(all.data(), v.data());
+  ASSERT_EQ(all.span(), v.span());
+
+  // deep_copy through the subviews, element-wise and to the same layout
+  Kokkos::View<int**, Kokkos::LayoutRight, TEST_EXECSPACE> right("right", 7,
+                                                                 n1);
+  Kokkos::deep_copy(right, tiles);
+  auto right_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), right);
+  for (int i = 0; i < 7; ++i)
+    for (int j = 0; j < n1; ++j) ASSERT_EQ(right_h(i, j), 100 * (4 + i) + j);
+
+  view_type w("tiled_copy", n0, 12);
+  Kokkos::deep_copy(w, cols);
+  auto w_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), w);
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < 12; ++j) ASSERT_EQ(w_h(i, j), 100 * i + 8 + j);
+
+  // Filling a subview leaves the rest of the View alone
+  Kokkos::deep_copy(cols, -1);
+  auto v_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < n1; ++j)
+      ASSERT_EQ(v_h(i, j), 8 <= j && j < 20 ? -1 : 100 * i + j);
+
+  // Copies walk the View one layout tile at a time
+  const Kokkos::Impl::ViewCopyTiles<TiledLayout, 2> copy_tiles{
+      TEST_EXECSPACE()};
+  ASSERT_EQ(copy_tiles.value[0], 4);
+  ASSERT_EQ(copy_tiles.value[1], 8);
+}
+
+TEST(TEST_CATEGORY, view_layout_blocked_resize) {
+  Kokkos::View<int**, TiledLayout, TEST_EXECSPACE> v("tiled", 10, 13);
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<2>>({0, 0}, {10, 13}),
+      KOKKOS_LAMBDA(int i, int j) { v(i, j) = 100 * i + j; });
+
+  Kokkos::resize(v, 6, 30);
+  ASSERT_EQ(v.extent(0), 6u);
+  ASSERT_EQ(v.extent(1), 30u);
+  auto v_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  for (int i = 0; i < 6; ++i)
+    for (int j = 0; j < 13; ++j) ASSERT_EQ(v_h(i, j), 100 * i + j);
+
+  Kokkos::View<double* [3], AoSoALayout, TEST_EXECSPACE> p("particles", 20);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, 20), KOKKOS_LAMBDA(int i) {
+        for (int k = 0; k < 3; ++k) p(i, k) = 10 * i + k;
+      });
+
+  Kokkos::resize(p, 29);
+  ASSERT_EQ(p.extent(0), 29u);
+  auto p_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), p);
+  for (int i = 0; i < 20; ++i)
+    for (int k = 0; k < 3; ++k) ASSERT_EQ(p_h(i, k), 10 * i + k);
+
+  Kokkos::realloc(p, 5);
+  ASSERT_EQ(p.extent(0), 5u);
+}
+
+TEST(TEST_CATEGORY, view_layout_tiled_contiguous) {
+  // Whole tiles only, so same layout copies are a single memcpy
+  using view_type = Kokkos::View<double***, Kokkos::Experimental::LayoutTiled<
+                                                2, 2, 4>,
+                                 TEST_EXECSPACE>;
+  view_type a("a", 4, 6, 8);
+  ASSERT_TRUE(a.span_is_contiguous());
+  ASSERT_EQ(a.span(), a.size());
+
+  auto a_h = Kokkos::create_mirror_view(a);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 6; ++j)
+      for (int k = 0; k < 8; ++k) a_h(i, j, k) = i * 100 + j * 10 + k;
+  Kokkos::deep_copy(a, a_h);
+
+  view_type b("b", 4, 6, 8);
+  Kokkos::deep_copy(b, a);
+  auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 6; ++j)
+      for (int k = 0; k < 8; ++k) ASSERT_EQ(b_h(i, j, k), a_h(i, j, k));
+}
+
+TEST(TEST_CATEGORY, view_layout_aosoa) {
+  using view_type = Kokkos::View<double* [3], AoSoALayout, TEST_EXECSPACE>;
+  constexpr int n = 20;
+
+  view_type p("particles", n);
+  ASSERT_EQ(p.extent(0), size_t(n));
+  ASSERT_EQ(p.span(), size_t(3 * 3 * 8));
+  ASSERT_FALSE(p.span_is_contiguous());
+
+  for (size_t i = 0; i < p.extent(0); ++i)
+    for (size_t k = 0; k < 3; ++k)
+      ASSERT_EQ(offset_of(p, i, k), aosoa_offset(i, k, 3));
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, n), KOKKOS_LAMBDA(int i) {
+        for (int k = 0; k < 3; ++k) p(i, k) = 10 * i + k;
+      });
+
+  Kokkos::View<double* [3], Kokkos::LayoutLeft, TEST_EXECSPACE> left("left",
+                                                                     n);
+  Kokkos::deep_copy(left, p);
+  auto left_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), left);
+  for (int i = 0; i < n; ++i)
+    for (int k = 0; k < 3; ++k) ASSERT_EQ(left_h(i, k), 10 * i + k);
+
+  // Members of one struct
+  auto s = Kokkos::subview(p, 13, Kokkos::ALL);
+  ASSERT_EQ(s.extent(0), 3u);
+  ASSERT_EQ(s.stride(0), 8u);
+  for (int k = 0; k < 3; ++k) ASSERT_EQ(&s(k), &p(13, k));
+
+  // One member of a vector block is contiguous
+  auto lanes = Kokkos::subview(p, Kokkos::pair<int, int>(8, 16), 1);
+  ASSERT_EQ(lanes.extent(0), 8u);
+  ASSERT_EQ(lanes.stride(0), 1u);
+  for (int i = 0; i < 8; ++i) ASSERT_EQ(&lanes(i), &p(8 + i, 1));
+
+  // One member of every struct keeps the vector blocks
+  auto member = Kokkos::subview(p, Kokkos::ALL, 2);
+  static_assert(
+      std::is_same_v<typename decltype(member)::array_layout, AoSoALayout>);
+  ASSERT_EQ(member.extent(0), size_t(n));
+  ASSERT_EQ(member.span(), size_t(2 * 3 * 8 + 8));
+  for (int i = 0; i < n; ++i) ASSERT_EQ(&member(i), &p(i, 2));
+
+  auto blocks = Kokkos::subview(p, Kokkos::pair<int, int>(8, n),
+                                Kokkos::pair<int, int>(1, 3));
+  ASSERT_EQ(blocks.extent(0), size_t(n - 8));
+  ASSERT_EQ(blocks.extent(1), 2u);
+  for (int i = 0; i < n - 8; ++i)
+    for (int k = 0; k < 2; ++k) ASSERT_EQ(&blocks(i, k), &p(8 + i, 1 + k));
+
+  Kokkos::View<double*, TEST_EXECSPACE> flat("flat", n);
+  Kokkos::deep_copy(flat, member);
+  auto flat_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), flat);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(flat_h(i), 10 * i + 2);
+}
+
+#ifdef KOKKOS_ENABLE_IMPL_MDSPAN
+TEST(TEST_CATEGORY, view_layout_blocked_mdspan) {
+  Kokkos::View<int**, TiledLayout, TEST_EXECSPACE> v("v", 9, 17);
+  auto mds = v.to_mdspan();
+  static_assert(std::is_same_v<typename decltype(mds)::layout_type,
+                               Kokkos::Experimental::layout_tiled<4, 8>>);
+  ASSERT_EQ(mds.mapping().required_span_size(), v.span());
+  for (size_t i = 0; i < v.extent(0); ++i)
+    for (size_t j = 0; j < v.extent(1); ++j)
+      ASSERT_EQ(size_t(mds.mapping()(i, j)), offset_of(v, i, j));
+
+  Kokkos::View<int**, TiledLayout, TEST_EXECSPACE,
+               Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+      u(mds);
+  ASSERT_EQ(u.data(), v.data());
+  ASSERT_EQ(u.extent(0), v.extent(0));
+  ASSERT_EQ(u.extent(1), v.extent(1));
+
+  Kokkos::View<float* [5], AoSoALayout, TEST_EXECSPACE> p("p", 11);
+  auto pmds = p.to_mdspan();
+  ASSERT_EQ(pmds.mapping().required_span_size(), p.span());
+  for (size_t i = 0; i < p.extent(0); ++i)
+    for (size_t k = 0; k < 5; ++k)
+      ASSERT_EQ(size_t(pmds.mapping()(i, k)), offset_of(p, i, k));
+
+  // Subviews keep the block strides of their View
+  auto t    = Kokkos::subview(v, Kokkos::ALL, Kokkos::pair<int, int>(8, 17));
+  auto tmds = t.to_mdspan();
+  ASSERT_EQ(tmds.mapping().required_span_size(), t.span());
+  for (size_t i = 0; i < t.extent(0); ++i)
+    for (size_t j = 0; j < t.extent(1); ++j)
+      ASSERT_EQ(size_t(tmds.mapping()(i, j)), offset_of(t, i, j));
+
+  auto q    = Kokkos::subview(p, Kokkos::ALL, Kokkos::pair<int, int>(1, 4));
+  auto qmds = q.to_mdspan();
+  ASSERT_EQ(qmds.mapping().required_span_size(), q.span());
+  for (size_t i = 0; i < q.extent(0); ++i)
+    for (size_t k = 0; k < q.extent(1); ++k)
+      ASSERT_EQ(size_t(qmds.mapping()(i, k)), offset_of(q, i, k));
+}
+#endif
+
+}  // namespace Test
@@ -98,6 +98,13 @@ constexpr bool atomic_always_lock_free(std::size_t size) {
       ;
 }
 
+// 16-byte compare-and-swap requires 16-byte alignment of the destination, so types
+// with the right size but a weaker alignment have to go through the lock array.
+template <class T>
+constexpr bool atomic_type_always_lock_free() {
+  return atomic_always_lock_free(sizeof(T)) && (sizeof(T) != 16 || alignof(T) >= 16);
+}
+
 template <std::size_t Size, std::size_t Align>
 DESUL_INLINE_FUNCTION bool atomic_is_lock_free() noexcept {
   return Size == 4 || Size == 8
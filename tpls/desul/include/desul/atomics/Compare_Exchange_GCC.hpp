@@ -9,6 +9,7 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #ifndef DESUL_ATOMICS_COMPARE_EXCHANGE_GCC_HPP_
 #define DESUL_ATOMICS_COMPARE_EXCHANGE_GCC_HPP_
 
+#include <cstring>
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
 #include <desul/atomics/Thread_Fence_GCC.hpp>
@@ -21,15 +22,23 @@ template <class T>
 struct host_atomic_exchange_available_gcc {
   constexpr static bool value =
 #ifndef DESUL_HAVE_LIBATOMIC
-      ((sizeof(T) == 4 && alignof(T) == 4) ||
-#ifdef DESUL_HAVE_16BYTE_COMPARE_AND_SWAP
-       (sizeof(T) == 16 && alignof(T) == 16) ||
-#endif
-       (sizeof(T) == 8 && alignof(T) == 8)) &&
+      ((sizeof(T) == 4 && alignof(T) == 4) || (sizeof(T) == 8 && alignof(T) == 8)) &&
 #endif
       std::is_trivially_copyable<T>::value;
 };
 
+// GCC does not inline __atomic builtins on 16-byte types (they are forwarded to
+// libatomic), but the legacy __sync builtins on __int128 do lower to cmpxchg16b/casp.
+template <class T>
+struct host_atomic_compare_exchange_16_available_gcc {
+  constexpr static bool value =
+#ifdef DESUL_HAVE_16BYTE_COMPARE_AND_SWAP
+      sizeof(T) == 16 && alignof(T) >= 16 && std::is_trivially_copyable<T>::value;
+#else
+      false;
+#endif
+};
+
 // clang-format off
 // Disable warning for large atomics on clang 7 and up (checked with godbolt)
 // error: large atomic operation may incur significant performance penalty [-Werror,-Watomic-alignment]
@@ -80,8 +89,48 @@ host_atomic_compare_exchange(
   return compare;
 }
 
+#ifdef DESUL_HAVE_16BYTE_COMPARE_AND_SWAP
+__extension__ typedef unsigned __int128 host_atomic_uint128_t;
+
+// The __sync builtins are full barriers, which satisfies every memory order.
+template <class T, class MemoryOrder, class MemoryScope>
+std::enable_if_t<host_atomic_compare_exchange_16_available_gcc<T>::value, T>
+host_atomic_compare_exchange(T* dest, T compare, T value, MemoryOrder, MemoryScope) {
+  host_atomic_uint128_t cmp_bits;
+  host_atomic_uint128_t val_bits;
+  std::memcpy(&cmp_bits, &compare, sizeof(T));
+  std::memcpy(&val_bits, &value, sizeof(T));
+  host_atomic_uint128_t const old_bits = __sync_val_compare_and_swap(
+      reinterpret_cast<host_atomic_uint128_t*>(dest), cmp_bits, val_bits);
+  T return_val;
+  std::memcpy(&return_val, &old_bits, sizeof(T));
+  return return_val;
+}
+
+template <class T, class MemoryOrder, class MemoryScope>
+std::enable_if_t<host_atomic_compare_exchange_16_available_gcc<T>::value, T>
+host_atomic_exchange(T* dest, T value, MemoryOrder, MemoryScope) {
+  auto* const dest_bits = reinterpret_cast<host_atomic_uint128_t*>(dest);
+  host_atomic_uint128_t val_bits;
+  std::memcpy(&val_bits, &value, sizeof(T));
+  // A torn initial read is harmless, the compare-and-swap below validates it.
+  host_atomic_uint128_t old_bits = *dest_bits;
+  host_atomic_uint128_t assume_bits;
+  do {
+    assume_bits = old_bits;
+    old_bits = __sync_val_compare_and_swap(dest_bits, assume_bits, val_bits);
+  } while (old_bits != assume_bits);
+  T return_val;
+  std::memcpy(&return_val, &old_bits, sizeof(T));
+  return return_val;
+}
+#endif
+
 template <class T, class MemoryOrder, class MemoryScope>
-std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_exchange(
+std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value &&
+                     !host_atomic_compare_exchange_16_available_gcc<T>::value,
+                 T>
+host_atomic_exchange(
     T* const dest,
     dont_deduce_this_parameter_t<const T> val,
     MemoryOrder /*order*/,
@@ -100,7 +149,9 @@ std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_e
 }
 
 template <class T, class MemoryOrder, class MemoryScope>
-std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T>
+std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value &&
+                     !host_atomic_compare_exchange_16_available_gcc<T>::value,
+                 T>
 host_atomic_compare_exchange(T* const dest,
                              dont_deduce_this_parameter_t<const T> compare,
                              dont_deduce_this_parameter_t<const T> val,
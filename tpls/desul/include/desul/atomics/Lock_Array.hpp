@@ -9,8 +9,12 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #ifndef DESUL_ATOMICS_LOCK_ARRAY_HPP_
 #define DESUL_ATOMICS_LOCK_ARRAY_HPP_
 
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
 #include <desul/atomics/Compare_Exchange.hpp>
 #include <desul/atomics/Macros.hpp>
+#include <thread>
 #ifdef DESUL_HAVE_CUDA_ATOMICS
 #include <desul/atomics/Lock_Array_CUDA.hpp>
 #endif
@@ -24,26 +28,98 @@ SPDX-License-Identifier: (BSD-3-Clause)
 namespace desul {
 namespace Impl {
 
+// Host locks are padded to their own cache line so that unrelated addresses hashing
+// to neighbouring locks do not false-share.  Use 128 bytes on targets where adjacent
+// line prefetching pairs cache lines.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || \
+    defined(__powerpc64__)
+#define DESUL_IMPL_HOST_LOCK_PADDING 128
+#else
+#define DESUL_IMPL_HOST_LOCK_PADDING 64
+#endif
+
+struct alignas(DESUL_IMPL_HOST_LOCK_PADDING) HostLock {
+  int32_t value;
+};
+
 struct HostLocks {
-  static constexpr uint32_t HOST_SPACE_ATOMIC_MASK = 0xFFFF;
   static constexpr uint32_t HOST_SPACE_ATOMIC_XOR_MASK = 0x5A39;
+  // The number of locks scales with the number of hardware threads so that the
+  // probability of two threads hashing to the same lock stays small, while the
+  // footprint stays bounded.
+  static constexpr uint32_t HOST_SPACE_ATOMIC_LOCKS_PER_THREAD = 32;
+  static constexpr uint32_t HOST_SPACE_ATOMIC_MIN_LOCKS = 1024;
+  static constexpr uint32_t HOST_SPACE_ATOMIC_MAX_LOCKS = 16384;
+
+  static uint32_t compute_host_lock_count_() {
+    uint64_t num_threads = std::thread::hardware_concurrency();
+    if (num_threads == 0) num_threads = 1;
+    uint32_t num_locks = HOST_SPACE_ATOMIC_MIN_LOCKS;
+    while (num_locks < HOST_SPACE_ATOMIC_MAX_LOCKS &&
+           num_locks < num_threads * HOST_SPACE_ATOMIC_LOCKS_PER_THREAD) {
+      num_locks *= 2;
+    }
+    return num_locks;
+  }
+
+  static uint32_t host_lock_mask_() {
+    static uint32_t const HOST_SPACE_ATOMIC_MASK = compute_host_lock_count_() - 1;
+    return HOST_SPACE_ATOMIC_MASK;
+  }
+
+  // The unaligned calloc'd block holding the locks, or nullptr.
   template <class is_always_void = void>
-  static int32_t* get_host_locks_() {
-    static int32_t HOST_SPACE_ATOMIC_LOCKS_DEVICE[HOST_SPACE_ATOMIC_MASK + 1] = {};
-    return HOST_SPACE_ATOMIC_LOCKS_DEVICE;
+  static std::atomic<void*>& host_locks_allocation_() {
+    static std::atomic<void*> HOST_SPACE_ATOMIC_LOCKS{nullptr};
+    return HOST_SPACE_ATOMIC_LOCKS;
   }
+
+  static void* allocate_host_locks_() {
+    // Zeroed pages from calloc are not touched here, so each page of the lock array
+    // is first-touched (and placed on the NUMA node of) the thread that first takes
+    // one of its locks.
+    void* raw = std::calloc(
+        std::size_t(host_lock_mask_() + 1) * sizeof(HostLock) +
+            DESUL_IMPL_HOST_LOCK_PADDING,
+        1);
+    if (raw == nullptr) {
+      std::abort();
+    }
+    void* installed = nullptr;
+    if (!host_locks_allocation_().compare_exchange_strong(
+            installed, raw, std::memory_order_acq_rel)) {
+      // Another thread allocated the locks first
+      std::free(raw);
+      raw = installed;
+    }
+    return raw;
+  }
+
+  static HostLock* get_host_locks_() {
+    void* raw = host_locks_allocation_().load(std::memory_order_acquire);
+    if (raw == nullptr) {
+      raw = allocate_host_locks_();
+    }
+    return reinterpret_cast<HostLock*>(
+        (reinterpret_cast<uintptr_t>(raw) + DESUL_IMPL_HOST_LOCK_PADDING) &
+        ~uintptr_t(DESUL_IMPL_HOST_LOCK_PADDING - 1));
+  }
+
+  // Must not run concurrently with atomics using the locks.  Host atomics used
+  // afterwards, e.g. during static destruction, allocate the locks again.
+  static void free_host_locks_() {
+    std::free(host_locks_allocation_().exchange(nullptr, std::memory_order_acq_rel));
+  }
+
   static inline int32_t* get_host_lock_(void* ptr) {
-    return &get_host_locks_()[((uint64_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
-                              HOST_SPACE_ATOMIC_XOR_MASK];
+    return &get_host_locks_()[((uint64_t(ptr) >> 2) ^ HOST_SPACE_ATOMIC_XOR_MASK) &
+                              host_lock_mask_()]
+                .value;
   }
 };
 
 inline void init_lock_arrays() {
-  static bool is_initialized = false;
-  if (!is_initialized) {
-    HostLocks::get_host_locks_();
-    is_initialized = true;
-  }
+  HostLocks::get_host_locks_();
 
 #ifdef DESUL_HAVE_CUDA_ATOMICS
   init_lock_arrays_cuda();
@@ -64,6 +140,11 @@ inline void finalize_lock_arrays() {
 #endif
 }
 
+// Release the host lock array.  The device lock arrays are released by
+// finalize_lock_arrays(), which device backends call before the host is done
+// with atomics, so this is separate.
+inline void finalize_host_lock_array() { HostLocks::free_host_locks_(); }
+
 inline void ensure_lock_arrays_on_device() {
 #ifdef DESUL_HAVE_CUDA_ATOMICS
   ensure_cuda_lock_arrays_on_device();
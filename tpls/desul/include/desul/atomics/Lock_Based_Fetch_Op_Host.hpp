@@ -22,8 +22,8 @@ template <class Oper,
           class MemoryOrder,
           class MemoryScope,
           // equivalent to:
-          //   requires !atomic_always_lock_free(sizeof(T))
-          std::enable_if_t<!atomic_always_lock_free(sizeof(T)), int> = 0>
+          //   requires !atomic_type_always_lock_free<T>()
+          std::enable_if_t<!atomic_type_always_lock_free<T>(), int> = 0>
 inline T host_atomic_fetch_oper(const Oper& op,
                                 T* const dest,
                                 dont_deduce_this_parameter_t<const T> val,
@@ -46,8 +46,8 @@ template <class Oper,
           class MemoryOrder,
           class MemoryScope,
           // equivalent to:
-          //   requires !atomic_always_lock_free(sizeof(T))
-          std::enable_if_t<!atomic_always_lock_free(sizeof(T)), int> = 0>
+          //   requires !atomic_type_always_lock_free<T>()
+          std::enable_if_t<!atomic_type_always_lock_free<T>(), int> = 0>
 inline T host_atomic_oper_fetch(const Oper& op,
                                 T* const dest,
                                 dont_deduce_this_parameter_t<const T> val,
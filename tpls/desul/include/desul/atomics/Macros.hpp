@@ -66,6 +66,20 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #define DESUL_HAVE_GCC_ATOMICS
 #endif
 
+// Native 16-byte compare-and-swap is provided by GCC-compatible compilers on x86-64
+// (cmpxchg16b, requires -mcx16 or an -march that implies it) and on AArch64 (casp with
+// LSE, an exclusive pair loop otherwise).  Whether it is used is decided when desul
+// is configured, so that translation units compiled with different flags do not mix
+// it with the lock array on the same address.
+#if defined(DESUL_ATOMICS_ENABLE_16BYTE_COMPARE_AND_SWAP) && \
+    defined(DESUL_HAVE_GCC_ATOMICS) && !defined(DESUL_HAVE_LIBATOMIC)
+#ifndef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+#error \
+    "desul was configured to use a native 16-byte compare-and-swap, compile with the same architecture flags (e.g. -mcx16)"
+#endif
+#define DESUL_HAVE_16BYTE_COMPARE_AND_SWAP
+#endif
+
 // Equivalent to above for MSVC atomics
 #if !defined(DESUL_HAVE_OPENMP_ATOMICS) && defined(_MSC_VER)
 #define DESUL_HAVE_MSVC_ATOMICS